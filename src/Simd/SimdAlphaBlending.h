@@ -80,6 +80,26 @@ namespace Simd
         {
             return DivideBy255(src * alpha + dst * (0xFF - alpha));
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        void AlphaBlendingPremultiplied(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, size_t channelCount);
+
+        struct AlphaCompositeKernels
+        {
+            typedef void(*BlendingPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t* alpha, size_t alphaStride, uint8_t* dst, size_t dstStride);
+            typedef void(*BlendingUniformPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t alpha, uint8_t* dst, size_t dstStride);
+            typedef void(*FillingPtr)(uint8_t* dst, size_t dstStride, size_t width, size_t height, const uint8_t* channel, size_t channelCount, const uint8_t* alpha, size_t alphaStride);
+            typedef void(*PremultipliedPtr)(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, size_t channelCount);
+
+            size_t minWidth;
+            BlendingPtr blending;
+            BlendingUniformPtr blendingUniform;
+            FillingPtr filling;
+            PremultipliedPtr premultiplied;
+        };
+
+        void AlphaComposite(const SimdAlphaLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height, size_t channelCount, const AlphaCompositeKernels& kernels);
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -369,6 +369,7 @@ namespace Simd
             case SimdConvolutionActivationMish: SetInput<SimdConvolutionActivationMish>(p, input); break;
             case SimdConvolutionActivationHardSigmoid: SetInput<SimdConvolutionActivationHardSigmoid>(p, input); break;
             case SimdConvolutionActivationSwish: SetInput<SimdConvolutionActivationSwish>(p, input); break;
+            case SimdConvolutionActivationGelu: SetInput<SimdConvolutionActivationGelu>(p, input); break;
             }
         }
     }
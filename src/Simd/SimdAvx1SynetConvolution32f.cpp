@@ -770,7 +770,7 @@ namespace Simd
 
         void * SynetConvolution32fInit(size_t batch, const SimdConvolutionParameters * conv, SimdSynetCompatibilityType compatibility)
         {
-            if (conv->activation == SimdConvolutionActivationElu || conv->activation == SimdConvolutionActivationSwish)
+            if (conv->activation == SimdConvolutionActivationElu || conv->activation == SimdConvolutionActivationSwish || conv->activation == SimdConvolutionActivationGelu)
                 return Sse41::SynetConvolution32fInit(batch, conv, compatibility);
             ConvParam32f param(batch, conv, compatibility);
             if (!param.Valid())
@@ -472,7 +472,8 @@ namespace Simd
 			for (size_t i = 0; i < _param.count; ++i)
 				if (p.conv[i].activation == SimdConvolutionActivationElu || 
 					p.conv[i].activation == SimdConvolutionActivationMish ||
-					p.conv[i].activation == SimdConvolutionActivationSwish)
+					p.conv[i].activation == SimdConvolutionActivationSwish ||
+					p.conv[i].activation == SimdConvolutionActivationGelu)
 					return;
 			SynetMergedConvolution32fCdc::Set(_param, 0, 0, _convolution);
 			SynetMergedConvolution32fCd::Set(_param, 1, 1, _convolution);
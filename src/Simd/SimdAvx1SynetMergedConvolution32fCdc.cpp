@@ -1451,7 +1451,8 @@ namespace Simd
 			for (size_t i = 0; i < _param.count; ++i)
 				if (p.conv[i].activation == SimdConvolutionActivationElu ||
 					p.conv[i].activation == SimdConvolutionActivationMish ||
-					p.conv[i].activation == SimdConvolutionActivationSwish)
+					p.conv[i].activation == SimdConvolutionActivationSwish ||
+					p.conv[i].activation == SimdConvolutionActivationGelu)
 					return;
 			for (size_t i = 0; i < _param.count; ++i)
 				Set(p, i, i, _convolution);
@@ -1480,7 +1481,8 @@ namespace Simd
 			for (size_t i = 0; i < count; ++i)
 				if (convs[i].activation == SimdConvolutionActivationElu ||
 					convs[i].activation == SimdConvolutionActivationMish ||
-					convs[i].activation == SimdConvolutionActivationSwish)
+					convs[i].activation == SimdConvolutionActivationSwish ||
+					convs[i].activation == SimdConvolutionActivationGelu)
 					return Sse41::SynetMergedConvolution32fInit(batch, convs, count, add, compatibility);
 			MergConvParam32f param(batch, convs, count, add, compatibility);
 			if (!param.Valid())
@@ -431,7 +431,8 @@ namespace Simd
 			for (size_t i = 0; i < _param.count; ++i)
 				if (p.conv[i].activation == SimdConvolutionActivationElu ||
 					p.conv[i].activation == SimdConvolutionActivationMish ||
-					p.conv[i].activation == SimdConvolutionActivationSwish)
+					p.conv[i].activation == SimdConvolutionActivationSwish ||
+					p.conv[i].activation == SimdConvolutionActivationGelu)
 					return;
 			SynetMergedConvolution32fDc::Set(_param, 1, 0, _convolution);
 			SynetMergedConvolution32fCdc::Set(_param, 2, 1, _convolution);
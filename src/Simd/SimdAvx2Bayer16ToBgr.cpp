@@ -0,0 +1,196 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i Bayer16Gain(__m256i src, __m256i gain, __m256i round, __m256i max)
+        {
+            return _mm256_min_epi32(_mm256_srli_epi32(_mm256_add_epi32(_mm256_mullo_epi32(src, gain), round), Base::BAYER16_GAIN_SHIFT), max);
+        }
+
+        SIMD_INLINE __m256i Bayer16Load(const uint16_t* src)
+        {
+            return _mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)src));
+        }
+
+        SIMD_INLINE void Bayer16Store(uint16_t* dst, __m256i lo, __m256i hi)
+        {
+            _mm256_storeu_si256((__m256i*)dst, _mm256_permute4x64_epi64(_mm256_packus_epi32(lo, hi), 0xD8));
+        }
+
+        SIMD_INLINE void Bayer16GainRow16(const uint16_t* src, __m256i gain, __m256i round, __m256i max, uint16_t* dst)
+        {
+            __m256i lo = Bayer16Gain(Bayer16Load(src + 0), gain, round, max);
+            __m256i hi = Bayer16Gain(Bayer16Load(src + 8), gain, round, max);
+            Bayer16Store(dst, lo, hi);
+        }
+
+        void Bayer16GainRow(const uint16_t* src, size_t width, const uint32_t gain[2], uint32_t max, uint16_t* dst)
+        {
+            assert(width >= HA);
+
+            __m256i _gain = _mm256_setr_epi32(gain[0], gain[1], gain[0], gain[1], gain[0], gain[1], gain[0], gain[1]);
+            __m256i _round = _mm256_set1_epi32(1 << (Base::BAYER16_GAIN_SHIFT - 1));
+            __m256i _max = _mm256_set1_epi32(max);
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                Bayer16GainRow16(src + x, _gain, _round, _max, dst + x);
+            if (widthHA < width)
+                Bayer16GainRow16(src + width - HA, _gain, _round, _max, dst + width - HA);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256i Bayer16Value(__m256i value, __m256i round, __m128i shift, __m256i max)
+        {
+            return _mm256_min_epi32(_mm256_max_epi32(_mm256_sra_epi32(_mm256_add_epi32(value, round), shift), K_ZERO), max);
+        }
+
+        template<bool malvar, bool red> SIMD_INLINE __m256i Bayer16Demosaic(const uint16_t* src[5], size_t x, __m256i green,
+            __m256i round, __m128i shift, __m256i max, __m256i& b, __m256i& g)
+        {
+            __m256i c = Bayer16Load(src[2] + x);
+            __m256i we = _mm256_add_epi32(Bayer16Load(src[2] + x - 1), Bayer16Load(src[2] + x + 1));
+            __m256i ns = _mm256_add_epi32(Bayer16Load(src[1] + x), Bayer16Load(src[3] + x));
+            __m256i diag = _mm256_add_epi32(_mm256_add_epi32(Bayer16Load(src[1] + x - 1), Bayer16Load(src[1] + x + 1)),
+                _mm256_add_epi32(Bayer16Load(src[3] + x - 1), Bayer16Load(src[3] + x + 1)));
+            __m256i gat, hor, ver, dia;
+            if (malvar)
+            {
+                __m256i wwee = _mm256_add_epi32(Bayer16Load(src[2] + x - 2), Bayer16Load(src[2] + x + 2));
+                __m256i nnss = _mm256_add_epi32(Bayer16Load(src[0] + x), Bayer16Load(src[4] + x));
+                __m256i far = _mm256_add_epi32(wwee, nnss), c10 = _mm256_add_epi32(_mm256_slli_epi32(c, 3), _mm256_slli_epi32(c, 1));
+                __m256i diag2 = _mm256_slli_epi32(diag, 1);
+                gat = _mm256_sub_epi32(_mm256_add_epi32(_mm256_slli_epi32(c, 3), _mm256_slli_epi32(_mm256_add_epi32(we, ns), 2)), _mm256_slli_epi32(far, 1));
+                hor = _mm256_add_epi32(_mm256_sub_epi32(_mm256_add_epi32(c10, _mm256_slli_epi32(we, 3)), _mm256_add_epi32(_mm256_slli_epi32(wwee, 1), diag2)), nnss);
+                ver = _mm256_add_epi32(_mm256_sub_epi32(_mm256_add_epi32(c10, _mm256_slli_epi32(ns, 3)), _mm256_add_epi32(_mm256_slli_epi32(nnss, 1), diag2)), wwee);
+                dia = _mm256_sub_epi32(_mm256_add_epi32(_mm256_add_epi32(c10, _mm256_slli_epi32(c, 1)), _mm256_slli_epi32(diag, 2)), _mm256_add_epi32(_mm256_slli_epi32(far, 1), far));
+            }
+            else
+            {
+                gat = _mm256_slli_epi32(_mm256_add_epi32(we, ns), 2);
+                hor = _mm256_slli_epi32(we, 3);
+                ver = _mm256_slli_epi32(ns, 3);
+                dia = _mm256_slli_epi32(diag, 2);
+            }
+            c = _mm256_slli_epi32(c, 4);
+            b = Bayer16Value(_mm256_blendv_epi8(red ? dia : c, red ? ver : hor, green), round, shift, max);
+            g = Bayer16Value(_mm256_blendv_epi8(gat, c, green), round, shift, max);
+            return Bayer16Value(_mm256_blendv_epi8(red ? c : dia, red ? hor : ver, green), round, shift, max);
+        }
+
+        template<bool malvar, bool red> SIMD_INLINE void Bayer16Demosaic16(const uint16_t* src[5], size_t x, __m256i green,
+            __m256i round, __m128i shift, __m256i max, uint16_t* b, uint16_t* g, uint16_t* r)
+        {
+            __m256i b0, g0, b1, g1;
+            __m256i r0 = Bayer16Demosaic<malvar, red>(src, x + 0, green, round, shift, max, b0, g0);
+            __m256i r1 = Bayer16Demosaic<malvar, red>(src, x + 8, green, round, shift, max, b1, g1);
+            Bayer16Store(b + x, b0, b1);
+            Bayer16Store(g + x, g0, g1);
+            Bayer16Store(r + x, r0, r1);
+        }
+
+        template<bool malvar, bool red> void Bayer16DemosaicRow(const uint16_t* src[5], size_t width, bool greenFirst, int shift, int max, uint16_t* b, uint16_t* g, uint16_t* r)
+        {
+            __m256i green = greenFirst ? _mm256_setr_epi32(-1, 0, -1, 0, -1, 0, -1, 0) : _mm256_setr_epi32(0, -1, 0, -1, 0, -1, 0, -1);
+            __m256i _round = _mm256_set1_epi32(1 << (shift - 1));
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            __m256i _max = _mm256_set1_epi32(max);
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                Bayer16Demosaic16<malvar, red>(src, x, green, _round, _shift, _max, b, g, r);
+            if (widthHA < width)
+                Bayer16Demosaic16<malvar, red>(src, width - HA, green, _round, _shift, _max, b, g, r);
+        }
+
+        void Bayer16DemosaicRow(const uint16_t* src[5], size_t width, bool malvar, bool red, bool greenFirst, int shift, int max, uint16_t* b, uint16_t* g, uint16_t* r)
+        {
+            assert(width >= HA);
+
+            if (malvar)
+            {
+                if (red)
+                    Bayer16DemosaicRow<true, true>(src, width, greenFirst, shift, max, b, g, r);
+                else
+                    Bayer16DemosaicRow<true, false>(src, width, greenFirst, shift, max, b, g, r);
+            }
+            else
+            {
+                if (red)
+                    Bayer16DemosaicRow<false, true>(src, width, greenFirst, shift, max, b, g, r);
+                else
+                    Bayer16DemosaicRow<false, false>(src, width, greenFirst, shift, max, b, g, r);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE __m256i Bayer16Pack(const uint16_t* src)
+        {
+            return PackI16ToU8(_mm256_loadu_si256((__m256i*)src + 0), _mm256_loadu_si256((__m256i*)src + 1));
+        }
+
+        SIMD_INLINE void StoreBgr24(const uint16_t* b, const uint16_t* g, const uint16_t* r, uint8_t* bgr)
+        {
+            __m256i _b = Bayer16Pack(b), _g = Bayer16Pack(g), _r = Bayer16Pack(r);
+            _mm256_storeu_si256((__m256i*)bgr + 0, InterleaveBgr<0>(_b, _g, _r));
+            _mm256_storeu_si256((__m256i*)bgr + 1, InterleaveBgr<1>(_b, _g, _r));
+            _mm256_storeu_si256((__m256i*)bgr + 2, InterleaveBgr<2>(_b, _g, _r));
+        }
+
+        void Bayer16StoreRow(const uint16_t* b, const uint16_t* g, const uint16_t* r, size_t width, size_t bgrDepth, uint8_t* bgr)
+        {
+            if (bgrDepth == 8 && width >= A)
+            {
+                size_t widthA = AlignLo(width, A);
+                for (size_t x = 0; x < widthA; x += A)
+                    StoreBgr24(b + x, g + x, r + x, bgr + 3 * x);
+                if (widthA < width)
+                    StoreBgr24(b + width - A, g + width - A, r + width - A, bgr + 3 * (width - A));
+            }
+            else
+                Sse41::Bayer16StoreRow(b, g, r, width, bgrDepth, bgr);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void Bayer16ToBgr(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            const float* gains, SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth)
+        {
+            assert(width >= HA);
+
+            Base::Bayer16ToBgr(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, demosaic, bgr, bgrStride, bgrDepth,
+                Bayer16GainRow, Bayer16DemosaicRow, Bayer16StoreRow);
+        }
+    }
+#endif
+}
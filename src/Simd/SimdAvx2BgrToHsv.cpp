@@ -0,0 +1,136 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdUnpack.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE __m256i HsvHue32(__m256i dividend, __m256i range)
+        {
+            __m256 hue = _mm256_div_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(dividend), _mm256_set1_ps(Base::KF_255_DIV_6)), _mm256_cvtepi32_ps(range));
+            return _mm256_and_si256(_mm256_cvttps_epi32(hue), K32_000000FF);
+        }
+
+        SIMD_INLINE __m256i HsvHue16(__m256i blue, __m256i green, __m256i red, __m256i range, __m256i redMax, __m256i greenMax)
+        {
+            __m256i dividend = _mm256_add_epi16(_mm256_sub_epi16(red, green), _mm256_mullo_epi16(range, K16_0004));
+            dividend = _mm256_blendv_epi8(dividend, _mm256_add_epi16(_mm256_sub_epi16(blue, red), _mm256_mullo_epi16(range, K16_0002)), greenMax);
+            dividend = _mm256_blendv_epi8(dividend, _mm256_add_epi16(_mm256_sub_epi16(green, blue), _mm256_mullo_epi16(range, K16_0006)), redMax);
+            __m256i lo = HsvHue32(_mm256_srai_epi32(_mm256_unpacklo_epi16(dividend, dividend), 16), _mm256_unpacklo_epi16(range, K_ZERO));
+            __m256i hi = HsvHue32(_mm256_srai_epi32(_mm256_unpackhi_epi16(dividend, dividend), 16), _mm256_unpackhi_epi16(range, K_ZERO));
+            return _mm256_packus_epi32(lo, hi);
+        }
+
+        SIMD_INLINE __m256i HsvSaturationInRange16(__m256i max, __m256i range, __m256i satLo, __m256i satHi)
+        {
+            __m256i scaled = _mm256_mullo_epi16(range, K16_00FF);
+            __m256i geLo = _mm256_cmpeq_epi16(_mm256_max_epu16(scaled, _mm256_mullo_epi16(max, satLo)), scaled);
+            __m256i geHi = _mm256_cmpeq_epi16(_mm256_max_epu16(scaled, _mm256_mullo_epi16(max, satHi)), scaled);
+            return _mm256_andnot_si256(geHi, geLo);
+        }
+
+        SIMD_INLINE __m256i GreaterOrEqual8u(__m256i a, __m256i b)
+        {
+            return _mm256_cmpeq_epi8(_mm256_max_epu8(a, b), a);
+        }
+
+        SIMD_INLINE __m256i LesserOrEqual8u(__m256i a, __m256i b)
+        {
+            return _mm256_cmpeq_epi8(_mm256_min_epu8(a, b), a);
+        }
+
+        struct HsvRange
+        {
+            __m256i hueLo, hueHi, satLo, satHi, satZero, valLo, valHi;
+            bool hueWrap;
+
+            HsvRange(const uint8_t * lo, const uint8_t * hi)
+            {
+                hueLo = _mm256_set1_epi8(lo[0]);
+                hueHi = _mm256_set1_epi8(hi[0]);
+                hueWrap = lo[0] > hi[0];
+                satLo = _mm256_set1_epi16(lo[1]);
+                satHi = _mm256_set1_epi16(hi[1] + 1);
+                satZero = _mm256_set1_epi8(lo[1] == 0 ? -1 : 0);
+                valLo = _mm256_set1_epi8(lo[2]);
+                valHi = _mm256_set1_epi8(hi[2]);
+            }
+        };
+
+        SIMD_INLINE void BgrToHsvRangeMask(const uint8_t * bgr, const HsvRange & hsv, uint8_t * mask)
+        {
+            __m256i _bgr[3];
+            _bgr[0] = _mm256_loadu_si256((__m256i*)bgr + 0);
+            _bgr[1] = _mm256_loadu_si256((__m256i*)bgr + 1);
+            _bgr[2] = _mm256_loadu_si256((__m256i*)bgr + 2);
+            __m256i blue = BgrToBlue(_bgr);
+            __m256i green = BgrToGreen(_bgr);
+            __m256i red = BgrToRed(_bgr);
+            __m256i max = _mm256_max_epu8(red, _mm256_max_epu8(green, blue));
+            __m256i min = _mm256_min_epu8(red, _mm256_min_epu8(green, blue));
+            __m256i range = _mm256_sub_epi8(max, min);
+            __m256i redMax = _mm256_cmpeq_epi8(red, max);
+            __m256i greenMax = _mm256_andnot_si256(redMax, _mm256_cmpeq_epi8(green, max));
+
+            __m256i hue = _mm256_packus_epi16(
+                HsvHue16(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red), UnpackU8<0>(range), UnpackU8<0>(redMax, redMax), UnpackU8<0>(greenMax, greenMax)),
+                HsvHue16(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red), UnpackU8<1>(range), UnpackU8<1>(redMax, redMax), UnpackU8<1>(greenMax, greenMax)));
+            hue = _mm256_andnot_si256(_mm256_cmpeq_epi8(range, K_ZERO), hue);
+            __m256i hueGe = GreaterOrEqual8u(hue, hsv.hueLo);
+            __m256i hueLe = LesserOrEqual8u(hue, hsv.hueHi);
+            __m256i result = hsv.hueWrap ? _mm256_or_si256(hueGe, hueLe) : _mm256_and_si256(hueGe, hueLe);
+
+            __m256i saturation = _mm256_packs_epi16(
+                HsvSaturationInRange16(UnpackU8<0>(max), UnpackU8<0>(range), hsv.satLo, hsv.satHi),
+                HsvSaturationInRange16(UnpackU8<1>(max), UnpackU8<1>(range), hsv.satLo, hsv.satHi));
+            saturation = _mm256_blendv_epi8(saturation, hsv.satZero, _mm256_cmpeq_epi8(max, K_ZERO));
+            result = _mm256_and_si256(result, saturation);
+
+            result = _mm256_and_si256(result, _mm256_and_si256(GreaterOrEqual8u(max, hsv.valLo), LesserOrEqual8u(max, hsv.valHi)));
+            _mm256_storeu_si256((__m256i*)mask, result);
+        }
+
+        void BgrToHsvRangeMask(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lo, const uint8_t * hi, uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+
+            HsvRange hsv(lo, hi);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BgrToHsvRangeMask(bgr + 3 * col, hsv, mask + col);
+                if (width != alignedWidth)
+                    BgrToHsvRangeMask(bgr + 3 * (width - A), hsv, mask + width - A);
+                bgr += bgrStride;
+                mask += maskStride;
+            }
+        }
+    }
+#endif
+}
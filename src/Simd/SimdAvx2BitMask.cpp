@@ -0,0 +1,364 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdExtract.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        void BitMaskPack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                {
+                    __m256i zero = _mm256_cmpeq_epi8(_mm256_loadu_si256((__m256i*)(src + col)), K_ZERO);
+                    *(uint32_t*)(dst + col / 8) = ~uint32_t(_mm256_movemask_epi8(zero));
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+            if (widthA < width)
+                Base::BitMaskPack(src - height * srcStride + widthA, srcStride, width - widthA, height, dst - height * dstStride + widthA / 8, dstStride);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        const __m256i K8_BIT_MASK_SHUFFLE = SIMD_MM256_SETR_EPI8(0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1, 0x1,
+            0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x2, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3, 0x3);
+        const __m256i K8_BIT_MASK_BITS = SIMD_MM256_SETR_EPI8(0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80,
+            0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80);
+
+        SIMD_INLINE __m256i BitMaskExpand(__m256i bits, __m256i shuffle, __m256i mask)
+        {
+            return _mm256_cmpeq_epi8(_mm256_and_si256(_mm256_shuffle_epi8(bits, shuffle), mask), mask);
+        }
+
+        void BitMaskUnpack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A);
+
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                {
+                    __m256i bits = _mm256_set1_epi32(*(uint32_t*)(src + col / 8));
+                    _mm256_storeu_si256((__m256i*)(dst + col), BitMaskExpand(bits, K8_BIT_MASK_SHUFFLE, K8_BIT_MASK_BITS));
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+            if (widthA < width)
+                Base::BitMaskUnpack(src - height * srcStride + widthA / 8, srcStride, width - widthA, height, dst - height * dstStride + widthA, dstStride);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template <SimdBitMaskOperationType type> SIMD_INLINE __m256i BitMaskOperation(__m256i a, __m256i b);
+
+        template <> SIMD_INLINE __m256i BitMaskOperation<SimdBitMaskOperationAnd>(__m256i a, __m256i b)
+        {
+            return _mm256_and_si256(a, b);
+        }
+
+        template <> SIMD_INLINE __m256i BitMaskOperation<SimdBitMaskOperationOr>(__m256i a, __m256i b)
+        {
+            return _mm256_or_si256(a, b);
+        }
+
+        template <> SIMD_INLINE __m256i BitMaskOperation<SimdBitMaskOperationXor>(__m256i a, __m256i b)
+        {
+            return _mm256_xor_si256(a, b);
+        }
+
+        template <> SIMD_INLINE __m256i BitMaskOperation<SimdBitMaskOperationAndNot>(__m256i a, __m256i b)
+        {
+            return _mm256_andnot_si256(b, a);
+        }
+
+        template <SimdBitMaskOperationType type> void BitMaskOperation(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+            size_t sizeA, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t i = 0; i < sizeA; i += A)
+                {
+                    __m256i _a = _mm256_loadu_si256((__m256i*)(a + i));
+                    __m256i _b = _mm256_loadu_si256((__m256i*)(b + i));
+                    _mm256_storeu_si256((__m256i*)(dst + i), BitMaskOperation<type>(_a, _b));
+                }
+                a += aStride;
+                b += bStride;
+                dst += dstStride;
+            }
+        }
+
+        void BitMaskOperation(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+            size_t width, size_t height, SimdBitMaskOperationType type, uint8_t * dst, size_t dstStride)
+        {
+            size_t sizeA = AlignLo(width / 8, A);
+            switch (type)
+            {
+            case SimdBitMaskOperationAnd:
+                BitMaskOperation<SimdBitMaskOperationAnd>(a, aStride, b, bStride, sizeA, height, dst, dstStride);
+                break;
+            case SimdBitMaskOperationOr:
+                BitMaskOperation<SimdBitMaskOperationOr>(a, aStride, b, bStride, sizeA, height, dst, dstStride);
+                break;
+            case SimdBitMaskOperationXor:
+                BitMaskOperation<SimdBitMaskOperationXor>(a, aStride, b, bStride, sizeA, height, dst, dstStride);
+                break;
+            case SimdBitMaskOperationAndNot:
+                BitMaskOperation<SimdBitMaskOperationAndNot>(a, aStride, b, bStride, sizeA, height, dst, dstStride);
+                break;
+            default:
+                assert(0);
+            }
+            if (sizeA * 8 < width)
+                Base::BitMaskOperation(a + sizeA, aStride, b + sizeA, bStride, width - sizeA * 8, height, type, dst + sizeA, dstStride);
+        }
+
+        void BitMaskNot(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            size_t sizeA = AlignLo(width / 8, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t i = 0; i < sizeA; i += A)
+                    _mm256_storeu_si256((__m256i*)(dst + i), _mm256_xor_si256(_mm256_loadu_si256((__m256i*)(src + i)), K_INV_ZERO));
+                src += srcStride;
+                dst += dstStride;
+            }
+            if (sizeA * 8 < width)
+                Base::BitMaskNot(src - height * srcStride + sizeA, srcStride, width - sizeA * 8, height, dst - height * dstStride + sizeA, dstStride);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        const __m256i K8_0F = SIMD_MM256_SET1_EPI8(0x0F);
+        const __m256i K8_BIT_COUNT = SIMD_MM256_SETR_EPI8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+
+        SIMD_INLINE __m256i BitCount(__m256i value)
+        {
+            __m256i lo = _mm256_shuffle_epi8(K8_BIT_COUNT, _mm256_and_si256(value, K8_0F));
+            __m256i hi = _mm256_shuffle_epi8(K8_BIT_COUNT, _mm256_and_si256(_mm256_srli_epi16(value, 4), K8_0F));
+            return _mm256_sad_epu8(_mm256_add_epi8(lo, hi), K_ZERO);
+        }
+
+        void BitMaskCount(const uint8_t * mask, size_t stride, size_t width, size_t height, uint64_t * count)
+        {
+            size_t sizeA = AlignLo(width / 8, A);
+            __m256i sum = _mm256_setzero_si256();
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t i = 0; i < sizeA; i += A)
+                    sum = _mm256_add_epi64(sum, BitCount(_mm256_loadu_si256((__m256i*)(mask + i))));
+                mask += stride;
+            }
+            *count = ExtractSum<uint64_t>(sum);
+            if (sizeA * 8 < width)
+            {
+                uint64_t tail;
+                Base::BitMaskCount(mask - height * stride + sizeA, stride, width - sizeA * 8, height, &tail);
+                *count += tail;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void BitMaskBoundingBox(const uint8_t * mask, size_t stride, size_t width, size_t height, ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom)
+        {
+            size_t size = DivHi(width, 8), full = width / 8, fullA = AlignLo(full, A);
+            uint8_t tail = uint8_t((1 << (width & 7)) - 1);
+            Array8u cols(size, true);
+            ptrdiff_t first = -1, last = -1;
+            for (size_t row = 0; row < height; ++row)
+            {
+                __m256i any = _mm256_setzero_si256();
+                for (size_t i = 0; i < fullA; i += A)
+                {
+                    __m256i bits = _mm256_loadu_si256((__m256i*)(mask + i));
+                    _mm256_storeu_si256((__m256i*)(cols.data + i), _mm256_or_si256(_mm256_loadu_si256((__m256i*)(cols.data + i)), bits));
+                    any = _mm256_or_si256(any, bits);
+                }
+                uint8_t anyTail = 0;
+                for (size_t i = fullA; i < full; ++i)
+                {
+                    cols[i] |= mask[i];
+                    anyTail |= mask[i];
+                }
+                if (width & 7)
+                {
+                    uint8_t bits = mask[full] & tail;
+                    cols[full] |= bits;
+                    anyTail |= bits;
+                }
+                if (!_mm256_testz_si256(any, any) || anyTail)
+                {
+                    if (first < 0)
+                        first = row;
+                    last = row;
+                }
+                mask += stride;
+            }
+            if (first < 0)
+            {
+                *left = 0, *top = 0, *right = 0, *bottom = 0;
+                return;
+            }
+            Base::BitMaskBoundingBox(cols.data, size, width, 1, left, top, right, bottom);
+            *top = first;
+            *bottom = last + 1;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<size_t N> struct BitMaskPixels
+        {
+            __m256i shuffle[N], bits[N];
+
+            BitMaskPixels()
+            {
+                uint8_t _shuffle[N * A], _bits[N * A];
+                for (size_t i = 0; i < N * A; ++i)
+                {
+                    size_t point = i / N;
+                    _shuffle[i] = uint8_t(point / 8);
+                    _bits[i] = uint8_t(1 << (point % 8));
+                }
+                for (size_t n = 0; n < N; ++n)
+                {
+                    shuffle[n] = _mm256_loadu_si256((__m256i*)_shuffle + n);
+                    bits[n] = _mm256_loadu_si256((__m256i*)_bits + n);
+                }
+            }
+
+            SIMD_INLINE __m256i Mask(__m256i mask, size_t n) const
+            {
+                return BitMaskExpand(mask, shuffle[n], bits[n]);
+            }
+        };
+
+        template<size_t N> void BitMaskCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            const uint8_t * mask, size_t maskStride, uint8_t * dst, size_t dstStride)
+        {
+            assert(width >= A);
+
+            BitMaskPixels<N> pixels;
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                {
+                    __m256i _mask = _mm256_set1_epi32(*(uint32_t*)(mask + col / 8));
+                    const uint8_t * s = src + col * N;
+                    uint8_t * d = dst + col * N;
+                    for (size_t n = 0; n < N; ++n)
+                    {
+                        __m256i _src = _mm256_loadu_si256((__m256i*)s + n);
+                        __m256i _dst = _mm256_loadu_si256((__m256i*)d + n);
+                        _mm256_storeu_si256((__m256i*)d + n, _mm256_blendv_epi8(_dst, _src, pixels.Mask(_mask, n)));
+                    }
+                }
+                src += srcStride;
+                mask += maskStride;
+                dst += dstStride;
+            }
+            if (widthA < width)
+                Base::BitMaskCopy(src - height * srcStride + widthA * N, srcStride, width - widthA, height, N, 
+                    mask - height * maskStride + widthA / 8, maskStride, dst - height * dstStride + widthA * N, dstStride);
+        }
+
+        void BitMaskCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
+            const uint8_t * mask, size_t maskStride, uint8_t * dst, size_t dstStride)
+        {
+            switch (pixelSize)
+            {
+            case 1: BitMaskCopy<1>(src, srcStride, width, height, mask, maskStride, dst, dstStride); break;
+            case 2: BitMaskCopy<2>(src, srcStride, width, height, mask, maskStride, dst, dstStride); break;
+            case 3: BitMaskCopy<3>(src, srcStride, width, height, mask, maskStride, dst, dstStride); break;
+            case 4: BitMaskCopy<4>(src, srcStride, width, height, mask, maskStride, dst, dstStride); break;
+            default:
+                Base::BitMaskCopy(src, srcStride, width, height, pixelSize, mask, maskStride, dst, dstStride);
+            }
+        }
+
+        template<size_t N> void BitMaskFill(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * pixel,
+            const uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+
+            BitMaskPixels<N> pixels;
+            uint8_t _value[N * A];
+            for (size_t i = 0; i < N * A; ++i)
+                _value[i] = pixel[i % N];
+            __m256i value[N];
+            for (size_t n = 0; n < N; ++n)
+                value[n] = _mm256_loadu_si256((__m256i*)_value + n);
+            size_t widthA = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                {
+                    __m256i _mask = _mm256_set1_epi32(*(uint32_t*)(mask + col / 8));
+                    uint8_t * d = dst + col * N;
+                    for (size_t n = 0; n < N; ++n)
+                    {
+                        __m256i _dst = _mm256_loadu_si256((__m256i*)d + n);
+                        _mm256_storeu_si256((__m256i*)d + n, _mm256_blendv_epi8(_dst, value[n], pixels.Mask(_mask, n)));
+                    }
+                }
+                mask += maskStride;
+                dst += dstStride;
+            }
+            if (widthA < width)
+                Base::BitMaskFill(dst - height * dstStride + widthA * N, dstStride, width - widthA, height, pixel, N, 
+                    mask - height * maskStride + widthA / 8, maskStride);
+        }
+
+        void BitMaskFill(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize,
+            const uint8_t * mask, size_t maskStride)
+        {
+            switch (pixelSize)
+            {
+            case 1: BitMaskFill<1>(dst, dstStride, width, height, pixel, mask, maskStride); break;
+            case 2: BitMaskFill<2>(dst, dstStride, width, height, pixel, mask, maskStride); break;
+            case 3: BitMaskFill<3>(dst, dstStride, width, height, pixel, mask, maskStride); break;
+            case 4: BitMaskFill<4>(dst, dstStride, width, height, pixel, mask, maskStride); break;
+            default:
+                Base::BitMaskFill(dst, dstStride, width, height, pixel, pixelSize, mask, maskStride);
+            }
+        }
+    }
+#endif
+}
@@ -0,0 +1,110 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdUnpack.h"
+#include "Simd/SimdAlphaBlending.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void HsvToBgr16(__m256i hue, __m256i min, __m256i value, __m256i & blue, __m256i & green, __m256i & red)
+        {
+            __m256i hue6 = _mm256_mullo_epi16(hue, K16_0006);
+            __m256i sector = Divide16uBy255(hue6);
+            __m256i delta = Divide16uBy255(_mm256_mullo_epi16(_mm256_sub_epi16(value, min), _mm256_sub_epi16(hue6, _mm256_mullo_epi16(sector, K16_00FF))));
+            __m256i up = _mm256_add_epi16(min, delta);
+            __m256i down = _mm256_sub_epi16(value, delta);
+            __m256i s1 = _mm256_cmpeq_epi16(sector, K16_0001);
+            __m256i s2 = _mm256_cmpeq_epi16(sector, K16_0002);
+            __m256i s3 = _mm256_cmpeq_epi16(sector, K16_0003);
+            __m256i s4 = _mm256_cmpeq_epi16(sector, K16_0004);
+            __m256i s5 = _mm256_cmpeq_epi16(sector, K16_0005);
+            blue = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_blendv_epi8(min, up, s2), value, _mm256_or_si256(s3, s4)), down, s5);
+            green = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_blendv_epi8(up, value, _mm256_or_si256(s1, s2)), down, s3), min, _mm256_or_si256(s4, s5));
+            red = _mm256_blendv_epi8(_mm256_blendv_epi8(_mm256_blendv_epi8(value, down, s1), min, _mm256_or_si256(s2, s3)), up, s4);
+        }
+
+        template<bool hsl> SIMD_INLINE void HsxToBgr16(__m256i hue, __m256i saturation, __m256i value, __m256i & blue, __m256i & green, __m256i & red)
+        {
+            if (hsl)
+            {
+                __m256i max = _mm256_add_epi16(value, Divide16uBy255(_mm256_mullo_epi16(_mm256_min_epi16(value, _mm256_sub_epi16(K16_00FF, value)), saturation)));
+                HsvToBgr16(hue, _mm256_sub_epi16(_mm256_slli_epi16(value, 1), max), max, blue, green, red);
+            }
+            else
+                HsvToBgr16(hue, Divide16uBy255(_mm256_mullo_epi16(_mm256_sub_epi16(K16_00FF, saturation), value)), value, blue, green, red);
+        }
+
+        template<bool hsl> SIMD_INLINE void HsxToBgr(const uint8_t * hsx, uint8_t * bgr)
+        {
+            __m256i _hsx[3];
+            _hsx[0] = _mm256_loadu_si256((__m256i*)hsx + 0);
+            _hsx[1] = _mm256_loadu_si256((__m256i*)hsx + 1);
+            _hsx[2] = _mm256_loadu_si256((__m256i*)hsx + 2);
+            __m256i hue = BgrToBlue(_hsx);
+            __m256i saturation = BgrToGreen(_hsx);
+            __m256i value = BgrToRed(_hsx);
+            __m256i b[2], g[2], r[2];
+            HsxToBgr16<hsl>(UnpackU8<0>(hue), UnpackU8<0>(saturation), UnpackU8<0>(value), b[0], g[0], r[0]);
+            HsxToBgr16<hsl>(UnpackU8<1>(hue), UnpackU8<1>(saturation), UnpackU8<1>(value), b[1], g[1], r[1]);
+            __m256i _b = _mm256_packus_epi16(b[0], b[1]);
+            __m256i _g = _mm256_packus_epi16(g[0], g[1]);
+            __m256i _r = _mm256_packus_epi16(r[0], r[1]);
+            _mm256_storeu_si256((__m256i*)bgr + 0, InterleaveBgr<0>(_b, _g, _r));
+            _mm256_storeu_si256((__m256i*)bgr + 1, InterleaveBgr<1>(_b, _g, _r));
+            _mm256_storeu_si256((__m256i*)bgr + 2, InterleaveBgr<2>(_b, _g, _r));
+        }
+
+        template<bool hsl> void HsxToBgr(const uint8_t * hsx, size_t width, size_t height, size_t hsxStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    HsxToBgr<hsl>(hsx + 3 * col, bgr + 3 * col);
+                if (width != alignedWidth)
+                    HsxToBgr<hsl>(hsx + 3 * (width - A), bgr + 3 * (width - A));
+                hsx += hsxStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<false>(hsv, width, height, hsvStride, bgr, bgrStride);
+        }
+
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+        {
+            HsxToBgr<true>(hsl, width, height, hslStride, bgr, bgrStride);
+        }
+    }
+#endif
+}
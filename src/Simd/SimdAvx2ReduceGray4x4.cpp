@@ -122,7 +122,21 @@ namespace Simd
             return PackI16ToU8(lo, hi);
         }
 
-        template <bool even> void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        template <bool max> SIMD_INLINE void StoreReduced(uint8_t * dst, __m256i value)
+        {
+            if (max)
+                value = _mm256_max_epu8(value, _mm256_loadu_si256((__m256i*)dst));
+            _mm256_storeu_si256((__m256i*)dst, value);
+        }
+
+        template <bool max> SIMD_INLINE void StoreReduced(uint8_t * dst, __m256i value, __m256i previous)
+        {
+            if (max)
+                value = _mm256_max_epu8(value, previous);
+            _mm256_storeu_si256((__m256i*)dst, value);
+        }
+
+        template <bool even, bool max> void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
         {
             assert((srcWidth + 1) / 2 == dstWidth && (srcHeight + 1) / 2 == dstHeight && srcWidth > DA);
@@ -167,12 +181,14 @@ namespace Simd
                 Store<false>((__m256i*)(buffer.src2 + dstWidth - HA), ReduceColTail<even>(src2 + srcTail));
                 Store<false>((__m256i*)(buffer.src3 + dstWidth - HA), ReduceColTail<even>(src3 + srcTail));
 
-                Store<false>((__m256i*)dst, ReduceRow8<true>(buffer, 0));
+                // The tail overlaps the body: it is merged with the values of dst saved before the body was stored.
+                __m256i tail = _mm256_loadu_si256((__m256i*)(dst + dstWidth - A));
+                StoreReduced<max>(dst, ReduceRow8<true>(buffer, 0));
                 for (size_t col = A; col < alignedDstWidth; col += A)
-                    Store<false>((__m256i*)(dst + col), ReduceRow8<true>(buffer, col));
+                    StoreReduced<max>(dst + col, ReduceRow8<true>(buffer, col));
 
                 if (alignedDstWidth != dstWidth)
-                    Store<false>((__m256i*)(dst + dstWidth - A), ReduceRow8<false>(buffer, dstWidth - A));
+                    StoreReduced<max>(dst + dstWidth - A, ReduceRow8<false>(buffer, dstWidth - A), tail);
 
                 Swap(buffer.src0, buffer.src2);
                 Swap(buffer.src1, buffer.src3);
@@ -183,9 +199,18 @@ namespace Simd
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
         {
             if (Aligned(srcWidth, 2))
-                ReduceGray4x4<true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ReduceGray4x4<true, false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+            else
+                ReduceGray4x4<false, false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        }
+
+        void ReduceGray4x4Max(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            if (Aligned(srcWidth, 2))
+                ReduceGray4x4<true, true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
             else
-                ReduceGray4x4<false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ReduceGray4x4<false, true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
         }
     }
 #endif// SIMD_AVX2_ENABLE
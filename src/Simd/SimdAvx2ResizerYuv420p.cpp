@@ -0,0 +1,46 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE
+    namespace Avx2
+    {
+        void* ResizerYuv420pInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method)
+        {
+            if (dstX < DA)
+                return Base::ResizerYuv420pInit(srcX, srcY, dstX, dstY, format, yuvType, method);
+            Base::ResizerYuv420p* resizer = new Base::ResizerYuv420p(srcX, srcY, dstX, dstY, format, yuvType, method,
+                ResizerInit, InterleaveUv, Nv12ToBgr, Nv12ToRgb, Nv12ToBgra, Nv12ToRgba);
+            if (resizer->Valid())
+                return resizer;
+            delete resizer;
+            return NULL;
+        }
+    }
+#endif
+}
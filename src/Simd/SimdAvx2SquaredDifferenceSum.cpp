@@ -131,6 +131,62 @@ namespace Simd
             else
                 SquaredDifferenceSumMasked<false>(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE void SquaredDifferenceSum(const __m256i & a, const uint8_t * b, __m256i & sum)
+        {
+            sum = _mm256_add_epi32(sum, SquaredDifference(a, Load<false>((__m256i*)b)));
+        }
+
+        SIMD_INLINE void SquaredDifferenceSum(const __m256i & a, const uint8_t * b, const __m256i & mask, __m256i & sum)
+        {
+            sum = _mm256_add_epi32(sum, SquaredDifference(a, _mm256_and_si256(mask, Load<false>((__m256i*)b))));
+        }
+
+        void SquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums)
+        {
+            assert(size >= A && size <= 0x10000);
+
+            size_t sizeA = AlignLo(size, A), count4 = AlignLo(count, 4), i = 0;
+            __m256i tailMask = SetMask<uint8_t>(0, A - size + sizeA, 0xFF);
+            for (; i < count4; i += 4, b += 4 * size)
+            {
+                const uint8_t * b0 = b, * b1 = b0 + size, * b2 = b1 + size, * b3 = b2 + size;
+                __m256i s0 = _mm256_setzero_si256(), s1 = _mm256_setzero_si256(), s2 = _mm256_setzero_si256(), s3 = _mm256_setzero_si256();
+                for (size_t j = 0; j < sizeA; j += A)
+                {
+                    __m256i _a = Load<false>((__m256i*)(a + j));
+                    SquaredDifferenceSum(_a, b0 + j, s0);
+                    SquaredDifferenceSum(_a, b1 + j, s1);
+                    SquaredDifferenceSum(_a, b2 + j, s2);
+                    SquaredDifferenceSum(_a, b3 + j, s3);
+                }
+                if (sizeA < size)
+                {
+                    size_t j = size - A;
+                    __m256i _a = _mm256_and_si256(tailMask, Load<false>((__m256i*)(a + j)));
+                    SquaredDifferenceSum(_a, b0 + j, tailMask, s0);
+                    SquaredDifferenceSum(_a, b1 + j, tailMask, s1);
+                    SquaredDifferenceSum(_a, b2 + j, tailMask, s2);
+                    SquaredDifferenceSum(_a, b3 + j, tailMask, s3);
+                }
+                __m256i s = _mm256_hadd_epi32(_mm256_hadd_epi32(s0, s1), _mm256_hadd_epi32(s2, s3));
+                _mm_storeu_si128((__m128i*)(sums + i), _mm_add_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1)));
+            }
+            for (; i < count; i += 1, b += size)
+            {
+                __m256i s0 = _mm256_setzero_si256();
+                for (size_t j = 0; j < sizeA; j += A)
+                    SquaredDifferenceSum(Load<false>((__m256i*)(a + j)), b + j, s0);
+                if (sizeA < size)
+                {
+                    size_t j = size - A;
+                    SquaredDifferenceSum(_mm256_and_si256(tailMask, Load<false>((__m256i*)(a + j))), b + j, tailMask, s0);
+                }
+                sums[i] = ExtractSum<uint32_t>(s0);
+            }
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
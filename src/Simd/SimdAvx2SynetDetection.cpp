@@ -0,0 +1,122 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdAvx2.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX2_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx2
+    {
+        SIMD_INLINE void Transpose4x4(__m256& a0, __m256& a1, __m256& a2, __m256& a3)
+        {
+            __m256 t0 = _mm256_unpacklo_ps(a0, a1);
+            __m256 t1 = _mm256_unpackhi_ps(a0, a1);
+            __m256 t2 = _mm256_unpacklo_ps(a2, a3);
+            __m256 t3 = _mm256_unpackhi_ps(a2, a3);
+            a0 = _mm256_shuffle_ps(t0, t2, 0x44);
+            a1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+            a2 = _mm256_shuffle_ps(t1, t3, 0x44);
+            a3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+        }
+
+        void SynetDetectionDecode32f(const float* loc, const float* anchor, const float* variance, size_t count, float* box)
+        {
+            size_t count8 = AlignLo(count, 8), i = 0;
+            __m256 v0 = _mm256_set1_ps(variance[0]), v1 = _mm256_set1_ps(variance[1]);
+            __m256 v2 = _mm256_set1_ps(variance[2]), v3 = _mm256_set1_ps(variance[3]);
+            __m256 half = _mm256_set1_ps(0.5f);
+            for (; i < count8; i += 8, loc += 32, anchor += 32, box += 32)
+            {
+                __m256 l0 = _mm256_loadu_ps(loc + 0), l1 = _mm256_loadu_ps(loc + 8), l2 = _mm256_loadu_ps(loc + 16), l3 = _mm256_loadu_ps(loc + 24);
+                Transpose4x4(l0, l1, l2, l3);
+                __m256 a0 = _mm256_loadu_ps(anchor + 0), a1 = _mm256_loadu_ps(anchor + 8), a2 = _mm256_loadu_ps(anchor + 16), a3 = _mm256_loadu_ps(anchor + 24);
+                Transpose4x4(a0, a1, a2, a3);
+                __m256 aw = _mm256_sub_ps(a2, a0), ah = _mm256_sub_ps(a3, a1);
+                __m256 cx = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(v0, l0), aw), _mm256_mul_ps(_mm256_add_ps(a0, a2), half));
+                __m256 cy = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(v1, l1), ah), _mm256_mul_ps(_mm256_add_ps(a1, a3), half));
+                __m256 hw = _mm256_mul_ps(_mm256_mul_ps(Exponent(_mm256_mul_ps(v2, l2)), aw), half);
+                __m256 hh = _mm256_mul_ps(_mm256_mul_ps(Exponent(_mm256_mul_ps(v3, l3)), ah), half);
+                __m256 b0 = _mm256_sub_ps(cx, hw), b1 = _mm256_sub_ps(cy, hh), b2 = _mm256_add_ps(cx, hw), b3 = _mm256_add_ps(cy, hh);
+                Transpose4x4(b0, b1, b2, b3);
+                _mm256_storeu_ps(box + 0, b0);
+                _mm256_storeu_ps(box + 8, b1);
+                _mm256_storeu_ps(box + 16, b2);
+                _mm256_storeu_ps(box + 24, b3);
+            }
+            for (; i < count; ++i, loc += 4, anchor += 4, box += 4)
+                Base::SynetDetectionDecodeBox(loc, anchor, variance, box);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t SynetDetectionFilter32f(const float* score, size_t size, float threshold, uint32_t* index)
+        {
+            size_t size32 = AlignLo(size, 32), i = 0, count = 0;
+            __m256 _threshold = _mm256_set1_ps(threshold);
+            for (; i < size32; i += 32)
+            {
+                uint32_t mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(score + i + 0), _threshold, _CMP_GT_OQ)) << 0;
+                mask |= _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(score + i + 8), _threshold, _CMP_GT_OQ)) << 8;
+                mask |= _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(score + i + 16), _threshold, _CMP_GT_OQ)) << 16;
+                mask |= _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(score + i + 24), _threshold, _CMP_GT_OQ)) << 24;
+                for (; mask; mask &= mask - 1)
+                    index[count++] = uint32_t(i + _tzcnt_u32(mask));
+            }
+            for (; i < size; ++i)
+                if (score[i] > threshold)
+                    index[count++] = (uint32_t)i;
+            return count;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static bool Overlapped(const float* box, float area, float label, float threshold, const float* kept, size_t stride, size_t size)
+        {
+            size_t size8 = AlignLo(size, 8), i = 0;
+            __m256 x0 = _mm256_set1_ps(box[0]), y0 = _mm256_set1_ps(box[1]), x1 = _mm256_set1_ps(box[2]), y1 = _mm256_set1_ps(box[3]);
+            __m256 _area = _mm256_set1_ps(area), _label = _mm256_set1_ps(label), _threshold = _mm256_set1_ps(threshold), zero = _mm256_setzero_ps();
+            for (; i < size8; i += 8)
+            {
+                __m256 w = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(x1, _mm256_loadu_ps(kept + 2 * stride + i)), _mm256_max_ps(x0, _mm256_loadu_ps(kept + 0 * stride + i))), zero);
+                __m256 h = _mm256_max_ps(_mm256_sub_ps(_mm256_min_ps(y1, _mm256_loadu_ps(kept + 3 * stride + i)), _mm256_max_ps(y0, _mm256_loadu_ps(kept + 1 * stride + i))), zero);
+                __m256 inter = _mm256_mul_ps(w, h);
+                __m256 _union = _mm256_sub_ps(_mm256_add_ps(_area, _mm256_loadu_ps(kept + 4 * stride + i)), inter);
+                __m256 overlapped = _mm256_cmp_ps(inter, _mm256_mul_ps(_threshold, _union), _CMP_GT_OQ);
+                __m256 same = _mm256_cmp_ps(_label, _mm256_loadu_ps(kept + 5 * stride + i), _CMP_EQ_OQ);
+                if (_mm256_movemask_ps(_mm256_and_ps(overlapped, same)))
+                    return true;
+            }
+            return Base::SynetDetectionOverlapped(box, area, label, threshold, kept, stride, i, size);
+        }
+
+        size_t SynetDetectionNms32f(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index)
+        {
+            return Base::SynetDetectionNms32fCommon(box, score, label, count, threshold, topK, index, Overlapped);
+        }
+    }
+#endif
+}
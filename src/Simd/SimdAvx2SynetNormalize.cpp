@@ -25,6 +25,8 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdExtract.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
 
 namespace Simd
 {
@@ -192,6 +194,314 @@ namespace Simd
             else
                 assert(0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdConvolutionActivationType type> SIMD_INLINE void SetActivationParams(const float* params, size_t c, __m256* _params)
+        {
+            if (type == SimdConvolutionActivationPrelu)
+                _params[0] = _mm256_set1_ps(params[c]);
+            else if (type != SimdConvolutionActivationIdentity && type != SimdConvolutionActivationRelu && type != SimdConvolutionActivationGelu)
+                _params[0] = _mm256_set1_ps(params[0]);
+            if (type == SimdConvolutionActivationRestrictRange || type == SimdConvolutionActivationHswish || type == SimdConvolutionActivationHardSigmoid)
+                _params[1] = _mm256_set1_ps(params[1]);
+        }
+
+        template<SimdConvolutionActivationType type> void NormalizeNchwV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            float eps, const float* params, float* buf, float* dst)
+        {
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(spatial * 2);
+                buf = _buf.data;
+            }
+            float* mean = buf, * norm = buf + spatial;
+            size_t spatialF = AlignLo(spatial, F);
+            float k = 1.0f / float(channels);
+            __m256 _k = _mm256_set1_ps(k), _eps = _mm256_set1_ps(eps), _1 = _mm256_set1_ps(1.0f);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                size_t s = 0;
+                for (; s < spatialF; s += F)
+                {
+                    _mm256_storeu_ps(mean + s, _mm256_setzero_ps());
+                    _mm256_storeu_ps(norm + s, _mm256_setzero_ps());
+                }
+                for (; s < spatial; ++s)
+                    mean[s] = 0.0f, norm[s] = 0.0f;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                        _mm256_storeu_ps(mean + s, _mm256_add_ps(_mm256_loadu_ps(mean + s), _mm256_loadu_ps(ps + s)));
+                    for (; s < spatial; ++s)
+                        mean[s] += ps[s];
+                }
+                for (s = 0; s < spatialF; s += F)
+                    _mm256_storeu_ps(mean + s, _mm256_mul_ps(_mm256_loadu_ps(mean + s), _k));
+                for (; s < spatial; ++s)
+                    mean[s] *= k;
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                    {
+                        __m256 _d = _mm256_sub_ps(_mm256_loadu_ps(ps + s), _mm256_loadu_ps(mean + s));
+                        _mm256_storeu_ps(norm + s, _mm256_fmadd_ps(_d, _d, _mm256_loadu_ps(norm + s)));
+                    }
+                    for (; s < spatial; ++s)
+                        norm[s] += Simd::Square(ps[s] - mean[s]);
+                }
+                for (s = 0; s < spatialF; s += F)
+                    _mm256_storeu_ps(norm + s, _mm256_div_ps(_1, _mm256_sqrt_ps(_mm256_fmadd_ps(_mm256_loadu_ps(norm + s), _k, _eps))));
+                for (; s < spatial; ++s)
+                    norm[s] = 1.0f / ::sqrt(norm[s] * k + eps);
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    float* pd = dst + c * spatial;
+                    __m256 _scale = _mm256_set1_ps(scale[c]), _shift = _mm256_set1_ps(shift[c]);
+                    __m256 _params[2];
+                    SetActivationParams<type>(params, c, _params);
+                    for (s = 0; s < spatialF; s += F)
+                    {
+                        __m256 _d = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(ps + s), _mm256_loadu_ps(mean + s)), _mm256_loadu_ps(norm + s));
+                        _mm256_storeu_ps(pd + s, Activate<type>(_mm256_fmadd_ps(_d, _scale, _shift), _params, 0));
+                    }
+                    for (; s < spatial; ++s)
+                        pd[s] = Base::Activate<type>((ps[s] - mean[s]) * norm[s] * scale[c] + shift[c], params, c);
+                }
+                src += channels * spatial;
+                dst += channels * spatial;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void NormalizeNhwcV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            float eps, const float* params, float* dst)
+        {
+            size_t channelsF = AlignLo(channels, F);
+            float k = 1.0f / float(channels);
+            for (size_t i = 0, n = batch * spatial; i < n; ++i)
+            {
+                __m256 _sum = _mm256_setzero_ps();
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                    _sum = _mm256_add_ps(_sum, _mm256_loadu_ps(src + c));
+                float sum = Avx::ExtractSum(_sum);
+                for (; c < channels; ++c)
+                    sum += src[c];
+                float mean = sum * k;
+                __m256 _mean = _mm256_set1_ps(mean);
+                _sum = _mm256_setzero_ps();
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m256 _d = _mm256_sub_ps(_mm256_loadu_ps(src + c), _mean);
+                    _sum = _mm256_fmadd_ps(_d, _d, _sum);
+                }
+                sum = Avx::ExtractSum(_sum);
+                for (; c < channels; ++c)
+                    sum += Simd::Square(src[c] - mean);
+                float norm = 1.0f / ::sqrt(sum * k + eps);
+                __m256 _norm = _mm256_set1_ps(norm);
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m256 _d = _mm256_mul_ps(_mm256_sub_ps(_mm256_loadu_ps(src + c), _mean), _norm);
+                    _mm256_storeu_ps(dst + c, Activate<type>(_mm256_fmadd_ps(_d, _mm256_loadu_ps(scale + c), _mm256_loadu_ps(shift + c)), params, c));
+                }
+                for (; c < channels; ++c)
+                    dst[c] = Base::Activate<type>((src[c] - mean) * norm * scale[c] + shift[c], params, c);
+                src += channels;
+                dst += channels;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void NormalizeV2(const float* src, size_t batch, size_t channels, size_t spatial, 
+            const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, const float* params, float* buf, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                NormalizeNchwV2<type>(src, batch, channels, spatial, scale, shift, eps[0], params, buf, dst);
+            else if (format == SimdTensorFormatNhwc)
+                NormalizeNhwcV2<type>(src, batch, channels, spatial, scale, shift, eps[0], params, dst);
+            else
+                assert(0);
+        }
+
+        void SynetNormalizeLayerForwardV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: NormalizeV2<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRelu: NormalizeV2<SimdConvolutionActivationRelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationLeakyRelu: NormalizeV2<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRestrictRange: NormalizeV2<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationPrelu: NormalizeV2<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationElu: NormalizeV2<SimdConvolutionActivationElu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHswish: NormalizeV2<SimdConvolutionActivationHswish>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationMish: NormalizeV2<SimdConvolutionActivationMish>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHardSigmoid: NormalizeV2<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationSwish: NormalizeV2<SimdConvolutionActivationSwish>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationGelu: NormalizeV2<SimdConvolutionActivationGelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdConvolutionActivationType type> void NormalizeV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, 
+            const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, const float* params, float* buf, float* dst)
+        {
+            assert(channels % group == 0 && (format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc));
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(channels * 2);
+                buf = _buf.data;
+            }
+            float* alpha = buf, * beta = buf + channels;
+            size_t size = channels / group, channelsF = AlignLo(channels, F), spatialF = AlignLo(spatial, F);
+            float _eps = eps[0], k = 1.0f / float(size * spatial);
+            bool nchw = format == SimdTensorFormatNchw;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    alpha[c] = 0.0f;
+                if (nchw)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        __m256 _sum = _mm256_setzero_ps();
+                        size_t s = 0;
+                        for (; s < spatialF; s += F)
+                            _sum = _mm256_add_ps(_sum, _mm256_loadu_ps(ps + s));
+                        float sum = Avx::ExtractSum(_sum);
+                        for (; s < spatial; ++s)
+                            sum += ps[s];
+                        alpha[c] = sum;
+                    }
+                }
+                else
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        const float* ps = src + s * channels;
+                        size_t c = 0;
+                        for (; c < channelsF; c += F)
+                            _mm256_storeu_ps(alpha + c, _mm256_add_ps(_mm256_loadu_ps(alpha + c), _mm256_loadu_ps(ps + c)));
+                        for (; c < channels; ++c)
+                            alpha[c] += ps[c];
+                    }
+                }
+                for (size_t g = 0; g < group; ++g)
+                {
+                    float sum = 0.0f;
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                        sum += alpha[c];
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                        beta[c] = sum * k, alpha[c] = 0.0f;
+                }
+                if (nchw)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        __m256 _mean = _mm256_set1_ps(beta[c]), _sum = _mm256_setzero_ps();
+                        size_t s = 0;
+                        for (; s < spatialF; s += F)
+                        {
+                            __m256 _d = _mm256_sub_ps(_mm256_loadu_ps(ps + s), _mean);
+                            _sum = _mm256_fmadd_ps(_d, _d, _sum);
+                        }
+                        float sum = Avx::ExtractSum(_sum);
+                        for (; s < spatial; ++s)
+                            sum += Simd::Square(ps[s] - beta[c]);
+                        alpha[c] = sum;
+                    }
+                }
+                else
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        const float* ps = src + s * channels;
+                        size_t c = 0;
+                        for (; c < channelsF; c += F)
+                        {
+                            __m256 _d = _mm256_sub_ps(_mm256_loadu_ps(ps + c), _mm256_loadu_ps(beta + c));
+                            _mm256_storeu_ps(alpha + c, _mm256_fmadd_ps(_d, _d, _mm256_loadu_ps(alpha + c)));
+                        }
+                        for (; c < channels; ++c)
+                            alpha[c] += Simd::Square(ps[c] - beta[c]);
+                    }
+                }
+                for (size_t g = 0; g < group; ++g)
+                {
+                    float sum = 0.0f;
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                        sum += alpha[c];
+                    float norm = 1.0f / ::sqrt(sum * k + _eps);
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                    {
+                        alpha[c] = scale[c] * norm;
+                        beta[c] = shift[c] - beta[c] * alpha[c];
+                    }
+                }
+                if (nchw)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        float* pd = dst + c * spatial;
+                        __m256 _alpha = _mm256_set1_ps(alpha[c]), _beta = _mm256_set1_ps(beta[c]);
+                        __m256 _params[2];
+                        SetActivationParams<type>(params, c, _params);
+                        size_t s = 0;
+                        for (; s < spatialF; s += F)
+                            _mm256_storeu_ps(pd + s, Activate<type>(_mm256_fmadd_ps(_mm256_loadu_ps(ps + s), _alpha, _beta), _params, 0));
+                        for (; s < spatial; ++s)
+                            pd[s] = Base::Activate<type>(ps[s] * alpha[c] + beta[c], params, c);
+                    }
+                }
+                else
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        const float* ps = src + s * channels;
+                        float* pd = dst + s * channels;
+                        size_t c = 0;
+                        for (; c < channelsF; c += F)
+                            _mm256_storeu_ps(pd + c, Activate<type>(_mm256_fmadd_ps(_mm256_loadu_ps(ps + c), _mm256_loadu_ps(alpha + c), _mm256_loadu_ps(beta + c)), params, c));
+                        for (; c < channels; ++c)
+                            pd[c] = Base::Activate<type>(ps[c] * alpha[c] + beta[c], params, c);
+                    }
+                }
+                src += channels * spatial;
+                dst += channels * spatial;
+            }
+        }
+
+        void SynetNormalizeLayerForwardV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: NormalizeV3<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRelu: NormalizeV3<SimdConvolutionActivationRelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationLeakyRelu: NormalizeV3<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRestrictRange: NormalizeV3<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationPrelu: NormalizeV3<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationElu: NormalizeV3<SimdConvolutionActivationElu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHswish: NormalizeV3<SimdConvolutionActivationHswish>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationMish: NormalizeV3<SimdConvolutionActivationMish>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHardSigmoid: NormalizeV3<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationSwish: NormalizeV3<SimdConvolutionActivationSwish>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationGelu: NormalizeV3<SimdConvolutionActivationGelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            default:
+                assert(0);
+            }
+        }
     }
 #endif
 }
@@ -26,6 +26,7 @@
 #include "Simd/SimdSse41.h"
 #include "Simd/SimdAvx1.h"
 #include "Simd/SimdAvx2.h"
+#include "Simd/SimdSynetPooling32f.h"
 
 namespace Simd
 {
@@ -597,6 +598,26 @@ namespace Simd
             else
                 assert(0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetPooling32f::SynetPooling32f(const Base::Pooling32fParam& param)
+            : Sse41::SynetPooling32f(param)
+        {
+            _poolingMax = _block < F ? Sse41::SynetPoolingMax32f : Avx2::SynetPoolingMax32f;
+            _poolingAverage = Avx::SynetPoolingAverage;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX,
+            size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format)
+        {
+            Base::Pooling32fParam param(batch, channels, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dstH, dstW, method, excludePad, format);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPooling32f(param);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 }
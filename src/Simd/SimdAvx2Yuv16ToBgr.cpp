@@ -0,0 +1,316 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        const __m256i K8_SHUFFLE_P010_U = SIMD_MM256_SETR_EPI8(
+            0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD,
+            0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD);
+        const __m256i K8_SHUFFLE_P010_V = SIMD_MM256_SETR_EPI8(
+            0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF,
+            0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF);
+
+        template <class T, int part> SIMD_INLINE void Yuv10ToBgr32(__m256i y, __m256i u, __m256i v, __m256i& b, __m256i& g, __m256i& r)
+        {
+            static const __m256i YA_UB = SIMD_MM256_SET2_EPI16(T::Y_2_A, T::U_2_B);
+            static const __m256i YA_UG = SIMD_MM256_SET2_EPI16(T::Y_2_A, T::U_2_G);
+            static const __m256i VG_0 = SIMD_MM256_SET2_EPI16(T::V_2_G, 0);
+            static const __m256i YA_VR = SIMD_MM256_SET2_EPI16(T::Y_2_A, T::V_2_R);
+            __m256i yu = UnpackU16<part>(y, u);
+            b = _mm256_madd_epi16(yu, YA_UB);
+            g = _mm256_add_epi32(_mm256_madd_epi16(yu, YA_UG), _mm256_madd_epi16(UnpackU16<part>(v, K_ZERO), VG_0));
+            r = _mm256_madd_epi16(UnpackU16<part>(y, v), YA_VR);
+        }
+
+        template <class T> SIMD_INLINE __m256i Yuv10ToI16(__m256i lo, __m256i hi)
+        {
+            static const __m256i ROUND = SIMD_MM256_SET1_EPI32(4 * T::F_ROUND);
+            return _mm256_packs_epi32(_mm256_srai_epi32(_mm256_add_epi32(lo, ROUND), T::F_SHIFT + 2), _mm256_srai_epi32(_mm256_add_epi32(hi, ROUND), T::F_SHIFT + 2));
+        }
+
+        template <class T> SIMD_INLINE void Yuv10ToBgr16(__m256i y, __m256i u, __m256i v, __m256i& b, __m256i& g, __m256i& r)
+        {
+            __m256i b0, g0, r0, b1, g1, r1;
+            Yuv10ToBgr32<T, 0>(y, u, v, b0, g0, r0);
+            Yuv10ToBgr32<T, 1>(y, u, v, b1, g1, r1);
+            b = Yuv10ToI16<T>(b0, b1);
+            g = Yuv10ToI16<T>(g0, g1);
+            r = Yuv10ToI16<T>(r0, r1);
+        }
+
+        template <class T> SIMD_INLINE __m256i LoadY10(const __m256i* y, __m128i shift)
+        {
+            static const __m256i Y_LO = SIMD_MM256_SET1_EPI16(4 * T::Y_LO);
+            return _mm256_sub_epi16(_mm256_srl_epi16(_mm256_loadu_si256(y), shift), Y_LO);
+        }
+
+        template <class T> SIMD_INLINE __m256i UnpackUV10(__m256i uv, __m128i shift)
+        {
+            static const __m256i UV_Z = SIMD_MM256_SET1_EPI16(4 * T::UV_Z);
+            return _mm256_sub_epi16(_mm256_srl_epi16(uv, shift), UV_Z);
+        }
+
+        template <bool align, class T, size_t N> SIMD_INLINE void Yuv10ToBgr(const uint8_t* y, __m128i shift, const __m256i* u, const __m256i* v, __m256i a, uint8_t* dst)
+        {
+            __m256i b0, g0, r0, b1, g1, r1;
+            Yuv10ToBgr16<T>(LoadY10<T>((__m256i*)y + 0, shift), u[0], v[0], b0, g0, r0);
+            Yuv10ToBgr16<T>(LoadY10<T>((__m256i*)y + 1, shift), u[1], v[1], b1, g1, r1);
+            StoreBgrOrBgra<align, N>(PackI16ToU8(b0, b1), PackI16ToU8(g0, g1), PackI16ToU8(r0, r1), a, dst);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool align, class T, size_t N> SIMD_INLINE void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, __m128i shift, __m256i a, uint8_t* dst, size_t dstStride)
+        {
+            __m256i u[2], v[2];
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m256i _uv = _mm256_loadu_si256((__m256i*)uv + i);
+                u[i] = UnpackUV10<T>(_mm256_shuffle_epi8(_uv, K8_SHUFFLE_P010_U), shift);
+                v[i] = UnpackUV10<T>(_mm256_shuffle_epi8(_uv, K8_SHUFFLE_P010_V), shift);
+            }
+            Yuv10ToBgr<align, T, N>(y, shift, u, v, a, dst);
+            Yuv10ToBgr<align, T, N>(y + yStride, shift, u, v, a, dst + dstStride);
+        }
+
+        template <bool align, class T, size_t N> void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2));
+            if (align)
+                assert(Aligned(dst) && Aligned(dstStride));
+
+            __m256i a = _mm256_set1_epi8(alpha);
+            __m128i shift = _mm_cvtsi32_si128(6);
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    P010ToBgr<align, T, N>(y + col * 2, yStride, uv + col * 2, shift, a, dst + col * N, dstStride);
+                if (widthA != width)
+                    P010ToBgr<false, T, N>(y + tail * 2, yStride, uv + tail * 2, shift, a, dst + tail * N, dstStride);
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, size_t N> void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P010ToBgr<align, Base::Bt601, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: P010ToBgr<align, Base::Bt709, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: P010ToBgr<align, Base::Bt2020, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: P010ToBgr<align, Base::Trect871, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <size_t N> void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(dst) && Aligned(dstStride))
+                P010ToBgr<true, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+            else
+                P010ToBgr<false, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+        }
+
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            P010ToBgr<3>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void P010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            P010ToBgr<4>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool align, class T, size_t N> SIMD_INLINE void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, 
+            const uint8_t* v, __m128i shift, __m256i a, uint8_t* dst, size_t dstStride)
+        {
+            __m256i _u[2], _v[2];
+            __m256i u8 = _mm256_permute4x64_epi64(_mm256_loadu_si256((__m256i*)u), 0xD8);
+            _u[0] = UnpackUV10<T>(_mm256_unpacklo_epi16(u8, u8), shift);
+            _u[1] = UnpackUV10<T>(_mm256_unpackhi_epi16(u8, u8), shift);
+            __m256i v8 = _mm256_permute4x64_epi64(_mm256_loadu_si256((__m256i*)v), 0xD8);
+            _v[0] = UnpackUV10<T>(_mm256_unpacklo_epi16(v8, v8), shift);
+            _v[1] = UnpackUV10<T>(_mm256_unpackhi_epi16(v8, v8), shift);
+            Yuv10ToBgr<align, T, N>(y, shift, _u, _v, a, dst);
+            Yuv10ToBgr<align, T, N>(y + yStride, shift, _u, _v, a, dst + dstStride);
+        }
+
+        template <bool align, class T, size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= A) && (height >= 2) && (bitDepth >= 10) && (bitDepth <= 16));
+            if (align)
+                assert(Aligned(dst) && Aligned(dstStride));
+
+            __m256i a = _mm256_set1_epi8(alpha);
+            __m128i shift = _mm_cvtsi32_si128(int(bitDepth) - 10);
+            size_t widthA = AlignLo(width, A), tail = width - A;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t col = 0; col < widthA; col += A)
+                    Yuv420p16ToBgr<align, T, N>(y + col * 2, yStride, u + col, v + col, shift, a, dst + col * N, dstStride);
+                if (widthA != width)
+                    Yuv420p16ToBgr<false, T, N>(y + tail * 2, yStride, u + tail, v + tail, shift, a, dst + tail * N, dstStride);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420p16ToBgr<align, Base::Bt601, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Yuv420p16ToBgr<align, Base::Bt709, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Yuv420p16ToBgr<align, Base::Bt2020, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Yuv420p16ToBgr<align, Base::Trect871, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(dst) && Aligned(dstStride))
+                Yuv420p16ToBgr<true, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha, yuvType);
+            else
+                Yuv420p16ToBgr<false, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha, yuvType);
+        }
+
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv420p16ToBgr<3>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv420p16ToBgr<4>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T> struct P010ToPlanar32fParams
+        {
+            __m256i max;
+            __m256 scale[3], shift[3];
+
+            P010ToPlanar32fParams(const float* lower, const float* upper)
+            {
+                max = _mm256_set1_epi32(255 * 4 * T::F_RANGE);
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    scale[c] = _mm256_set1_ps((upper[c] - lower[c]) / float(255 * 4 * T::F_RANGE));
+                    shift[c] = _mm256_set1_ps(lower[c]);
+                }
+            }
+        };
+
+        SIMD_INLINE void StorePlanar32f(__m256i value, __m256i max, __m256 scale, __m256 shift, float* dst)
+        {
+            __m256 _value = _mm256_cvtepi32_ps(_mm256_min_epi32(_mm256_max_epi32(value, K_ZERO), max));
+            _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_mul_ps(_value, scale), shift));
+        }
+
+        template <class T> SIMD_INLINE void P010ToPlanar32f(const uint8_t* y, const uint8_t* uv, const P010ToPlanar32fParams<T>& p, size_t ib, size_t ir, float* b, float* g, float* r)
+        {
+            static const __m256i Y_2_A = SIMD_MM256_SET1_EPI32(T::Y_2_A);
+            static const __m256i U_2_B = SIMD_MM256_SET1_EPI32(T::U_2_B);
+            static const __m256i U_2_G = SIMD_MM256_SET1_EPI32(T::U_2_G);
+            static const __m256i V_2_G = SIMD_MM256_SET1_EPI32(T::V_2_G);
+            static const __m256i V_2_R = SIMD_MM256_SET1_EPI32(T::V_2_R);
+            static const __m256i Y_LO = SIMD_MM256_SET1_EPI32(4 * T::Y_LO);
+            static const __m256i UV_Z = SIMD_MM256_SET1_EPI32(4 * T::UV_Z);
+            __m256i _y = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)y)), 6), Y_LO);
+            __m256i _uv = _mm256_sub_epi32(_mm256_srli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((__m128i*)uv)), 6), UV_Z);
+            __m256i _u = _mm256_shuffle_epi32(_uv, 0xA0);
+            __m256i _v = _mm256_shuffle_epi32(_uv, 0xF5);
+            __m256i _ya = _mm256_mullo_epi32(_y, Y_2_A);
+            StorePlanar32f(_mm256_add_epi32(_ya, _mm256_mullo_epi32(_u, U_2_B)), p.max, p.scale[ib], p.shift[ib], b);
+            StorePlanar32f(_mm256_add_epi32(_ya, _mm256_add_epi32(_mm256_mullo_epi32(_u, U_2_G), _mm256_mullo_epi32(_v, V_2_G))), p.max, p.scale[1], p.shift[1], g);
+            StorePlanar32f(_mm256_add_epi32(_ya, _mm256_mullo_epi32(_v, V_2_R)), p.max, p.scale[ir], p.shift[ir], r);
+        }
+
+        template <class T> void P010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, const float* lower, const float* upper, float* dst, SimdBool rgb)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= F) && (height >= 2));
+
+            P010ToPlanar32fParams<T> params(lower, upper);
+            size_t size = width * height, ib = rgb ? 2 : 0, ir = rgb ? 0 : 2;
+            float* b = dst + ib * size, * g = dst + size, * r = dst + ir * size;
+            size_t widthF = AlignLo(width, F), tail = width - F;
+            for (size_t row = 0; row < height; row += 1)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    P010ToPlanar32f<T>(y + col * 2, uv + col * 2, params, ib, ir, b + col, g + col, r + col);
+                if (widthF != width)
+                    P010ToPlanar32f<T>(y + tail * 2, uv + tail * 2, params, ib, ir, b + tail, g + tail, r + tail);
+                y += yStride;
+                if (row & 1)
+                    uv += uvStride;
+                b += width;
+                g += width;
+                r += width;
+            }
+        }
+
+        void P010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            const float* lower, const float* upper, float* dst, SimdBool rgb, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P010ToPlanar32f<Base::Bt601>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            case SimdYuvBt709: P010ToPlanar32f<Base::Bt709>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            case SimdYuvBt2020: P010ToPlanar32f<Base::Bt2020>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            case SimdYuvTrect871: P010ToPlanar32f<Base::Trect871>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
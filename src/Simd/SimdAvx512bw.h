@@ -49,6 +49,10 @@ namespace Simd
         void AddFeatureDifference(const uint8_t * value, size_t valueStride, size_t width, size_t height,
             const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride, uint16_t weight, uint8_t * difference, size_t differenceStride);
 
+        void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+            uint8_t * difference, size_t differenceStride);
+
         void AlphaBlending(const uint8_t *src, size_t srcStride, size_t width, size_t height, size_t channelCount,
             const uint8_t *alpha, size_t alphaStride, uint8_t *dst, size_t dstStride);
 
@@ -386,12 +390,27 @@ namespace Simd
 
         void NeuralUpdateWeights(const float* x, size_t size, const float* a, const float* b, float* d, float* w);
 
+        void Nv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Nv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Nv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Nv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
         void OperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
             size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
 
         void OperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
             size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
 
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void P010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void P010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            const float* lower, const float* upper, float* dst, SimdBool rgb, SimdYuvType yuvType);
+
         void VectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height);
 
         void ReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
@@ -406,6 +425,9 @@ namespace Simd
         void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
 
+        void ReduceGray4x4Max(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
         void ReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
 
@@ -465,6 +487,8 @@ namespace Simd
         void SquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
             const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
 
+        void SquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums);
+
         void SquaredDifferenceSum32f(const float* a, const float* b, size_t size, float* sum);
 
         void SquaredDifferenceKahanSum32f(const float* a, const float* b, size_t size, float* sum);
@@ -512,6 +536,12 @@ namespace Simd
         void SynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format,
             const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
 
+        void SynetDetectionDecode32f(const float* loc, const float* anchor, const float* variance, size_t count, float* box);
+
+        size_t SynetDetectionFilter32f(const float* score, size_t size, float threshold, uint32_t* index);
+
+        size_t SynetDetectionNms32f(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index);
+
         void SynetEltwiseLayerForward(float const* const* src, const float* weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float* dst);
 
         void SynetElu32f(const float* src, size_t size, const float* alpha, float* dst);
@@ -530,6 +560,8 @@ namespace Simd
 
         void SynetFusedLayerForward9(const float* src0, const float* src1, const float* scale, const float* bias, size_t channels0, size_t channels1, size_t spatial, float* dst0, float* dst1, SimdTensorFormatType format);
 
+        void SynetGelu32f(const float* src, size_t size, float* dst);
+
         void SynetHardSigmoid32f(const float* src, size_t size, const float* scale, const float* shift, float* dst);
 
         void SynetHswish32f(const float* src, size_t size, const float* shift, const float* scale, float* dst);
@@ -545,6 +577,12 @@ namespace Simd
         void SynetNormalizeLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale,
             const float* eps, SimdBool acrossSpatial, SimdTensorFormatType format, float* buf, float* dst);
 
+        void SynetNormalizeLayerForwardV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+        void SynetNormalizeLayerForwardV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
         void SynetPoolingAverage(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
 
@@ -659,6 +697,12 @@ namespace Simd
         void Yuva444pToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             const uint8_t* a, size_t aStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, SimdYuvType yuvType);
 
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Yuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
         void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
@@ -100,6 +100,61 @@ namespace Simd
             else
                 AddFeatureDifference<false>(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
         }
+
+        template <bool align, bool tail> SIMD_INLINE void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi,
+            size_t offset, const uint16_t * weight, size_t count, const uint8_t * mask, uint8_t * difference, __mmask64 m = -1)
+        {
+            __m512i sum = _mm512_setzero_si512();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const __m512i _value = Load<align, tail>(value[i] + offset, m);
+                const __m512i _lo = Load<align, tail>(lo[i] + offset, m);
+                const __m512i _hi = Load<align, tail>(hi[i] + offset, m);
+                const __m512i featureDifference = FeatureDifference(_value, _lo, _hi);
+                sum = _mm512_adds_epu8(sum, ShiftedWeightedSquare8(featureDifference, _mm512_set1_epi16((short)weight[i])));
+            }
+            if (mask)
+                sum = _mm512_and_si512(sum, Load<align, tail>(mask, m));
+            Store<align, tail>(difference, sum, m);
+        }
+
+        template <bool align> void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+            uint8_t * difference, size_t differenceStride)
+        {
+            size_t alignedWidth = AlignLo(width, A);
+            __mmask64 tailMask = __mmask64(-1) >> (A + alignedWidth - width);
+            for (size_t row = 0, offset = 0; row < height; ++row, offset += stride)
+            {
+                size_t col = 0;
+                for (; col < alignedWidth; col += A)
+                    FeatureDifferenceSum<align, false>(value, lo, hi, offset + col, weight, count, mask ? mask + col : NULL, difference + col);
+                if (col < width)
+                    FeatureDifferenceSum<align, true>(value, lo, hi, offset + col, weight, count, mask ? mask + col : NULL, difference + col, tailMask);
+                if (mask)
+                    mask += maskStride;
+                difference += differenceStride;
+            }
+        }
+
+        bool FeatureDifferenceSumAligned(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            size_t count, const uint8_t * mask, size_t maskStride, uint8_t * difference, size_t differenceStride)
+        {
+            bool aligned = Aligned(stride) && Aligned(difference) && Aligned(differenceStride) && (mask == NULL || (Aligned(mask) && Aligned(maskStride)));
+            for (size_t i = 0; i < count && aligned; ++i)
+                aligned = Aligned(value[i]) && Aligned(lo[i]) && Aligned(hi[i]);
+            return aligned;
+        }
+
+        void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+            uint8_t * difference, size_t differenceStride)
+        {
+            if (FeatureDifferenceSumAligned(value, lo, hi, stride, count, mask, maskStride, difference, differenceStride))
+                FeatureDifferenceSum<true>(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+            else
+                FeatureDifferenceSum<false>(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
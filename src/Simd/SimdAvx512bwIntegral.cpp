@@ -92,6 +92,14 @@ namespace Simd
                         IntegralSumSqsumTilted<uint32_t, double>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
                         break;
+                    case SimdPixelFormatInt64:
+                        IntegralSumSqsumTilted<uint32_t, uint64_t>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
+                        break;
+                    case SimdPixelFormatFloat:
+                        IntegralSumSqsumTilted<uint32_t, float>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (float*)sqsum, sqsumStride / sizeof(float), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
+                        break;
                     default:
                         assert(0);
                     }
@@ -108,6 +116,14 @@ namespace Simd
                         IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double));
                         break;
+                    case SimdPixelFormatInt64:
+                        IntegralSumSqsum<uint32_t, uint64_t>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t));
+                        break;
+                    case SimdPixelFormatFloat:
+                        IntegralSumSqsum<uint32_t, float>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (float*)sqsum, sqsumStride / sizeof(float));
+                        break;
                     default:
                         assert(0);
                     }
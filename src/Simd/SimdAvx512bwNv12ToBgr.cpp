@@ -0,0 +1,145 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdYuvToBgr.h"
+#include "Simd/SimdInterleave.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K8_SHUFFLE_NV12_U = SIMD_MM512_SETR_EPI8(
+            0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE,
+            0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE,
+            0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE,
+            0x0, 0x0, 0x2, 0x2, 0x4, 0x4, 0x6, 0x6, 0x8, 0x8, 0xA, 0xA, 0xC, 0xC, 0xE, 0xE);
+        const __m512i K8_SHUFFLE_NV12_V = SIMD_MM512_SETR_EPI8(
+            0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF,
+            0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF,
+            0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF,
+            0x1, 0x1, 0x3, 0x3, 0x5, 0x5, 0x7, 0x7, 0x9, 0x9, 0xB, 0xB, 0xD, 0xD, 0xF, 0xF);
+
+        template <bool align, bool mask, class T, size_t N, bool bgr> SIMD_INLINE void Nv12ToPixel(const uint8_t* y,
+            __m512i u, __m512i v, __m512i a, uint8_t* dst, const __mmask64* tails)
+        {
+            __m512i _y = Load<align, mask>(y, tails[0]);
+            __m512i blue = YuvToBlue<T>(_y, u);
+            __m512i green = YuvToGreen<T>(_y, u, v);
+            __m512i red = YuvToRed<T>(_y, v);
+            if (bgr)
+                StoreBgrOrBgra<align, mask, N>(blue, green, red, a, dst, tails + 1);
+            else
+                StoreBgrOrBgra<align, mask, N>(red, green, blue, a, dst, tails + 1);
+        }
+
+        template <bool align, bool mask, class T, size_t N, bool bgr> SIMD_INLINE void Nv12ToPixel(const uint8_t* y, size_t yStride,
+            const uint8_t* uv, __m512i a, uint8_t* dst, size_t dstStride, const __mmask64* tails)
+        {
+            __m512i _uv = Load<align, mask>(uv, tails[0]);
+            __m512i u = _mm512_shuffle_epi8(_uv, K8_SHUFFLE_NV12_U);
+            __m512i v = _mm512_shuffle_epi8(_uv, K8_SHUFFLE_NV12_V);
+            Nv12ToPixel<align, mask, T, N, bgr>(y, u, v, a, dst, tails);
+            Nv12ToPixel<align, mask, T, N, bgr>(y + yStride, u, v, a, dst + dstStride, tails);
+        }
+
+        template <bool align, class T, size_t N, bool bgr> void Nv12ToPixel(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride));
+
+            __m512i a = _mm512_set1_epi8(alpha);
+            size_t widthA = AlignLo(width, A);
+            __mmask64 tails[5], nose[5];
+            for (size_t i = 0; i < 5; ++i)
+                nose[i] = __mmask64(-1);
+            tails[0] = TailMask64(width - widthA);
+            for (size_t i = 0; i < N; ++i)
+                tails[1 + i] = TailMask64((width - widthA) * N - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    Nv12ToPixel<align, false, T, N, bgr>(y + col, yStride, uv + col, a, dst + col * N, dstStride, nose);
+                if (col < width)
+                    Nv12ToPixel<align, true, T, N, bgr>(y + col, yStride, uv + col, a, dst + col * N, dstStride, tails);
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, size_t N, bool bgr> void Nv12ToPixel(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToPixel<align, Base::Bt601, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Nv12ToPixel<align, Base::Bt709, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToPixel<align, Base::Bt2020, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToPixel<align, Base::Trect871, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <size_t N, bool bgr> void Nv12ToPixel(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(uv) && Aligned(uvStride) && Aligned(dst) && Aligned(dstStride))
+                Nv12ToPixel<true, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+            else
+                Nv12ToPixel<false, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+        }
+
+        void Nv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToPixel<3, true>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToPixel<4, true>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToPixel<3, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToPixel<4, false>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+        }
+    }
+#endif
+}
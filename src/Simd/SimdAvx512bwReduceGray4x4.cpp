@@ -100,12 +100,26 @@ namespace Simd
                 DivideBy64(BinomialSum16(hi[0], hi[1], hi[2], hi[3]))));
         }
 
-        template <bool even> void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        template <bool max> SIMD_INLINE void StoreReduced(uint8_t * dst, __m512i value)
+        {
+            if (max)
+                value = _mm512_max_epu8(value, Load<false>(dst));
+            Store<false>(dst, value);
+        }
+
+        template <bool max> SIMD_INLINE void StoreReduced(uint8_t * dst, __m512i value, __m512i previous)
+        {
+            if (max)
+                value = _mm512_max_epu8(value, previous);
+            Store<false>(dst, value);
+        }
+
+        template <bool even, bool max> void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
         {
             assert((srcWidth + 1) / 2 == dstWidth && (srcHeight + 1) / 2 == dstHeight && srcWidth > DA);
 
-            size_t bodyWidth = AlignLo(srcWidth, DA);
+            size_t bodyWidth = AlignLo(srcWidth - 1, DA);
             size_t srcTail = Simd::AlignHi(srcWidth - DA, 2);
 
             for (size_t row = 0; row < srcHeight; row += 2, dst += dstStride)
@@ -116,19 +130,21 @@ namespace Simd
                 s[2] = s[1] + (row < srcHeight - 1 ? srcStride : 0);
                 s[3] = s[2] + (row < srcHeight - 2 ? srcStride : 0);
 
+                // The tail overlaps the body: it is merged with the values of dst saved before the body was stored.
+                __m512i tail = Load<false>(dst + dstWidth - A);
                 __m512i lo[4], hi[4];
                 ReduceColNose(s, lo);
                 ReduceColBody(s, A, hi);
-                Store<false>(dst, ReduceRow(lo, hi));
+                StoreReduced<max>(dst, ReduceRow(lo, hi));
                 for (size_t srcCol = DA, dstCol = A; srcCol < bodyWidth; srcCol += DA, dstCol += A)
                 {
                     ReduceColBody(s, srcCol + 0, lo);
                     ReduceColBody(s, srcCol + A, hi);
-                    Store<false>(dst + dstCol, ReduceRow(lo, hi));
+                    StoreReduced<max>(dst + dstCol, ReduceRow(lo, hi));
                 }
                 ReduceColBody(s, srcTail + 0, lo);
                 ReduceColTail<even>(s, srcTail + A, hi);
-                Store<false>(dst + dstWidth - A, ReduceRow(lo, hi));
+                StoreReduced<max>(dst + dstWidth - A, ReduceRow(lo, hi), tail);
             }
         }
 
@@ -136,9 +152,18 @@ namespace Simd
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
         {
             if (Aligned(srcWidth, 2))
-                ReduceGray4x4<true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ReduceGray4x4<true, false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+            else
+                ReduceGray4x4<false, false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        }
+
+        void ReduceGray4x4Max(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            if (Aligned(srcWidth, 2))
+                ReduceGray4x4<true, true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
             else
-                ReduceGray4x4<false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ReduceGray4x4<false, true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
         }
     }
 #endif// SIMD_AVX512BW_ENABLE
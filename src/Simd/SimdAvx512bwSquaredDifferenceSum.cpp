@@ -101,6 +101,60 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        template<bool masked> SIMD_INLINE void SquaredDifferenceSum(const __m512i & a, const uint8_t * b, __m512i & sum, __mmask64 tail = -1)
+        {
+            sum = _mm512_add_epi32(sum, SquaredDifference(a, Load<false, masked>(b, tail)));
+        }
+
+        SIMD_INLINE __m256i Reduce256(const __m512i & a)
+        {
+            return _mm256_add_epi32(_mm512_castsi512_si256(a), _mm512_extracti64x4_epi64(a, 1));
+        }
+
+        void SquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums)
+        {
+            assert(size <= 0x10000);
+
+            size_t sizeA = AlignLo(size, A), count4 = AlignLo(count, 4), i = 0;
+            __mmask64 tailMask = TailMask64(size - sizeA);
+            for (; i < count4; i += 4, b += 4 * size)
+            {
+                const uint8_t * b0 = b, * b1 = b0 + size, * b2 = b1 + size, * b3 = b2 + size;
+                __m512i s0 = _mm512_setzero_si512(), s1 = _mm512_setzero_si512(), s2 = _mm512_setzero_si512(), s3 = _mm512_setzero_si512();
+                size_t j = 0;
+                for (; j < sizeA; j += A)
+                {
+                    __m512i _a = Load<false>(a + j);
+                    SquaredDifferenceSum<false>(_a, b0 + j, s0);
+                    SquaredDifferenceSum<false>(_a, b1 + j, s1);
+                    SquaredDifferenceSum<false>(_a, b2 + j, s2);
+                    SquaredDifferenceSum<false>(_a, b3 + j, s3);
+                }
+                if (j < size)
+                {
+                    __m512i _a = Load<false, true>(a + j, tailMask);
+                    SquaredDifferenceSum<true>(_a, b0 + j, s0, tailMask);
+                    SquaredDifferenceSum<true>(_a, b1 + j, s1, tailMask);
+                    SquaredDifferenceSum<true>(_a, b2 + j, s2, tailMask);
+                    SquaredDifferenceSum<true>(_a, b3 + j, s3, tailMask);
+                }
+                __m256i s = _mm256_hadd_epi32(_mm256_hadd_epi32(Reduce256(s0), Reduce256(s1)), _mm256_hadd_epi32(Reduce256(s2), Reduce256(s3)));
+                _mm_storeu_si128((__m128i*)(sums + i), _mm_add_epi32(_mm256_castsi256_si128(s), _mm256_extracti128_si256(s, 1)));
+            }
+            for (; i < count; i += 1, b += size)
+            {
+                __m512i s0 = _mm512_setzero_si512();
+                size_t j = 0;
+                for (; j < sizeA; j += A)
+                    SquaredDifferenceSum<false>(Load<false>(a + j), b + j, s0);
+                if (j < size)
+                    SquaredDifferenceSum<true>(Load<false, true>(a + j, tailMask), b + j, s0, tailMask);
+                sums[i] = ExtractSum<uint32_t>(s0);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         template <bool align, bool masked> SIMD_INLINE void SquaredDifferenceSumMasked(const uint8_t * a, const uint8_t * b, const uint8_t * m, const __m512i & index, __m512i * sums, __mmask64 tail)
         {
             const __mmask64 mask = _mm512_cmpeq_epi8_mask((Load<align, masked>(m, tail)), index) & tail;
@@ -34,6 +34,7 @@
 #include "Simd/SimdPow.h"
 #include "Simd/SimdInterleave.h"
 #include "Simd/SimdDeinterleave.h"
+#include "Simd/SimdSynetSoftmax32f.h"
 
 namespace Simd
 {
@@ -1390,6 +1391,21 @@ namespace Simd
             else
                 SynetUnaryOperation32fLayerForward<false>(src, size, type, dst);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetSoftmax32f::SynetSoftmax32f(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+            : Avx2::SynetSoftmax32f(outer, count, inner, format)
+        {
+            _softmax = Avx512bw::SynetSoftmaxLayerForward;
+        }
+
+        void* SynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+        {
+            if (outer == 0 || count == 0 || inner == 0 || Base::SynetSoftmax32fBlock(count, format) == 0)
+                return NULL;
+            return new SynetSoftmax32f(outer, count, inner, format);
+        }
     }
 #endif
 }
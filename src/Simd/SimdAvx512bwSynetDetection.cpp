@@ -0,0 +1,125 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Avx512bw
+    {
+        SIMD_INLINE void Transpose4x4(__m512& a0, __m512& a1, __m512& a2, __m512& a3)
+        {
+            __m512 t0 = _mm512_unpacklo_ps(a0, a1);
+            __m512 t1 = _mm512_unpackhi_ps(a0, a1);
+            __m512 t2 = _mm512_unpacklo_ps(a2, a3);
+            __m512 t3 = _mm512_unpackhi_ps(a2, a3);
+            a0 = _mm512_shuffle_ps(t0, t2, 0x44);
+            a1 = _mm512_shuffle_ps(t0, t2, 0xEE);
+            a2 = _mm512_shuffle_ps(t1, t3, 0x44);
+            a3 = _mm512_shuffle_ps(t1, t3, 0xEE);
+        }
+
+        void SynetDetectionDecode32f(const float* loc, const float* anchor, const float* variance, size_t count, float* box)
+        {
+            size_t count16 = AlignLo(count, 16), i = 0;
+            __m512 v0 = _mm512_set1_ps(variance[0]), v1 = _mm512_set1_ps(variance[1]);
+            __m512 v2 = _mm512_set1_ps(variance[2]), v3 = _mm512_set1_ps(variance[3]);
+            __m512 half = _mm512_set1_ps(0.5f);
+            for (; i < count16; i += 16, loc += 64, anchor += 64, box += 64)
+            {
+                __m512 l0 = _mm512_loadu_ps(loc + 0), l1 = _mm512_loadu_ps(loc + 16), l2 = _mm512_loadu_ps(loc + 32), l3 = _mm512_loadu_ps(loc + 48);
+                Transpose4x4(l0, l1, l2, l3);
+                __m512 a0 = _mm512_loadu_ps(anchor + 0), a1 = _mm512_loadu_ps(anchor + 16), a2 = _mm512_loadu_ps(anchor + 32), a3 = _mm512_loadu_ps(anchor + 48);
+                Transpose4x4(a0, a1, a2, a3);
+                __m512 aw = _mm512_sub_ps(a2, a0), ah = _mm512_sub_ps(a3, a1);
+                __m512 cx = _mm512_add_ps(_mm512_mul_ps(_mm512_mul_ps(v0, l0), aw), _mm512_mul_ps(_mm512_add_ps(a0, a2), half));
+                __m512 cy = _mm512_add_ps(_mm512_mul_ps(_mm512_mul_ps(v1, l1), ah), _mm512_mul_ps(_mm512_add_ps(a1, a3), half));
+                __m512 hw = _mm512_mul_ps(_mm512_mul_ps(Exponent(_mm512_mul_ps(v2, l2)), aw), half);
+                __m512 hh = _mm512_mul_ps(_mm512_mul_ps(Exponent(_mm512_mul_ps(v3, l3)), ah), half);
+                __m512 b0 = _mm512_sub_ps(cx, hw), b1 = _mm512_sub_ps(cy, hh), b2 = _mm512_add_ps(cx, hw), b3 = _mm512_add_ps(cy, hh);
+                Transpose4x4(b0, b1, b2, b3);
+                _mm512_storeu_ps(box + 0, b0);
+                _mm512_storeu_ps(box + 16, b1);
+                _mm512_storeu_ps(box + 32, b2);
+                _mm512_storeu_ps(box + 48, b3);
+            }
+            for (; i < count; ++i, loc += 4, anchor += 4, box += 4)
+                Base::SynetDetectionDecodeBox(loc, anchor, variance, box);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t SynetDetectionFilter32f(const float* score, size_t size, float threshold, uint32_t* index)
+        {
+            size_t size16 = AlignLo(size, 16), i = 0, count = 0;
+            __m512 _threshold = _mm512_set1_ps(threshold);
+            __m512i _index = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+            __m512i _step = _mm512_set1_epi32(16);
+            for (; i < size16; i += 16)
+            {
+                __mmask16 mask = _mm512_cmp_ps_mask(_mm512_loadu_ps(score + i), _threshold, _CMP_GT_OQ);
+                _mm512_mask_compressstoreu_epi32(index + count, mask, _index);
+                count += _mm_popcnt_u32(mask);
+                _index = _mm512_add_epi32(_index, _step);
+            }
+            if (i < size)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __mmask16 mask = _mm512_mask_cmp_ps_mask(tail, _mm512_maskz_loadu_ps(tail, score + i), _threshold, _CMP_GT_OQ);
+                _mm512_mask_compressstoreu_epi32(index + count, mask, _index);
+                count += _mm_popcnt_u32(mask);
+            }
+            return count;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static bool Overlapped(const float* box, float area, float label, float threshold, const float* kept, size_t stride, size_t size)
+        {
+            __m512 x0 = _mm512_set1_ps(box[0]), y0 = _mm512_set1_ps(box[1]), x1 = _mm512_set1_ps(box[2]), y1 = _mm512_set1_ps(box[3]);
+            __m512 _area = _mm512_set1_ps(area), _label = _mm512_set1_ps(label), _threshold = _mm512_set1_ps(threshold), zero = _mm512_setzero_ps();
+            for (size_t i = 0; i < size; i += 16)
+            {
+                __mmask16 tail = TailMask16(size - i);
+                __m512 w = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(x1, _mm512_maskz_loadu_ps(tail, kept + 2 * stride + i)), _mm512_max_ps(x0, _mm512_maskz_loadu_ps(tail, kept + 0 * stride + i))), zero);
+                __m512 h = _mm512_max_ps(_mm512_sub_ps(_mm512_min_ps(y1, _mm512_maskz_loadu_ps(tail, kept + 3 * stride + i)), _mm512_max_ps(y0, _mm512_maskz_loadu_ps(tail, kept + 1 * stride + i))), zero);
+                __m512 inter = _mm512_mul_ps(w, h);
+                __m512 _union = _mm512_sub_ps(_mm512_add_ps(_area, _mm512_maskz_loadu_ps(tail, kept + 4 * stride + i)), inter);
+                __mmask16 same = _mm512_mask_cmp_ps_mask(tail, _label, _mm512_maskz_loadu_ps(tail, kept + 5 * stride + i), _CMP_EQ_OQ);
+                if (_mm512_mask_cmp_ps_mask(same, inter, _mm512_mul_ps(_threshold, _union), _CMP_GT_OQ))
+                    return true;
+            }
+            return false;
+        }
+
+        size_t SynetDetectionNms32f(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index)
+        {
+            return Base::SynetDetectionNms32fCommon(box, score, label, count, threshold, topK, index, Overlapped);
+        }
+    }
+#endif
+}
@@ -25,6 +25,8 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdExtract.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
 
 namespace Simd
 {
@@ -207,6 +209,333 @@ namespace Simd
             else
                 assert(0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdConvolutionActivationType type> SIMD_INLINE void SetActivationParams(const float* params, size_t c, __m512* _params)
+        {
+            if (type == SimdConvolutionActivationPrelu)
+                _params[0] = _mm512_set1_ps(params[c]);
+            else if (type != SimdConvolutionActivationIdentity && type != SimdConvolutionActivationRelu && type != SimdConvolutionActivationGelu)
+                _params[0] = _mm512_set1_ps(params[0]);
+            if (type == SimdConvolutionActivationRestrictRange || type == SimdConvolutionActivationHswish || type == SimdConvolutionActivationHardSigmoid)
+                _params[1] = _mm512_set1_ps(params[1]);
+        }
+
+        template<SimdConvolutionActivationType type> void NormalizeNchwV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            float eps, const float* params, float* buf, float* dst)
+        {
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(spatial * 2);
+                buf = _buf.data;
+            }
+            float* mean = buf, * norm = buf + spatial;
+            size_t spatialF = AlignLo(spatial, F);
+            __mmask16 spatialM = TailMask16(spatial - spatialF);
+            __m512 _k = _mm512_set1_ps(1.0f / float(channels)), _eps = _mm512_set1_ps(eps), _1 = _mm512_set1_ps(1.0f);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                size_t s = 0;
+                for (; s < spatialF; s += F)
+                {
+                    _mm512_storeu_ps(mean + s, _mm512_setzero_ps());
+                    _mm512_storeu_ps(norm + s, _mm512_setzero_ps());
+                }
+                if (s < spatial)
+                {
+                    _mm512_mask_storeu_ps(mean + s, spatialM, _mm512_setzero_ps());
+                    _mm512_mask_storeu_ps(norm + s, spatialM, _mm512_setzero_ps());
+                }
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                        _mm512_storeu_ps(mean + s, _mm512_add_ps(_mm512_loadu_ps(mean + s), _mm512_loadu_ps(ps + s)));
+                    if (s < spatial)
+                        _mm512_mask_storeu_ps(mean + s, spatialM, _mm512_add_ps(_mm512_maskz_loadu_ps(spatialM, mean + s), _mm512_maskz_loadu_ps(spatialM, ps + s)));
+                }
+                for (s = 0; s < spatialF; s += F)
+                    _mm512_storeu_ps(mean + s, _mm512_mul_ps(_mm512_loadu_ps(mean + s), _k));
+                if (s < spatial)
+                    _mm512_mask_storeu_ps(mean + s, spatialM, _mm512_mul_ps(_mm512_maskz_loadu_ps(spatialM, mean + s), _k));
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    for (s = 0; s < spatialF; s += F)
+                    {
+                        __m512 _d = _mm512_sub_ps(_mm512_loadu_ps(ps + s), _mm512_loadu_ps(mean + s));
+                        _mm512_storeu_ps(norm + s, _mm512_fmadd_ps(_d, _d, _mm512_loadu_ps(norm + s)));
+                    }
+                    if (s < spatial)
+                    {
+                        __m512 _d = _mm512_sub_ps(_mm512_maskz_loadu_ps(spatialM, ps + s), _mm512_maskz_loadu_ps(spatialM, mean + s));
+                        _mm512_mask_storeu_ps(norm + s, spatialM, _mm512_fmadd_ps(_d, _d, _mm512_maskz_loadu_ps(spatialM, norm + s)));
+                    }
+                }
+                for (s = 0; s < spatialF; s += F)
+                    _mm512_storeu_ps(norm + s, _mm512_div_ps(_1, _mm512_sqrt_ps(_mm512_fmadd_ps(_mm512_loadu_ps(norm + s), _k, _eps))));
+                if (s < spatial)
+                    _mm512_mask_storeu_ps(norm + s, spatialM, _mm512_div_ps(_1, _mm512_sqrt_ps(_mm512_fmadd_ps(_mm512_maskz_loadu_ps(spatialM, norm + s), _k, _eps))));
+                for (size_t c = 0; c < channels; ++c)
+                {
+                    const float* ps = src + c * spatial;
+                    float* pd = dst + c * spatial;
+                    __m512 _scale = _mm512_set1_ps(scale[c]), _shift = _mm512_set1_ps(shift[c]);
+                    __m512 _params[2];
+                    SetActivationParams<type>(params, c, _params);
+                    for (s = 0; s < spatialF; s += F)
+                    {
+                        __m512 _d = _mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(ps + s), _mm512_loadu_ps(mean + s)), _mm512_loadu_ps(norm + s));
+                        _mm512_storeu_ps(pd + s, Activate<type>(_mm512_fmadd_ps(_d, _scale, _shift), _params, 0));
+                    }
+                    if (s < spatial)
+                    {
+                        __m512 _d = _mm512_mul_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(spatialM, ps + s), 
+                            _mm512_maskz_loadu_ps(spatialM, mean + s)), _mm512_maskz_loadu_ps(spatialM, norm + s));
+                        _mm512_mask_storeu_ps(pd + s, spatialM, Activate<type>(_mm512_fmadd_ps(_d, _scale, _shift), _params, 0));
+                    }
+                }
+                src += channels * spatial;
+                dst += channels * spatial;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void NormalizeNhwcV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            float eps, const float* params, float* dst)
+        {
+            size_t channelsF = AlignLo(channels, F);
+            __mmask16 channelsM = TailMask16(channels - channelsF);
+            float k = 1.0f / float(channels);
+            for (size_t i = 0, n = batch * spatial; i < n; ++i)
+            {
+                __m512 _sum = _mm512_setzero_ps();
+                size_t c = 0;
+                for (; c < channelsF; c += F)
+                    _sum = _mm512_add_ps(_sum, _mm512_loadu_ps(src + c));
+                if (c < channels)
+                    _sum = _mm512_add_ps(_sum, _mm512_maskz_loadu_ps(channelsM, src + c));
+                __m512 _mean = _mm512_set1_ps(ExtractSum(_sum) * k);
+                _sum = _mm512_setzero_ps();
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m512 _d = _mm512_sub_ps(_mm512_loadu_ps(src + c), _mean);
+                    _sum = _mm512_fmadd_ps(_d, _d, _sum);
+                }
+                if (c < channels)
+                {
+                    __m512 _d = _mm512_maskz_sub_ps(channelsM, _mm512_maskz_loadu_ps(channelsM, src + c), _mean);
+                    _sum = _mm512_fmadd_ps(_d, _d, _sum);
+                }
+                __m512 _norm = _mm512_set1_ps(1.0f / ::sqrt(ExtractSum(_sum) * k + eps));
+                for (c = 0; c < channelsF; c += F)
+                {
+                    __m512 _d = _mm512_mul_ps(_mm512_sub_ps(_mm512_loadu_ps(src + c), _mean), _norm);
+                    _mm512_storeu_ps(dst + c, Activate<type>(_mm512_fmadd_ps(_d, _mm512_loadu_ps(scale + c), _mm512_loadu_ps(shift + c)), params, c));
+                }
+                if (c < channels)
+                {
+                    __m512 _d = _mm512_mul_ps(_mm512_sub_ps(_mm512_maskz_loadu_ps(channelsM, src + c), _mean), _norm);
+                    _mm512_mask_storeu_ps(dst + c, channelsM, Activate<type>(_mm512_fmadd_ps(_d, _mm512_maskz_loadu_ps(channelsM, scale + c), _mm512_maskz_loadu_ps(channelsM, shift + c)), params, c, channelsM));
+                }
+                src += channels;
+                dst += channels;
+            }
+        }
+
+        template<SimdConvolutionActivationType type> void NormalizeV2(const float* src, size_t batch, size_t channels, size_t spatial, 
+            const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, const float* params, float* buf, float* dst)
+        {
+            if (format == SimdTensorFormatNchw)
+                NormalizeNchwV2<type>(src, batch, channels, spatial, scale, shift, eps[0], params, buf, dst);
+            else if (format == SimdTensorFormatNhwc)
+                NormalizeNhwcV2<type>(src, batch, channels, spatial, scale, shift, eps[0], params, dst);
+            else
+                assert(0);
+        }
+
+        void SynetNormalizeLayerForwardV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: NormalizeV2<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRelu: NormalizeV2<SimdConvolutionActivationRelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationLeakyRelu: NormalizeV2<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRestrictRange: NormalizeV2<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationPrelu: NormalizeV2<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationElu: NormalizeV2<SimdConvolutionActivationElu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHswish: NormalizeV2<SimdConvolutionActivationHswish>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationMish: NormalizeV2<SimdConvolutionActivationMish>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHardSigmoid: NormalizeV2<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationSwish: NormalizeV2<SimdConvolutionActivationSwish>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationGelu: NormalizeV2<SimdConvolutionActivationGelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdConvolutionActivationType type> void NormalizeV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, 
+            const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, const float* params, float* buf, float* dst)
+        {
+            assert(channels % group == 0 && (format == SimdTensorFormatNchw || format == SimdTensorFormatNhwc));
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(channels * 2);
+                buf = _buf.data;
+            }
+            float* alpha = buf, * beta = buf + channels;
+            size_t size = channels / group, channelsF = AlignLo(channels, F), spatialF = AlignLo(spatial, F);
+            __mmask16 channelsM = TailMask16(channels - channelsF), spatialM = TailMask16(spatial - spatialF);
+            float _eps = eps[0], k = 1.0f / float(size * spatial);
+            bool nchw = format == SimdTensorFormatNchw;
+            for (size_t b = 0; b < batch; ++b)
+            {
+                for (size_t c = 0; c < channels; ++c)
+                    alpha[c] = 0.0f;
+                if (nchw)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        __m512 _sum = _mm512_setzero_ps();
+                        size_t s = 0;
+                        for (; s < spatialF; s += F)
+                            _sum = _mm512_add_ps(_sum, _mm512_loadu_ps(ps + s));
+                        if (s < spatial)
+                            _sum = _mm512_add_ps(_sum, _mm512_maskz_loadu_ps(spatialM, ps + s));
+                        alpha[c] = ExtractSum(_sum);
+                    }
+                }
+                else
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        const float* ps = src + s * channels;
+                        size_t c = 0;
+                        for (; c < channelsF; c += F)
+                            _mm512_storeu_ps(alpha + c, _mm512_add_ps(_mm512_loadu_ps(alpha + c), _mm512_loadu_ps(ps + c)));
+                        if (c < channels)
+                            _mm512_mask_storeu_ps(alpha + c, channelsM, _mm512_add_ps(_mm512_maskz_loadu_ps(channelsM, alpha + c), _mm512_maskz_loadu_ps(channelsM, ps + c)));
+                    }
+                }
+                for (size_t g = 0; g < group; ++g)
+                {
+                    float sum = 0.0f;
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                        sum += alpha[c];
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                        beta[c] = sum * k, alpha[c] = 0.0f;
+                }
+                if (nchw)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        __m512 _mean = _mm512_set1_ps(beta[c]), _sum = _mm512_setzero_ps();
+                        size_t s = 0;
+                        for (; s < spatialF; s += F)
+                        {
+                            __m512 _d = _mm512_sub_ps(_mm512_loadu_ps(ps + s), _mean);
+                            _sum = _mm512_fmadd_ps(_d, _d, _sum);
+                        }
+                        if (s < spatial)
+                        {
+                            __m512 _d = _mm512_maskz_sub_ps(spatialM, _mm512_maskz_loadu_ps(spatialM, ps + s), _mean);
+                            _sum = _mm512_fmadd_ps(_d, _d, _sum);
+                        }
+                        alpha[c] = ExtractSum(_sum);
+                    }
+                }
+                else
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        const float* ps = src + s * channels;
+                        size_t c = 0;
+                        for (; c < channelsF; c += F)
+                        {
+                            __m512 _d = _mm512_sub_ps(_mm512_loadu_ps(ps + c), _mm512_loadu_ps(beta + c));
+                            _mm512_storeu_ps(alpha + c, _mm512_fmadd_ps(_d, _d, _mm512_loadu_ps(alpha + c)));
+                        }
+                        if (c < channels)
+                        {
+                            __m512 _d = _mm512_sub_ps(_mm512_maskz_loadu_ps(channelsM, ps + c), _mm512_maskz_loadu_ps(channelsM, beta + c));
+                            _mm512_mask_storeu_ps(alpha + c, channelsM, _mm512_fmadd_ps(_d, _d, _mm512_maskz_loadu_ps(channelsM, alpha + c)));
+                        }
+                    }
+                }
+                for (size_t g = 0; g < group; ++g)
+                {
+                    float sum = 0.0f;
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                        sum += alpha[c];
+                    float norm = 1.0f / ::sqrt(sum * k + _eps);
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                    {
+                        alpha[c] = scale[c] * norm;
+                        beta[c] = shift[c] - beta[c] * alpha[c];
+                    }
+                }
+                if (nchw)
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                    {
+                        const float* ps = src + c * spatial;
+                        float* pd = dst + c * spatial;
+                        __m512 _alpha = _mm512_set1_ps(alpha[c]), _beta = _mm512_set1_ps(beta[c]);
+                        __m512 _params[2];
+                        SetActivationParams<type>(params, c, _params);
+                        size_t s = 0;
+                        for (; s < spatialF; s += F)
+                            _mm512_storeu_ps(pd + s, Activate<type>(_mm512_fmadd_ps(_mm512_loadu_ps(ps + s), _alpha, _beta), _params, 0));
+                        if (s < spatial)
+                            _mm512_mask_storeu_ps(pd + s, spatialM, Activate<type>(_mm512_fmadd_ps(_mm512_maskz_loadu_ps(spatialM, ps + s), _alpha, _beta), _params, 0));
+                    }
+                }
+                else
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        const float* ps = src + s * channels;
+                        float* pd = dst + s * channels;
+                        size_t c = 0;
+                        for (; c < channelsF; c += F)
+                            _mm512_storeu_ps(pd + c, Activate<type>(_mm512_fmadd_ps(_mm512_loadu_ps(ps + c), _mm512_loadu_ps(alpha + c), _mm512_loadu_ps(beta + c)), params, c));
+                        if (c < channels)
+                            _mm512_mask_storeu_ps(pd + c, channelsM, Activate<type>(_mm512_fmadd_ps(_mm512_maskz_loadu_ps(channelsM, ps + c), 
+                                _mm512_maskz_loadu_ps(channelsM, alpha + c), _mm512_maskz_loadu_ps(channelsM, beta + c)), params, c, channelsM));
+                    }
+                }
+                src += channels * spatial;
+                dst += channels * spatial;
+            }
+        }
+
+        void SynetNormalizeLayerForwardV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: NormalizeV3<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRelu: NormalizeV3<SimdConvolutionActivationRelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationLeakyRelu: NormalizeV3<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRestrictRange: NormalizeV3<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationPrelu: NormalizeV3<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationElu: NormalizeV3<SimdConvolutionActivationElu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHswish: NormalizeV3<SimdConvolutionActivationHswish>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationMish: NormalizeV3<SimdConvolutionActivationMish>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHardSigmoid: NormalizeV3<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationSwish: NormalizeV3<SimdConvolutionActivationSwish>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationGelu: NormalizeV3<SimdConvolutionActivationGelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            default:
+                assert(0);
+            }
+        }
     }
 #endif
 }
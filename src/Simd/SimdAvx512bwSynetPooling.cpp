@@ -28,6 +28,7 @@
 #include "Simd/SimdAvx1.h"
 #include "Simd/SimdAvx2.h"
 #include "Simd/SimdAvx512bw.h"
+#include "Simd/SimdSynetPooling32f.h"
 
 namespace Simd
 {
@@ -774,6 +775,26 @@ namespace Simd
             else
                 assert(0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetPooling32f::SynetPooling32f(const Base::Pooling32fParam& param)
+            : Avx2::SynetPooling32f(param)
+        {
+            _poolingMax = Avx512bw::SynetPoolingMax32f;
+            _poolingAverage = Avx512bw::SynetPoolingAverage;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX,
+            size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format)
+        {
+            Base::Pooling32fParam param(batch, channels, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dstH, dstW, method, excludePad, format);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPooling32f(param);
+        }
     }
 #endif// SIMD_AVX512BW_ENABLE
 }
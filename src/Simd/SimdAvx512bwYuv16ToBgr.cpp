@@ -0,0 +1,335 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        const __m512i K8_SHUFFLE_P010_U = SIMD_MM512_SETR_EPI8(
+            0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD,
+            0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD,
+            0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD,
+            0x0, 0x1, 0x0, 0x1, 0x4, 0x5, 0x4, 0x5, 0x8, 0x9, 0x8, 0x9, 0xC, 0xD, 0xC, 0xD);
+        const __m512i K8_SHUFFLE_P010_V = SIMD_MM512_SETR_EPI8(
+            0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF,
+            0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF,
+            0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF,
+            0x2, 0x3, 0x2, 0x3, 0x6, 0x7, 0x6, 0x7, 0xA, 0xB, 0xA, 0xB, 0xE, 0xF, 0xE, 0xF);
+
+        template <class T, int part> SIMD_INLINE void Yuv10ToBgr32(__m512i y, __m512i u, __m512i v, __m512i& b, __m512i& g, __m512i& r)
+        {
+            static const __m512i YA_UB = SIMD_MM512_SET2_EPI16(T::Y_2_A, T::U_2_B);
+            static const __m512i YA_UG = SIMD_MM512_SET2_EPI16(T::Y_2_A, T::U_2_G);
+            static const __m512i VG_0 = SIMD_MM512_SET2_EPI16(T::V_2_G, 0);
+            static const __m512i YA_VR = SIMD_MM512_SET2_EPI16(T::Y_2_A, T::V_2_R);
+            __m512i yu = UnpackU16<part>(y, u);
+            b = _mm512_madd_epi16(yu, YA_UB);
+            g = _mm512_add_epi32(_mm512_madd_epi16(yu, YA_UG), _mm512_madd_epi16(UnpackU16<part>(v, K_ZERO), VG_0));
+            r = _mm512_madd_epi16(UnpackU16<part>(y, v), YA_VR);
+        }
+
+        template <class T> SIMD_INLINE __m512i Yuv10ToI16(__m512i lo, __m512i hi)
+        {
+            static const __m512i ROUND = SIMD_MM512_SET1_EPI32(4 * T::F_ROUND);
+            return _mm512_packs_epi32(_mm512_srai_epi32(_mm512_add_epi32(lo, ROUND), T::F_SHIFT + 2), _mm512_srai_epi32(_mm512_add_epi32(hi, ROUND), T::F_SHIFT + 2));
+        }
+
+        template <class T> SIMD_INLINE void Yuv10ToBgr16(__m512i y, __m512i u, __m512i v, __m512i& b, __m512i& g, __m512i& r)
+        {
+            __m512i b0, g0, r0, b1, g1, r1;
+            Yuv10ToBgr32<T, 0>(y, u, v, b0, g0, r0);
+            Yuv10ToBgr32<T, 1>(y, u, v, b1, g1, r1);
+            b = Yuv10ToI16<T>(b0, b1);
+            g = Yuv10ToI16<T>(g0, g1);
+            r = Yuv10ToI16<T>(r0, r1);
+        }
+
+        template <class T> SIMD_INLINE __m512i UnpackYuv10(__m512i value, __m128i shift, __m512i zero)
+        {
+            return _mm512_sub_epi16(_mm512_srl_epi16(value, shift), zero);
+        }
+
+        template <bool align, bool mask, class T, size_t N> SIMD_INLINE void Yuv10ToBgr(const uint8_t* y, __m128i shift, 
+            const __m512i* u, const __m512i* v, __m512i a, uint8_t* dst, const __mmask64* tails)
+        {
+            static const __m512i Y_LO = SIMD_MM512_SET1_EPI16(4 * T::Y_LO);
+            __m512i b0, g0, r0, b1, g1, r1;
+            Yuv10ToBgr16<T>(UnpackYuv10<T>(Load<false, mask>(y + 0 * A, tails[0]), shift, Y_LO), u[0], v[0], b0, g0, r0);
+            Yuv10ToBgr16<T>(UnpackYuv10<T>(Load<false, mask>(y + 1 * A, tails[1]), shift, Y_LO), u[1], v[1], b1, g1, r1);
+            StoreBgrOrBgra<align, mask, N>(PackI16ToU8(b0, b1), PackI16ToU8(g0, g1), PackI16ToU8(r0, r1), a, dst, tails + 3);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool align, bool mask, class T, size_t N> SIMD_INLINE void P010ToBgr(const uint8_t* y, size_t yStride, 
+            const uint8_t* uv, __m128i shift, __m512i a, uint8_t* dst, size_t dstStride, const __mmask64* tails)
+        {
+            static const __m512i UV_Z = SIMD_MM512_SET1_EPI16(4 * T::UV_Z);
+            __m512i u[2], v[2];
+            for (size_t i = 0; i < 2; ++i)
+            {
+                __m512i _uv = Load<false, mask>(uv + i * A, tails[i]);
+                u[i] = UnpackYuv10<T>(_mm512_shuffle_epi8(_uv, K8_SHUFFLE_P010_U), shift, UV_Z);
+                v[i] = UnpackYuv10<T>(_mm512_shuffle_epi8(_uv, K8_SHUFFLE_P010_V), shift, UV_Z);
+            }
+            Yuv10ToBgr<align, mask, T, N>(y, shift, u, v, a, dst, tails);
+            Yuv10ToBgr<align, mask, T, N>(y + yStride, shift, u, v, a, dst + dstStride, tails);
+        }
+
+        template <bool align, class T, size_t N> void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+            if (align)
+                assert(Aligned(dst) && Aligned(dstStride));
+
+            __m512i a = _mm512_set1_epi8(alpha);
+            __m128i shift = _mm_cvtsi32_si128(6);
+            size_t widthA = AlignLo(width, A), tail = width - widthA;
+            __mmask64 tails[7], nose[7];
+            for (size_t i = 0; i < 7; ++i)
+                nose[i] = __mmask64(-1);
+            tails[0] = TailMask64(tail * 2 - A * 0);
+            tails[1] = TailMask64(tail * 2 - A * 1);
+            for (size_t i = 0; i < N; ++i)
+                tails[3 + i] = TailMask64(tail * N - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    P010ToBgr<align, false, T, N>(y + col * 2, yStride, uv + col * 2, shift, a, dst + col * N, dstStride, nose);
+                if (col < width)
+                    P010ToBgr<align, true, T, N>(y + col * 2, yStride, uv + col * 2, shift, a, dst + col * N, dstStride, tails);
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, size_t N> void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P010ToBgr<align, Base::Bt601, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: P010ToBgr<align, Base::Bt709, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: P010ToBgr<align, Base::Bt2020, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: P010ToBgr<align, Base::Trect871, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <size_t N> void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(dst) && Aligned(dstStride))
+                P010ToBgr<true, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+            else
+                P010ToBgr<false, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha, yuvType);
+        }
+
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            P010ToBgr<3>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void P010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            P010ToBgr<4>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <bool align, bool mask, class T, size_t N> SIMD_INLINE void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u,
+            const uint8_t* v, __m128i shift, __m512i a, uint8_t* dst, size_t dstStride, const __mmask64* tails)
+        {
+            static const __m512i UV_Z = SIMD_MM512_SET1_EPI16(4 * T::UV_Z);
+            __m512i _u[2], _v[2];
+            __m512i u16 = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Load<false, mask>(u, tails[2]));
+            _u[0] = UnpackYuv10<T>(_mm512_unpacklo_epi16(u16, u16), shift, UV_Z);
+            _u[1] = UnpackYuv10<T>(_mm512_unpackhi_epi16(u16, u16), shift, UV_Z);
+            __m512i v16 = _mm512_permutexvar_epi64(K64_PERMUTE_FOR_UNPACK, Load<false, mask>(v, tails[2]));
+            _v[0] = UnpackYuv10<T>(_mm512_unpacklo_epi16(v16, v16), shift, UV_Z);
+            _v[1] = UnpackYuv10<T>(_mm512_unpackhi_epi16(v16, v16), shift, UV_Z);
+            Yuv10ToBgr<align, mask, T, N>(y, shift, _u, _v, a, dst, tails);
+            Yuv10ToBgr<align, mask, T, N>(y + yStride, shift, _u, _v, a, dst + dstStride, tails);
+        }
+
+        template <bool align, class T, size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2) && (bitDepth >= 10) && (bitDepth <= 16));
+            if (align)
+                assert(Aligned(dst) && Aligned(dstStride));
+
+            __m512i a = _mm512_set1_epi8(alpha);
+            __m128i shift = _mm_cvtsi32_si128(int(bitDepth) - 10);
+            size_t widthA = AlignLo(width, A), tail = width - widthA;
+            __mmask64 tails[7], nose[7];
+            for (size_t i = 0; i < 7; ++i)
+                nose[i] = __mmask64(-1);
+            tails[0] = TailMask64(tail * 2 - A * 0);
+            tails[1] = TailMask64(tail * 2 - A * 1);
+            tails[2] = TailMask64(tail);
+            for (size_t i = 0; i < N; ++i)
+                tails[3 + i] = TailMask64(tail * N - A * i);
+            for (size_t row = 0; row < height; row += 2)
+            {
+                size_t col = 0;
+                for (; col < widthA; col += A)
+                    Yuv420p16ToBgr<align, false, T, N>(y + col * 2, yStride, u + col, v + col, shift, a, dst + col * N, dstStride, nose);
+                if (col < width)
+                    Yuv420p16ToBgr<align, true, T, N>(y + col * 2, yStride, u + col, v + col, shift, a, dst + col * N, dstStride, tails);
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <bool align, size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420p16ToBgr<align, Base::Bt601, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Yuv420p16ToBgr<align, Base::Bt709, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Yuv420p16ToBgr<align, Base::Bt2020, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Yuv420p16ToBgr<align, Base::Trect871, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        template <size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            if (Aligned(dst) && Aligned(dstStride))
+                Yuv420p16ToBgr<true, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha, yuvType);
+            else
+                Yuv420p16ToBgr<false, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha, yuvType);
+        }
+
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv420p16ToBgr<3>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv420p16ToBgr<4>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T> struct P010ToPlanar32fParams
+        {
+            __m512i max;
+            __m512 scale[3], shift[3];
+
+            P010ToPlanar32fParams(const float* lower, const float* upper)
+            {
+                max = _mm512_set1_epi32(255 * 4 * T::F_RANGE);
+                for (size_t c = 0; c < 3; ++c)
+                {
+                    scale[c] = _mm512_set1_ps((upper[c] - lower[c]) / float(255 * 4 * T::F_RANGE));
+                    shift[c] = _mm512_set1_ps(lower[c]);
+                }
+            }
+        };
+
+        SIMD_INLINE void StorePlanar32f(__m512i value, __m512i max, __m512 scale, __m512 shift, float* dst)
+        {
+            __m512 _value = _mm512_cvtepi32_ps(_mm512_min_epi32(_mm512_max_epi32(value, K_ZERO), max));
+            _mm512_storeu_ps(dst, _mm512_add_ps(_mm512_mul_ps(_value, scale), shift));
+        }
+
+        template <class T> SIMD_INLINE void P010ToPlanar32f(const uint8_t* y, const uint8_t* uv, const P010ToPlanar32fParams<T>& p, size_t ib, size_t ir, float* b, float* g, float* r)
+        {
+            static const __m512i Y_2_A = SIMD_MM512_SET1_EPI32(T::Y_2_A);
+            static const __m512i U_2_B = SIMD_MM512_SET1_EPI32(T::U_2_B);
+            static const __m512i U_2_G = SIMD_MM512_SET1_EPI32(T::U_2_G);
+            static const __m512i V_2_G = SIMD_MM512_SET1_EPI32(T::V_2_G);
+            static const __m512i V_2_R = SIMD_MM512_SET1_EPI32(T::V_2_R);
+            static const __m512i Y_LO = SIMD_MM512_SET1_EPI32(4 * T::Y_LO);
+            static const __m512i UV_Z = SIMD_MM512_SET1_EPI32(4 * T::UV_Z);
+            __m512i _y = _mm512_sub_epi32(_mm512_srli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i*)y)), 6), Y_LO);
+            __m512i _uv = _mm512_sub_epi32(_mm512_srli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((__m256i*)uv)), 6), UV_Z);
+            __m512i _u = _mm512_shuffle_epi32(_uv, _MM_PERM_CCAA);
+            __m512i _v = _mm512_shuffle_epi32(_uv, _MM_PERM_DDBB);
+            __m512i _ya = _mm512_mullo_epi32(_y, Y_2_A);
+            StorePlanar32f(_mm512_add_epi32(_ya, _mm512_mullo_epi32(_u, U_2_B)), p.max, p.scale[ib], p.shift[ib], b);
+            StorePlanar32f(_mm512_add_epi32(_ya, _mm512_add_epi32(_mm512_mullo_epi32(_u, U_2_G), _mm512_mullo_epi32(_v, V_2_G))), p.max, p.scale[1], p.shift[1], g);
+            StorePlanar32f(_mm512_add_epi32(_ya, _mm512_mullo_epi32(_v, V_2_R)), p.max, p.scale[ir], p.shift[ir], r);
+        }
+
+        template <class T> void P010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, const float* lower, const float* upper, float* dst, SimdBool rgb)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= F) && (height >= 2));
+
+            P010ToPlanar32fParams<T> params(lower, upper);
+            size_t size = width * height, ib = rgb ? 2 : 0, ir = rgb ? 0 : 2;
+            float* b = dst + ib * size, * g = dst + size, * r = dst + ir * size;
+            size_t widthF = AlignLo(width, F), tail = width - F;
+            for (size_t row = 0; row < height; row += 1)
+            {
+                for (size_t col = 0; col < widthF; col += F)
+                    P010ToPlanar32f<T>(y + col * 2, uv + col * 2, params, ib, ir, b + col, g + col, r + col);
+                if (widthF != width)
+                    P010ToPlanar32f<T>(y + tail * 2, uv + tail * 2, params, ib, ir, b + tail, g + tail, r + tail);
+                y += yStride;
+                if (row & 1)
+                    uv += uvStride;
+                b += width;
+                g += width;
+                r += width;
+            }
+        }
+
+        void P010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            const float* lower, const float* upper, float* dst, SimdBool rgb, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P010ToPlanar32f<Base::Bt601>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            case SimdYuvBt709: P010ToPlanar32f<Base::Bt709>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            case SimdYuvBt2020: P010ToPlanar32f<Base::Bt2020>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            case SimdYuvTrect871: P010ToPlanar32f<Base::Trect871>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif
+}
@@ -874,6 +874,7 @@ namespace Simd
             case SimdConvolutionActivationHswish: SetInput<SimdConvolutionActivationHswish>(p, input); break;
             case SimdConvolutionActivationMish: SetInput<SimdConvolutionActivationMish>(p, input); break;
             case SimdConvolutionActivationSwish: SetInput<SimdConvolutionActivationSwish>(p, input); break;
+            case SimdConvolutionActivationGelu: SetInput<SimdConvolutionActivationGelu>(p, input); break;
             }
         }
     }
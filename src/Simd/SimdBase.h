@@ -36,6 +36,10 @@ namespace Simd
 
         void SetThreadNumber(size_t threadNumber);
 
+        size_t GetParallelThreshold();
+
+        void SetParallelThreshold(size_t area);
+
         uint32_t Crc32(const void* src, size_t size);
 
         uint32_t Crc32c(const void * src, size_t size);
@@ -61,6 +65,10 @@ namespace Simd
             const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride,
             uint16_t weight, uint8_t * difference, size_t differenceStride);
 
+        void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+            uint8_t * difference, size_t differenceStride);
+
         void AlphaBlending(const uint8_t *src, size_t srcStride, size_t width, size_t height, size_t channelCount,
             const uint8_t *alpha, size_t alphaStride, uint8_t *dst, size_t dstStride);
 
@@ -74,6 +82,8 @@ namespace Simd
         void AlphaBlendingUniform(const uint8_t* src, size_t srcStride, size_t width, size_t height,
             size_t channelCount, uint8_t alpha, uint8_t* dst, size_t dstStride);
 
+        void AlphaComposite(const SimdAlphaLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height, size_t channelCount);
+
         void AlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel, 
             size_t channelCount, const uint8_t * alpha, size_t alphaStride);
 
@@ -112,6 +122,9 @@ namespace Simd
 
         void Base64Encode(const uint8_t* src, size_t size, uint8_t* dst);
 
+        void Bayer16ToBgr(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            const float* gains, SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth);
+
         void BayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
 
         void BayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -158,6 +171,8 @@ namespace Simd
 
         void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
 
+        void BgrToHsvRangeMask(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lo, const uint8_t * hi, uint8_t * mask, size_t maskStride);
+
         void BgrToRgb(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgb, size_t rgbStride);
 
         void BgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride);
@@ -176,6 +191,25 @@ namespace Simd
         void AveragingBinarizationV2(const uint8_t* src, size_t srcStride, size_t width, size_t height,
             size_t neighborhood, int32_t shift, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride);
 
+        void BitMaskPack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        void BitMaskUnpack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        void BitMaskOperation(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+            size_t width, size_t height, SimdBitMaskOperationType type, uint8_t * dst, size_t dstStride);
+
+        void BitMaskNot(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        void BitMaskCount(const uint8_t * mask, size_t stride, size_t width, size_t height, uint64_t * count);
+
+        void BitMaskBoundingBox(const uint8_t * mask, size_t stride, size_t width, size_t height, ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
+
+        void BitMaskCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
+            const uint8_t * mask, size_t maskStride, uint8_t * dst, size_t dstStride);
+
+        void BitMaskFill(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize,
+            const uint8_t * mask, size_t maskStride);
+
         void ConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
             uint8_t value, SimdCompareType compareType, uint32_t * count);
 
@@ -236,6 +270,12 @@ namespace Simd
         void DetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
             ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+        bool DetectionProfiling(const void * hid);
+
+        void DetectionSetProfiling(void * hid, SimdBool enable);
+
+        void DetectionGetProfiling(const void * hid, size_t * stageNumber, uint64_t * windows, uint64_t * passed);
+
         void EdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
             uint8_t * background, size_t backgroundStride);
 
@@ -307,6 +347,10 @@ namespace Simd
 
         void GrayToBgra(const uint8_t *gray, size_t width, size_t height, size_t grayStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha);
 
+        void HslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
+
+        void HsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
+
         void AbsSecondDerivativeHistogram(const uint8_t *src, size_t width, size_t height, size_t stride,
             size_t step, size_t indent, uint32_t * histogram);
 
@@ -356,6 +400,11 @@ namespace Simd
             uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
             SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
 
+        bool IntegralParallelEnable(size_t width, size_t height, const uint8_t * tilted);
+
+        void IntegralParallel(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat);
+
         void InterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation);
 
         void InterferenceIncrementMasked(uint8_t * statistic, size_t statisticStride, size_t width, size_t height,
@@ -458,12 +507,27 @@ namespace Simd
             size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY,
             void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
+        void Nv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Nv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void Nv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        void Nv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
         void OperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
             size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
 
         void OperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
             size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type);
 
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void P010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        void P010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            const float* lower, const float* upper, float* dst, SimdBool rgb, SimdYuvType yuvType);
+
         void VectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height);
 
         void ReduceColor2x2(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
@@ -478,6 +542,9 @@ namespace Simd
         void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
 
+        void ReduceGray4x4Max(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
         void ReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
 
@@ -546,6 +613,8 @@ namespace Simd
         void SquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
             const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
 
+        void SquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums);
+
         void SquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum);
 
         void SquaredDifferenceKahanSum32f(const float * a, const float * b, size_t size, float * sum);
@@ -591,6 +660,12 @@ namespace Simd
 
         void SynetConvert8uTo32f(const uint8_t* src, size_t batch, size_t channels, size_t height, size_t width, SimdTensorFormatType format, const float* scale, const float* shift, float* dst, SimdSynetCompatibilityType compatibility);
 
+        void SynetDetectionDecode32f(const float* loc, const float* anchor, const float* variance, size_t count, float* box);
+
+        size_t SynetDetectionFilter32f(const float* score, size_t size, float threshold, uint32_t* index);
+
+        size_t SynetDetectionNms32f(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index);
+
         void SynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
 
         void SynetElu32f(const float * src, size_t size, const float * alpha, float * dst);
@@ -609,6 +684,8 @@ namespace Simd
 
         void SynetFusedLayerForward9(const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format);
 
+        void SynetGelu32f(const float* src, size_t size, float* dst);
+
         void SynetHardSigmoid32f(const float* src, size_t size, const float* scale, const float* shift, float* dst);
             
         void SynetHswish32f(const float * src, size_t size, const float * shift, const float * scale, float * dst);
@@ -624,6 +701,12 @@ namespace Simd
         void SynetNormalizeLayerForward(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, 
             const float* eps, SimdBool acrossSpatial, SimdTensorFormatType format, float* buf, float* dst);
 
+        void SynetNormalizeLayerForwardV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+        void SynetNormalizeLayerForwardV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
         void SynetPoolingAverage(const float * src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
             size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
 
@@ -741,6 +824,12 @@ namespace Simd
         void Yuva444pToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
             const uint8_t* a, size_t aStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, SimdYuvType yuvType);
 
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        void Yuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
         void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
             size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
 
@@ -57,5 +57,27 @@ namespace Simd
                 difference += differenceStride;
             }
         }
+
+        void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+            uint8_t * difference, size_t differenceStride)
+        {
+            for (size_t row = 0, offset = 0; row < height; ++row, offset += stride)
+            {
+                for (size_t col = 0; col < width; ++col)
+                {
+                    int sum = 0;
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        uint32_t featureDifference = FeatureDifference(value[i][offset + col], lo[i][offset + col], hi[i][offset + col]);
+                        sum = Min(sum + int(featureDifference * featureDifference * weight[i] >> SHIFT), 0xFF);
+                    }
+                    difference[col] = mask ? sum & mask[col] : sum;
+                }
+                if (mask)
+                    mask += maskStride;
+                difference += differenceStride;
+            }
+        }
     }
 }
@@ -0,0 +1,150 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdAlphaBlending.h"
+#include "Simd/SimdCpu.h"
+#include "Simd/SimdParallelRows.h"
+
+#include <vector>
+
+namespace Simd
+{
+    namespace Base
+    {
+        void AlphaBlendingPremultiplied(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, size_t channelCount)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t x = 0; x < width; ++x)
+                {
+                    const uint8_t* s = src + 4 * x;
+                    uint8_t* d = dst + channelCount * x;
+                    int alpha = 0xFF - s[3];
+                    for (size_t c = 0; c < channelCount; ++c)
+                        d[c] = Min(s[c] + DivideBy255(d[c] * alpha), 0xFF);
+                }
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        struct AlphaCompositeRect
+        {
+            size_t left, top, right, bottom;
+        };
+
+        const AlphaCompositeKernels ALPHA_COMPOSITE_BASE = { 0, AlphaBlending, AlphaBlendingUniform, AlphaFilling, AlphaBlendingPremultiplied };
+
+        SIMD_INLINE void AlphaCompositeLayer(const SimdAlphaLayer& layer, const AlphaCompositeRect& rect, size_t top, size_t bottom,
+            const uint8_t* color, uint8_t* dst, size_t dstStride, size_t channelCount, const AlphaCompositeKernels& kernels)
+        {
+            size_t width = rect.right - rect.left, height = bottom - top;
+            size_t x = rect.left - layer.left, y = top - layer.top;
+            const AlphaCompositeKernels& k = width >= kernels.minWidth ? kernels : ALPHA_COMPOSITE_BASE;
+            dst += top * dstStride + rect.left * channelCount;
+            const uint8_t* alpha = layer.alpha ? layer.alpha + y * layer.alphaStride + x : NULL;
+            switch (layer.type)
+            {
+            case SimdAlphaLayerBlend:
+            {
+                const uint8_t* src = layer.src + y * layer.srcStride + x * channelCount;
+                if (alpha)
+                    k.blending(src, layer.srcStride, width, height, channelCount, alpha, layer.alphaStride, dst, dstStride);
+                else
+                    k.blendingUniform(src, layer.srcStride, width, height, channelCount, layer.value, dst, dstStride);
+                break;
+            }
+            case SimdAlphaLayerFill:
+                if (alpha)
+                    k.filling(dst, dstStride, width, height, layer.color, channelCount, alpha, layer.alphaStride);
+                else
+                    k.blendingUniform(color, 0, width, height, channelCount, layer.value, dst, dstStride);
+                break;
+            case SimdAlphaLayerPremultiplied:
+                k.premultiplied(layer.src + y * layer.srcStride + x * 4, layer.srcStride, width, height, dst, dstStride, channelCount);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
+        void AlphaComposite(const SimdAlphaLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height, size_t channelCount, const AlphaCompositeKernels& kernels)
+        {
+            assert(channelCount >= 1 && channelCount <= 4);
+
+            std::vector<AlphaCompositeRect> rects(count);
+            std::vector<size_t> offsets(count, 0);
+            std::vector<uint8_t> colors;
+            size_t begin = height, end = 0;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const SimdAlphaLayer& layer = layers[i];
+                AlphaCompositeRect& rect = rects[i];
+                if (layer.type == SimdAlphaLayerFill && layer.alpha == NULL)
+                {
+                    offsets[i] = colors.size();
+                    for (size_t x = 0; x < width; ++x)
+                        colors.insert(colors.end(), layer.color, layer.color + channelCount);
+                }
+                rect.left = Simd::RestrictRange<ptrdiff_t>(layer.left, 0, width);
+                rect.top = Simd::RestrictRange<ptrdiff_t>(layer.top, 0, height);
+                rect.right = Simd::RestrictRange<ptrdiff_t>(layer.left + (ptrdiff_t)layer.width, rect.left, width);
+                rect.bottom = Simd::RestrictRange<ptrdiff_t>(layer.top + (ptrdiff_t)layer.height, rect.top, height);
+                if (rect.left < rect.right && rect.top < rect.bottom)
+                {
+                    begin = Min(begin, rect.top);
+                    end = Max(end, rect.bottom);
+                }
+            }
+            if (begin >= end)
+                return;
+
+            size_t band = Simd::Max<size_t>(AlgCacheL2() / 2 / (width * channelCount), 1);
+            auto Bands = [&](size_t rowBegin, size_t rowEnd)
+            {
+                for (size_t top = rowBegin + begin; top < rowEnd + begin; top += band)
+                {
+                    size_t bottom = Min(top + band, rowEnd + begin);
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const AlphaCompositeRect& rect = rects[i];
+                        size_t layerTop = Max(top, rect.top), layerBottom = Min(bottom, rect.bottom);
+                        if (rect.left < rect.right && layerTop < layerBottom)
+                            AlphaCompositeLayer(layers[i], rect, layerTop, layerBottom, colors.data() + offsets[i], dst, dstStride, channelCount, kernels);
+                    }
+                }
+            };
+            if (ParallelRowsEnable(width, end - begin))
+                ParallelRows(end - begin, 1, Bands);
+            else
+                Bands(0, end - begin);
+        }
+
+        void AlphaComposite(const SimdAlphaLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height, size_t channelCount)
+        {
+            AlphaComposite(layers, count, dst, dstStride, width, height, channelCount, ALPHA_COMPOSITE_BASE);
+        }
+    }
+}
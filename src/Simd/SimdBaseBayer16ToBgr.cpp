@@ -0,0 +1,179 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdParallelRows.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        void Bayer16GainRow(const uint16_t* src, size_t width, const uint32_t gain[2], uint32_t max, uint16_t* dst)
+        {
+            const uint32_t round = 1 << (BAYER16_GAIN_SHIFT - 1);
+            for (size_t x = 0; x < width; x += 2)
+            {
+                dst[x + 0] = (uint16_t)Min((src[x + 0] * gain[0] + round) >> BAYER16_GAIN_SHIFT, max);
+                dst[x + 1] = (uint16_t)Min((src[x + 1] * gain[1] + round) >> BAYER16_GAIN_SHIFT, max);
+            }
+        }
+
+        SIMD_INLINE uint16_t Bayer16Value(int value, int round, int shift, int max)
+        {
+            return (uint16_t)RestrictRange((value + round) >> shift, 0, max);
+        }
+
+        void Bayer16DemosaicRow(const uint16_t* src[5], size_t width, bool malvar, bool red, bool greenFirst, int shift, int max, uint16_t* b, uint16_t* g, uint16_t* r)
+        {
+            const uint16_t* s0 = src[0], * s1 = src[1], * s2 = src[2], * s3 = src[3], * s4 = src[4];
+            int round = 1 << (shift - 1);
+            for (size_t x = 0; x < width; ++x)
+            {
+                int c = s2[x], we = s2[x - 1] + s2[x + 1], ns = s1[x] + s3[x];
+                int diag = s1[x - 1] + s1[x + 1] + s3[x - 1] + s3[x + 1];
+                int gat, hor, ver, dia;
+                if (malvar)
+                {
+                    int wwee = s2[x - 2] + s2[x + 2], nnss = s0[x] + s4[x];
+                    gat = 8 * c + 4 * (we + ns) - 2 * (wwee + nnss);
+                    hor = 10 * c + 8 * we - 2 * wwee - 2 * diag + nnss;
+                    ver = 10 * c + 8 * ns - 2 * nnss - 2 * diag + wwee;
+                    dia = 12 * c + 4 * diag - 3 * (wwee + nnss);
+                }
+                else
+                {
+                    gat = 4 * (we + ns);
+                    hor = 8 * we;
+                    ver = 8 * ns;
+                    dia = 4 * diag;
+                }
+                c *= 16;
+                int _b, _g, _r;
+                if (((x & 1) == 0) == greenFirst)
+                {
+                    _b = red ? ver : hor;
+                    _g = c;
+                    _r = red ? hor : ver;
+                }
+                else
+                {
+                    _b = red ? dia : c;
+                    _g = gat;
+                    _r = red ? c : dia;
+                }
+                b[x] = Bayer16Value(_b, round, shift, max);
+                g[x] = Bayer16Value(_g, round, shift, max);
+                r[x] = Bayer16Value(_r, round, shift, max);
+            }
+        }
+
+        void Bayer16StoreRow(const uint16_t* b, const uint16_t* g, const uint16_t* r, size_t width, size_t bgrDepth, uint8_t* bgr)
+        {
+            if (bgrDepth == 8)
+            {
+                for (size_t x = 0; x < width; ++x, bgr += 3)
+                {
+                    bgr[0] = (uint8_t)b[x];
+                    bgr[1] = (uint8_t)g[x];
+                    bgr[2] = (uint8_t)r[x];
+                }
+            }
+            else
+            {
+                uint16_t* dst = (uint16_t*)bgr;
+                for (size_t x = 0; x < width; ++x, dst += 3)
+                {
+                    dst[0] = b[x];
+                    dst[1] = g[x];
+                    dst[2] = r[x];
+                }
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE size_t Bayer16Reflect(ptrdiff_t row, size_t height)
+        {
+            return row < 0 ? -row : (row >= (ptrdiff_t)height ? 2 * height - 2 - row : row);
+        }
+
+        void Bayer16ToBgr(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth, const float* gains,
+            SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth, Bayer16GainPtr gainRow, Bayer16DemosaicPtr demosaicRow, Bayer16StorePtr storeRow)
+        {
+            assert(width >= 4 && height >= 4 && width % 2 == 0 && height % 2 == 0);
+            assert(bitDepth >= 8 && bitDepth <= 16 && (bgrDepth == 8 || bgrDepth == 16));
+
+            uint32_t max = (1 << bitDepth) - 1, gain[3];
+            for (size_t c = 0; c < 3; ++c)
+                gain[c] = gains ? RestrictRange(Round(gains[c] * (1 << BAYER16_GAIN_SHIFT)), 0, BAYER16_GAIN_MAX) : 1 << BAYER16_GAIN_SHIFT;
+            bool malvar = demosaic == SimdBayerDemosaicMalvar;
+            bool greenFirst = bayerFormat == SimdPixelFormatBayerGrbg || bayerFormat == SimdPixelFormatBayerGbrg;
+            bool red = bayerFormat == SimdPixelFormatBayerGrbg || bayerFormat == SimdPixelFormatBayerRggb;
+            int shift = bgrDepth == 8 ? int(bitDepth) - 4 : 4, dstMax = bgrDepth == 8 ? 0xFF : max;
+
+            auto Rows = [&](size_t begin, size_t end)
+            {
+                size_t stride = AlignHi(width + 4, SIMD_ALIGN);
+                Array16u buffer(stride * 8);
+                uint16_t* b = buffer.data + 5 * stride, * g = b + stride, * r = g + stride;
+                ptrdiff_t loaded[5] = { -1, -1, -1, -1, -1 };
+                const uint16_t* src[5];
+                for (size_t row = begin; row < end; ++row)
+                {
+                    for (size_t i = 0; i < 5; ++i)
+                    {
+                        size_t y = Bayer16Reflect(ptrdiff_t(row + i) - 2, height), odd = y & 1;
+                        uint16_t* dst = buffer.data + (y % 5) * stride + 2;
+                        if (loaded[y % 5] != (ptrdiff_t)y)
+                        {
+                            uint32_t other = gain[(red != (odd != 0)) ? 2 : 0], green = gain[1];
+                            uint32_t _gain[2] = { (greenFirst != (odd != 0)) ? green : other, (greenFirst != (odd != 0)) ? other : green };
+                            gainRow((const uint16_t*)(bayer + y * bayerStride), width, _gain, max, dst);
+                            dst[-1] = dst[1];
+                            dst[-2] = dst[2];
+                            dst[width] = dst[width - 2];
+                            dst[width + 1] = dst[width - 3];
+                            loaded[y % 5] = y;
+                        }
+                        src[i] = dst;
+                    }
+                    bool odd = (row & 1) != 0;
+                    demosaicRow(src, width, malvar, red != odd, greenFirst != odd, shift, dstMax, b, g, r);
+                    storeRow(b, g, r, width, bgrDepth, bgr + row * bgrStride);
+                }
+            };
+            if (ParallelRowsEnable(width, height))
+                ParallelRows(height, 2, Rows);
+            else
+                Rows(0, height);
+        }
+
+        void Bayer16ToBgr(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            const float* gains, SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth)
+        {
+            Bayer16ToBgr(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, demosaic, bgr, bgrStride, bgrDepth,
+                Bayer16GainRow, Bayer16DemosaicRow, Bayer16StoreRow);
+        }
+    }
+}
@@ -39,5 +39,26 @@ namespace Simd
                 }
             }
         }
+
+        SIMD_INLINE bool HsvInRange(const uint8_t * hsv, const uint8_t * lo, const uint8_t * hi)
+        {
+            bool hue = lo[0] <= hi[0] ? (hsv[0] >= lo[0] && hsv[0] <= hi[0]) : (hsv[0] >= lo[0] || hsv[0] <= hi[0]);
+            return hue && hsv[1] >= lo[1] && hsv[1] <= hi[1] && hsv[2] >= lo[2] && hsv[2] <= hi[2];
+        }
+
+        void BgrToHsvRangeMask(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lo, const uint8_t * hi, uint8_t * mask, size_t maskStride)
+        {
+            uint8_t hsv[3];
+            for (size_t row = 0; row < height; ++row)
+            {
+                const uint8_t * pBgr = bgr + row * bgrStride;
+                uint8_t * pMask = mask + row * maskStride;
+                for (size_t col = 0; col < width; ++col, pBgr += 3)
+                {
+                    BgrToHsv(pBgr[0], pBgr[1], pBgr[2], hsv);
+                    pMask[col] = HsvInRange(hsv, lo, hi) ? 0xFF : 0;
+                }
+            }
+        }
     }
 }
@@ -0,0 +1,251 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE uint8_t BitMaskTail(size_t width)
+        {
+            return uint8_t((1 << (width & 7)) - 1);
+        }
+
+        SIMD_INLINE uint8_t BitMaskPack(const uint8_t * src, size_t size)
+        {
+            uint8_t bits = 0;
+            for (size_t i = 0; i < size; ++i)
+                bits |= (src[i] ? 1 : 0) << i;
+            return bits;
+        }
+
+        void BitMaskPack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            size_t full = width / 8;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t i = 0; i < full; ++i)
+                    dst[i] = BitMaskPack(src + i * 8, 8);
+                if (width & 7)
+                    dst[full] = BitMaskPack(src + full * 8, width & 7);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        void BitMaskUnpack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < width; ++col)
+                    dst[col] = (src[col >> 3] & (1 << (col & 7))) ? 0xFF : 0;
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        template <SimdBitMaskOperationType type> SIMD_INLINE uint8_t BitMaskOperation(uint8_t a, uint8_t b);
+
+        template <> SIMD_INLINE uint8_t BitMaskOperation<SimdBitMaskOperationAnd>(uint8_t a, uint8_t b)
+        {
+            return a & b;
+        }
+
+        template <> SIMD_INLINE uint8_t BitMaskOperation<SimdBitMaskOperationOr>(uint8_t a, uint8_t b)
+        {
+            return a | b;
+        }
+
+        template <> SIMD_INLINE uint8_t BitMaskOperation<SimdBitMaskOperationXor>(uint8_t a, uint8_t b)
+        {
+            return a ^ b;
+        }
+
+        template <> SIMD_INLINE uint8_t BitMaskOperation<SimdBitMaskOperationAndNot>(uint8_t a, uint8_t b)
+        {
+            return a & ~b;
+        }
+
+        template <SimdBitMaskOperationType type> void BitMaskOperation(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+            size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            size_t size = DivHi(width, 8);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t i = 0; i < size; ++i)
+                    dst[i] = BitMaskOperation<type>(a[i], b[i]);
+                a += aStride;
+                b += bStride;
+                dst += dstStride;
+            }
+        }
+
+        void BitMaskOperation(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+            size_t width, size_t height, SimdBitMaskOperationType type, uint8_t * dst, size_t dstStride)
+        {
+            switch (type)
+            {
+            case SimdBitMaskOperationAnd:
+                return BitMaskOperation<SimdBitMaskOperationAnd>(a, aStride, b, bStride, width, height, dst, dstStride);
+            case SimdBitMaskOperationOr:
+                return BitMaskOperation<SimdBitMaskOperationOr>(a, aStride, b, bStride, width, height, dst, dstStride);
+            case SimdBitMaskOperationXor:
+                return BitMaskOperation<SimdBitMaskOperationXor>(a, aStride, b, bStride, width, height, dst, dstStride);
+            case SimdBitMaskOperationAndNot:
+                return BitMaskOperation<SimdBitMaskOperationAndNot>(a, aStride, b, bStride, width, height, dst, dstStride);
+            default:
+                assert(0);
+            }
+        }
+
+        void BitMaskNot(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+        {
+            size_t full = width / 8;
+            uint8_t tail = BitMaskTail(width);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t i = 0; i < full; ++i)
+                    dst[i] = ~src[i];
+                if (width & 7)
+                    dst[full] = ~src[full] & tail;
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        SIMD_INLINE uint64_t BitCount(uint64_t value)
+        {
+            value = value - ((value >> 1) & 0x5555555555555555);
+            value = (value & 0x3333333333333333) + ((value >> 2) & 0x3333333333333333);
+            return (((value + (value >> 4)) & 0x0F0F0F0F0F0F0F0F) * 0x0101010101010101) >> 56;
+        }
+
+        void BitMaskCount(const uint8_t * mask, size_t stride, size_t width, size_t height, uint64_t * count)
+        {
+            size_t full = width / 8, full8 = AlignLo(full, 8);
+            uint8_t tail = BitMaskTail(width);
+            uint64_t sum = 0;
+            for (size_t row = 0; row < height; ++row)
+            {
+                size_t i = 0;
+                for (; i < full8; i += 8)
+                    sum += BitCount(*(uint64_t*)(mask + i));
+                for (; i < full; ++i)
+                    sum += BitCount(mask[i]);
+                if (width & 7)
+                    sum += BitCount(mask[full] & tail);
+                mask += stride;
+            }
+            *count = sum;
+        }
+
+        void BitMaskBoundingBox(const uint8_t * mask, size_t stride, size_t width, size_t height, ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom)
+        {
+            size_t size = DivHi(width, 8), full = width / 8;
+            uint8_t tail = BitMaskTail(width);
+            Array8u cols(size, true);
+            ptrdiff_t first = -1, last = -1;
+            for (size_t row = 0; row < height; ++row)
+            {
+                uint8_t any = 0;
+                for (size_t i = 0; i < full; ++i)
+                {
+                    cols[i] |= mask[i];
+                    any |= mask[i];
+                }
+                if (width & 7)
+                {
+                    uint8_t bits = mask[full] & tail;
+                    cols[full] |= bits;
+                    any |= bits;
+                }
+                if (any)
+                {
+                    if (first < 0)
+                        first = row;
+                    last = row;
+                }
+                mask += stride;
+            }
+            if (first < 0)
+            {
+                *left = 0, *top = 0, *right = 0, *bottom = 0;
+                return;
+            }
+            size_t lo = 0, hi = size - 1;
+            while (cols[lo] == 0)
+                lo++;
+            while (cols[hi] == 0)
+                hi--;
+            size_t loBit = 0, hiBit = 7;
+            while ((cols[lo] & (1 << loBit)) == 0)
+                loBit++;
+            while ((cols[hi] & (1 << hiBit)) == 0)
+                hiBit--;
+            *left = lo * 8 + loBit;
+            *top = first;
+            *right = hi * 8 + hiBit + 1;
+            *bottom = last + 1;
+        }
+
+        void BitMaskCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, 
+            const uint8_t * mask, size_t maskStride, uint8_t * dst, size_t dstStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += pixelSize)
+                {
+                    if (mask[col >> 3] & (1 << (col & 7)))
+                    {
+                        for (size_t i = 0; i < pixelSize; ++i)
+                            dst[offset + i] = src[offset + i];
+                    }
+                }
+                src += srcStride;
+                mask += maskStride;
+                dst += dstStride;
+            }
+        }
+
+        void BitMaskFill(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize,
+            const uint8_t * mask, size_t maskStride)
+        {
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < width; ++col, offset += pixelSize)
+                {
+                    if (mask[col >> 3] & (1 << (col & 7)))
+                    {
+                        for (size_t i = 0; i < pixelSize; ++i)
+                            dst[offset + i] = pixel[i];
+                    }
+                }
+                mask += maskStride;
+                dst += dstStride;
+            }
+        }
+    }
+}
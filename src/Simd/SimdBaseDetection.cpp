@@ -373,6 +373,7 @@ namespace Simd
             }
 
             hid->stages.resize(data.stages.size());
+            hid->stageNumber = data.stages.size();
             hid->leaves.resize(data.leaves.size());
             for (size_t i = 0; i < data.stages.size(); ++i)
             {
@@ -562,6 +563,7 @@ namespace Simd
             }
 
             hid->stages.resize(data.stages.size());
+            hid->stageNumber = data.stages.size();
             hid->leaves.resize(data.leaves.size());
             for (size_t i = 0; i < data.stages.size(); ++i)
             {
@@ -767,6 +769,7 @@ namespace Simd
 
         void DetectionHaarDetect32fp(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
         {
+            DetectionProfiler profiler(hid);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 1)
             {
                 size_t p_offset = row * hid.sum.stride / sizeof(uint32_t);
@@ -776,7 +779,9 @@ namespace Simd
                     if (mask.At<uint8_t>(col, row) == 0)
                         continue;
                     float norm = Norm32f(hid, pq_offset + col);
-                    if (Detect32f(hid, p_offset + col, 0, norm) > 0)
+                    int result = Detect32f(hid, p_offset + col, 0, norm);
+                    profiler.Add(result);
+                    if (result > 0)
                         dst.At<uint8_t>(col, row) = 1;
                 }
             }
@@ -794,6 +799,7 @@ namespace Simd
 
         void DetectionHaarDetect32fi(const HidHaarCascade & hid, const Image & mask, const Rect & rect, Image & dst)
         {
+            DetectionProfiler profiler(hid);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 2)
             {
                 size_t p_offset = row * hid.isum.stride / sizeof(uint32_t);
@@ -803,7 +809,9 @@ namespace Simd
                     if (mask.At<uint8_t>(col, row) == 0)
                         continue;
                     float norm = Norm32f(hid, pq_offset + col);
-                    if (Detect32f(hid, p_offset + col / 2, 0, norm) > 0)
+                    int result = Detect32f(hid, p_offset + col / 2, 0, norm);
+                    profiler.Add(result);
+                    if (result > 0)
                         dst.At<uint8_t>(col, row) = 1;
                 }
             }
@@ -821,6 +829,7 @@ namespace Simd
 
         void DetectionLbpDetect32fp(const HidLbpCascade<float, uint32_t> & hid, const Image & mask, const Rect & rect, Image & dst)
         {
+            DetectionProfiler profiler(hid);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 1)
             {
                 size_t offset = row * hid.sum.stride / sizeof(int);
@@ -828,7 +837,9 @@ namespace Simd
                 {
                     if (mask.At<uint8_t>(col, row) == 0)
                         continue;
-                    if (Detect(hid, offset + col, 0) > 0)
+                    int result = Detect(hid, offset + col, 0);
+                    profiler.Add(result);
+                    if (result > 0)
                         dst.At<uint8_t>(col, row) = 1;
                 }
             }
@@ -846,6 +857,7 @@ namespace Simd
 
         void DetectionLbpDetect32fi(const HidLbpCascade<float, uint32_t> & hid, const Image & mask, const Rect & rect, Image & dst)
         {
+            DetectionProfiler profiler(hid);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 2)
             {
                 size_t offset = row * hid.isum.stride / sizeof(int);
@@ -853,7 +865,9 @@ namespace Simd
                 {
                     if (mask.At<uint8_t>(col, row) == 0)
                         continue;
-                    if (Detect(hid, offset + col / 2, 0) > 0)
+                    int result = Detect(hid, offset + col / 2, 0);
+                    profiler.Add(result);
+                    if (result > 0)
                         dst.At<uint8_t>(col, row) = 1;
                 }
             }
@@ -871,6 +885,7 @@ namespace Simd
 
         void DetectionLbpDetect16ip(const HidLbpCascade<int, uint16_t> & hid, const Image & mask, const Rect & rect, Image & dst)
         {
+            DetectionProfiler profiler(hid);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 1)
             {
                 size_t offset = row * hid.isum.stride / sizeof(uint16_t);
@@ -878,7 +893,9 @@ namespace Simd
                 {
                     if (mask.At<uint8_t>(col, row) == 0)
                         continue;
-                    if (Detect(hid, offset + col, 0) > 0)
+                    int result = Detect(hid, offset + col, 0);
+                    profiler.Add(result);
+                    if (result > 0)
                         dst.At<uint8_t>(col, row) = 1;
                 }
             }
@@ -896,6 +913,7 @@ namespace Simd
 
         void DetectionLbpDetect16ii(const HidLbpCascade<int, uint16_t> & hid, const Image & mask, const Rect & rect, Image & dst)
         {
+            DetectionProfiler profiler(hid);
             for (ptrdiff_t row = rect.top; row < rect.bottom; row += 2)
             {
                 size_t offset = row * hid.isum.stride / sizeof(uint16_t);
@@ -903,7 +921,9 @@ namespace Simd
                 {
                     if (mask.At<uint8_t>(col, row) == 0)
                         continue;
-                    if (Detect(hid, offset + col / 2, 0) > 0)
+                    int result = Detect(hid, offset + col / 2, 0);
+                    profiler.Add(result);
+                    if (result > 0)
                         dst.At<uint8_t>(col, row) = 1;
                 }
             }
@@ -918,5 +938,39 @@ namespace Simd
                 Rect(left, top, right, bottom),
                 Image(hid.sum.width - 1, hid.sum.height - 1, dstStride, Image::Gray8, dst).Ref());
         }
+
+        bool DetectionProfiling(const void * hid)
+        {
+            return ((const HidBase*)hid)->profiling;
+        }
+
+        void DetectionSetProfiling(void * _hid, SimdBool enable)
+        {
+            HidBase * hid = (HidBase*)_hid;
+            std::lock_guard<std::mutex> lock(hid->profileMutex);
+            hid->profiling = enable == SimdTrue;
+            hid->profileWindows = 0;
+            hid->profileRejected.assign(hid->stageNumber + 1, 0);
+        }
+
+        void DetectionGetProfiling(const void * _hid, size_t * stageNumber, uint64_t * windows, uint64_t * passed)
+        {
+            const HidBase * hid = (const HidBase*)_hid;
+            std::lock_guard<std::mutex> lock(hid->profileMutex);
+            if (stageNumber)
+                *stageNumber = hid->stageNumber;
+            if (windows)
+                *windows = hid->profileWindows;
+            if (passed)
+            {
+                uint64_t alive = hid->profileWindows;
+                for (size_t i = 0; i < hid->stageNumber; ++i)
+                {
+                    if (i < hid->profileRejected.size())
+                        alive -= hid->profileRejected[i];
+                    passed[i] = alive;
+                }
+            }
+        }
     }
 }
@@ -22,11 +22,125 @@
 * SOFTWARE.
 */
 #include "Simd/SimdIntegral.h"
+#include "Simd/SimdParallel.hpp"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
     namespace Base
     {
+        const size_t INTEGRAL_PARALLEL_AREA_MIN = 1024 * 1024;
+
+        template <class TSum, class TSqsum> void IntegralRows(const uint8_t * src, size_t srcStride, size_t width, size_t begin, size_t end,
+            TSum * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride)
+        {
+            for (size_t row = begin; row < end; ++row)
+            {
+                TSum * pSum = sum + row * sumStride;
+                TSqsum * pSqsum = sqsum + row * sqsumStride;
+                if (row == 0)
+                {
+                    memset(pSum, 0, (width + 1) * sizeof(TSum));
+                    memset(pSqsum, 0, (width + 1) * sizeof(TSqsum));
+                    continue;
+                }
+                const uint8_t * pSrc = src + (row - 1) * srcStride;
+                TSum rowSum = 0;
+                TSqsum rowSqsum = 0;
+                pSum[0] = 0;
+                pSqsum[0] = 0;
+                for (size_t col = 0; col < width; ++col)
+                {
+                    TSum value = pSrc[col];
+                    rowSum += value;
+                    rowSqsum += value * value;
+                    pSum[col + 1] = rowSum;
+                    pSqsum[col + 1] = rowSqsum;
+                }
+            }
+        }
+
+        template <class TSum> void IntegralRows(const uint8_t * src, size_t srcStride, size_t width, size_t begin, size_t end, TSum * sum, size_t sumStride)
+        {
+            for (size_t row = begin; row < end; ++row)
+            {
+                TSum * pSum = sum + row * sumStride;
+                if (row == 0)
+                {
+                    memset(pSum, 0, (width + 1) * sizeof(TSum));
+                    continue;
+                }
+                const uint8_t * pSrc = src + (row - 1) * srcStride;
+                TSum rowSum = 0;
+                pSum[0] = 0;
+                for (size_t col = 0; col < width; ++col)
+                {
+                    rowSum += pSrc[col];
+                    pSum[col + 1] = rowSum;
+                }
+            }
+        }
+
+        template <class T> void IntegralCarry(T * dst, size_t stride, size_t height, size_t begin, size_t end)
+        {
+            for (size_t row = 1; row <= height; ++row)
+            {
+                const T * prev = dst + (row - 1) * stride;
+                T * curr = dst + row * stride;
+                for (size_t col = begin; col < end; ++col)
+                    curr[col] += prev[col];
+            }
+        }
+
+        template <class TSqsum> void IntegralParallel(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint32_t * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride, size_t threadNumber)
+        {
+            Simd::Parallel(0, height + 1, [&](size_t thread, size_t begin, size_t end)
+            {
+                if (sqsum)
+                    IntegralRows(src, srcStride, width, begin, end, sum, sumStride, sqsum, sqsumStride);
+                else
+                    IntegralRows(src, srcStride, width, begin, end, sum, sumStride);
+            }, threadNumber);
+
+            Simd::Parallel(0, width + 1, [&](size_t thread, size_t begin, size_t end)
+            {
+                IntegralCarry(sum, sumStride, height, begin, end);
+                if (sqsum)
+                    IntegralCarry(sqsum, sqsumStride, height, begin, end);
+            }, threadNumber, 16);
+        }
+
+        bool IntegralParallelEnable(size_t width, size_t height, const uint8_t * tilted)
+        {
+            return tilted == NULL && width * height >= INTEGRAL_PARALLEL_AREA_MIN && GetThreadNumber() > 1;
+        }
+
+        void IntegralParallel(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+        {
+            assert(sumFormat == SimdPixelFormatInt32 && sumStride % sizeof(uint32_t) == 0);
+
+            size_t threadNumber = GetThreadNumber();
+            switch (sqsum ? sqsumFormat : SimdPixelFormatInt32)
+            {
+            case SimdPixelFormatInt32:
+                IntegralParallel<uint32_t>(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint32_t*)sqsum, sqsumStride / sizeof(uint32_t), threadNumber);
+                break;
+            case SimdPixelFormatInt64:
+                IntegralParallel<uint64_t>(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t), threadNumber);
+                break;
+            case SimdPixelFormatFloat:
+                IntegralParallel<float>(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t), (float*)sqsum, sqsumStride / sizeof(float), threadNumber);
+                break;
+            case SimdPixelFormatDouble:
+                IntegralParallel<double>(src, srcStride, width, height, (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double), threadNumber);
+                break;
+            default:
+                assert(0);
+            }
+        }
+
         void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
             uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
             SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
@@ -49,6 +163,14 @@ namespace Simd
                         IntegralSumSqsumTilted<uint32_t, double>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
                         break;
+                    case SimdPixelFormatInt64:
+                        IntegralSumSqsumTilted<uint32_t, uint64_t>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
+                        break;
+                    case SimdPixelFormatFloat:
+                        IntegralSumSqsumTilted<uint32_t, float>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (float*)sqsum, sqsumStride / sizeof(float), (uint32_t*)tilted, tiltedStride / sizeof(uint32_t));
+                        break;
                     default:
                         assert(0);
                     }
@@ -65,6 +187,14 @@ namespace Simd
                         IntegralSumSqsum<uint32_t, double>(src, srcStride, width, height,
                             (uint32_t*)sum, sumStride / sizeof(uint32_t), (double*)sqsum, sqsumStride / sizeof(double));
                         break;
+                    case SimdPixelFormatInt64:
+                        IntegralSumSqsum<uint32_t, uint64_t>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (uint64_t*)sqsum, sqsumStride / sizeof(uint64_t));
+                        break;
+                    case SimdPixelFormatFloat:
+                        IntegralSumSqsum<uint32_t, float>(src, srcStride, width, height,
+                            (uint32_t*)sum, sumStride / sizeof(uint32_t), (float*)sqsum, sqsumStride / sizeof(float));
+                        break;
                     default:
                         assert(0);
                     }
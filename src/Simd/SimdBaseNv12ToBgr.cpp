@@ -0,0 +1,98 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template <class T, size_t N, bool bgr> SIMD_INLINE void YuvToPixel(int y, int u, int v, uint8_t alpha, uint8_t* dst)
+        {
+            dst[bgr ? 0 : 2] = YuvToBlue<T>(y, u);
+            dst[1] = YuvToGreen<T>(y, u, v);
+            dst[bgr ? 2 : 0] = YuvToRed<T>(y, v);
+            if (N == 4)
+                dst[3] = alpha;
+        }
+
+        template <class T, size_t N, bool bgr> void Nv12ToPixel(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                for (size_t colY = 0, colDst = 0; colY < width; colY += 2, colDst += 2 * N)
+                {
+                    int u = uv[colY + 0], v = uv[colY + 1];
+                    YuvToPixel<T, N, bgr>(y[colY + 0], u, v, alpha, dst + colDst);
+                    YuvToPixel<T, N, bgr>(y[colY + 1], u, v, alpha, dst + colDst + N);
+                    YuvToPixel<T, N, bgr>(y[yStride + colY + 0], u, v, alpha, dst + dstStride + colDst);
+                    YuvToPixel<T, N, bgr>(y[yStride + colY + 1], u, v, alpha, dst + dstStride + colDst + N);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <size_t N, bool bgr> void Nv12ToPixel(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Nv12ToPixel<Base::Bt601, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Nv12ToPixel<Base::Bt709, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Nv12ToPixel<Base::Bt2020, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Nv12ToPixel<Base::Trect871, N, bgr>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Nv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Nv12ToPixel<3, true>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToPixel<4, true>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        void Nv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
+        {
+            Nv12ToPixel<3, false>(y, yStride, uv, uvStride, width, height, rgb, rgbStride, 0xFF, yuvType);
+        }
+
+        void Nv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Nv12ToPixel<4, false>(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+        }
+    }
+}
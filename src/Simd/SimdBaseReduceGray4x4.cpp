@@ -67,16 +67,17 @@ namespace Simd
             buffer.src1[offset] = tmp;
         }
 
-        SIMD_INLINE void ProcessMainRow(const uint8_t *s2, const uint8_t *s3, size_t x0, size_t x1, size_t x2, size_t x3, Buffer & buffer, uint8_t* dst, size_t offset)
+        template<bool max> SIMD_INLINE void ProcessMainRow(const uint8_t *s2, const uint8_t *s3, size_t x0, size_t x1, size_t x2, size_t x3, Buffer & buffer, uint8_t* dst, size_t offset)
         {
             int tmp2 = GaussianBlur(s2, x0, x1, x2, x3);
             int tmp3 = GaussianBlur(s3, x0, x1, x2, x3);
-            dst[offset] = DivideBy64(buffer.src0[offset] + 3 * (buffer.src1[offset] + tmp2) + tmp3);
+            int value = DivideBy64(buffer.src0[offset] + 3 * (buffer.src1[offset] + tmp2) + tmp3);
+            dst[offset] = max ? Max(int(dst[offset]), value) : value;
             buffer.src0[offset] = tmp2;
             buffer.src1[offset] = tmp3;
         }
 
-        void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        template<bool max> void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
         {
             assert((srcWidth + 1) / 2 == dstWidth && (srcHeight + 1) / 2 == dstHeight && srcWidth > 2);
@@ -99,12 +100,24 @@ namespace Simd
                     src3 = src2;
                 }
 
-                ProcessMainRow(src2, src3, 0, 0, 1, 2, buffer, dst, 0);
+                ProcessMainRow<max>(src2, src3, 0, 0, 1, 2, buffer, dst, 0);
                 size_t srcCol = 2, dstCol = 1;
                 for (; srcCol < srcWidth - 2; srcCol += 2, dstCol++)
-                    ProcessMainRow(src2, src3, srcCol - 1, srcCol, srcCol + 1, srcCol + 2, buffer, dst, dstCol);
-                ProcessMainRow(src2, src3, srcCol - 1, srcCol, srcWidth - 1, srcWidth - 1, buffer, dst, dstCol);
+                    ProcessMainRow<max>(src2, src3, srcCol - 1, srcCol, srcCol + 1, srcCol + 2, buffer, dst, dstCol);
+                ProcessMainRow<max>(src2, src3, srcCol - 1, srcCol, srcWidth - 1, srcWidth - 1, buffer, dst, dstCol);
             }
         }
+
+        void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            ReduceGray4x4<false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        }
+
+        void ReduceGray4x4Max(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            ReduceGray4x4<true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        }
     }
 }
@@ -0,0 +1,120 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdResizer.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        ResizerYuv420p::ResizerYuv420p(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method,
+            ResizerInitPtr resizerInit, InterleaveUvPtr interleaveUv, Nv12ToBgrPtr nv12ToBgr, Nv12ToBgrPtr nv12ToRgb, Nv12ToBgraPtr nv12ToBgra, Nv12ToBgraPtr nv12ToRgba)
+            : _dstX(dstX)
+            , _dstY(dstY)
+            , _format(format)
+            , _yuvType(yuvType)
+            , _valid(false)
+            , _y(NULL)
+            , _uv(NULL)
+            , _u(NULL)
+            , _interleaveUv(interleaveUv)
+            , _toBgr(NULL)
+            , _toBgra(NULL)
+        {
+            if (!Supported(srcX, srcY, dstX, dstY, format))
+                return;
+            _y = (Resizer*)resizerInit(srcX, srcY, dstX, dstY, 1, SimdResizeChannelByte, method);
+            if (format == SimdPixelFormatGray8)
+            {
+                _valid = _y != NULL;
+                return;
+            }
+            _uv = (Resizer*)resizerInit(srcX / 2, srcY / 2, dstX / 2, dstY / 2, 2, SimdResizeChannelByte, method);
+            _u = (Resizer*)resizerInit(srcX / 2, srcY / 2, dstX / 2, dstY / 2, 1, SimdResizeChannelByte, method);
+            switch (format)
+            {
+            case SimdPixelFormatBgr24: _toBgr = nv12ToBgr; break;
+            case SimdPixelFormatRgb24: _toBgr = nv12ToRgb; break;
+            case SimdPixelFormatBgra32: _toBgra = nv12ToBgra; break;
+            case SimdPixelFormatRgba32: _toBgra = nv12ToRgba; break;
+            default: break;
+            }
+            _buffer.Resize(dstX * dstY * 2);
+            _valid = _y && _uv && _u;
+        }
+
+        ResizerYuv420p::~ResizerYuv420p()
+        {
+            delete _y;
+            delete _uv;
+            delete _u;
+        }
+
+        bool ResizerYuv420p::Supported(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format)
+        {
+            if (srcX < 2 || srcY < 2 || dstX < 2 || dstY < 2 || (srcX | srcY | dstX | dstY) & 1)
+                return false;
+            return format == SimdPixelFormatGray8 || format == SimdPixelFormatBgr24 || format == SimdPixelFormatBgra32 ||
+                format == SimdPixelFormatRgb24 || format == SimdPixelFormatRgba32;
+        }
+
+        void ResizerYuv420p::Run(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst, size_t dstStride)
+        {
+            if (_format == SimdPixelFormatGray8)
+            {
+                _y->Run(y, yStride, dst, dstStride);
+                return;
+            }
+            size_t halfX = _dstX / 2, halfY = _dstY / 2;
+            uint8_t* dy = _buffer.data, * duv = dy + _dstX * _dstY;
+            _y->Run(y, yStride, dy, _dstX);
+            if (v)
+            {
+                uint8_t* du = duv + _dstX * halfY, * dv = du + halfX * halfY;
+                _u->Run(u, uStride, du, halfX);
+                _u->Run(v, vStride, dv, halfX);
+                _interleaveUv(du, halfX, dv, halfX, halfX, halfY, duv, _dstX);
+            }
+            else
+                _uv->Run(u, uStride, duv, _dstX);
+            if (_toBgr)
+                _toBgr(dy, _dstX, duv, _dstX, _dstX, _dstY, dst, dstStride, _yuvType);
+            else
+                _toBgra(dy, _dstX, duv, _dstX, _dstX, _dstY, dst, dstStride, 0xFF, _yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* ResizerYuv420pInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method)
+        {
+            ResizerYuv420p* resizer = new ResizerYuv420p(srcX, srcY, dstX, dstY, format, yuvType, method,
+                ResizerInit, InterleaveUv, Nv12ToBgr, Nv12ToRgb, Nv12ToBgra, Nv12ToRgba);
+            if (resizer->Valid())
+                return resizer;
+            delete resizer;
+            return NULL;
+        }
+    }
+}
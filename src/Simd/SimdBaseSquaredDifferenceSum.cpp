@@ -68,6 +68,19 @@ namespace Simd
             }
         }
 
+        void SquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums)
+        {
+            assert(size <= 0x10000);
+
+            for (size_t i = 0; i < count; ++i, b += size)
+            {
+                uint32_t sum = 0;
+                for (size_t j = 0; j < size; ++j)
+                    sum += SquaredDifference(a[j], b[j]);
+                sums[i] = sum;
+            }
+        }
+
         void SquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
         {
             size_t alignedSize = Simd::AlignLo(size, 4);
@@ -26,6 +26,9 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdAlignment.h"
 #include "Simd/SimdExp.h"
+#include "Simd/SimdSynetSoftmax32f.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -543,6 +546,109 @@ namespace Simd
 
         //---------------------------------------------------------------------
 
+        SynetSoftmax32f::SynetSoftmax32f(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+            : _outer(outer)
+            , _count(count)
+            , _inner(inner)
+            , _blockC(SynetSoftmax32fBlock(count, format))
+            , _threads(Base::GetThreadNumber())
+            , _block(0)
+            , _softmax(Base::SynetSoftmaxLayerForward)
+        {
+            if (format == SimdTensorFormatNhwc)
+            {
+                _outer = outer * inner;
+                _inner = 1;
+                _blockC = 1;
+            }
+            if (_blockC > 1 || (_threads > 1 && _outer < _threads && _inner > 1))
+            {
+                _block = Simd::Min(Simd::Min(AlignHi(DivHi(_inner, DivHi(_threads, _outer)), 16), _inner), size_t(1024));
+                _buffer.Resize(_threads * _count * _block);
+            }
+        }
+
+        void SynetSoftmax32f::Forward(const float* src, float* dst)
+        {
+            size_t size = DivHi(_count, _blockC) * _blockC * _inner;
+            if (_block == 0)
+            {
+                Parallel(0, _outer, [&](size_t thread, size_t begin, size_t end)
+                {
+                    _softmax(src + begin * size, end - begin, _count, _inner, dst + begin * size);
+                }, _threads);
+            }
+            else
+            {
+                size_t tiles = DivHi(_inner, _block);
+                Parallel(0, _outer * tiles, [&](size_t thread, size_t begin, size_t end)
+                {
+                    float* buf = _buffer.data + thread * _count * _block;
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        size_t o = i / tiles, b = i % tiles * _block, n = Simd::Min(_inner, b + _block) - b;
+                        Gather(src + o * size, b, n, buf);
+                        _softmax(buf, 1, _count, n, buf);
+                        Scatter(buf, b, n, dst + o * size);
+                    }
+                }, _threads);
+            }
+        }
+
+        void SynetSoftmax32f::Gather(const float* src, size_t offset, size_t size, float* dst) const
+        {
+            if (_blockC == 1)
+            {
+                for (size_t c = 0; c < _count; ++c)
+                    memcpy(dst + c * size, src + c * _inner + offset, size * sizeof(float));
+            }
+            else
+            {
+                for (size_t c = 0; c < _count; c += _blockC)
+                {
+                    const float* ps = src + c * _inner + offset * _blockC;
+                    size_t n = Simd::Min(_blockC, _count - c);
+                    for (size_t i = 0; i < size; ++i, ps += _blockC)
+                        for (size_t j = 0; j < n; ++j)
+                            dst[(c + j) * size + i] = ps[j];
+                }
+            }
+        }
+
+        void SynetSoftmax32f::Scatter(const float* src, size_t offset, size_t size, float* dst) const
+        {
+            if (_blockC == 1)
+            {
+                for (size_t c = 0; c < _count; ++c)
+                    memcpy(dst + c * _inner + offset, src + c * size, size * sizeof(float));
+            }
+            else
+            {
+                for (size_t c = 0; c < _count; c += _blockC)
+                {
+                    float* pd = dst + c * _inner + offset * _blockC;
+                    size_t n = Simd::Min(_blockC, _count - c);
+                    for (size_t i = 0; i < size; ++i, pd += _blockC)
+                    {
+                        size_t j = 0;
+                        for (; j < n; ++j)
+                            pd[j] = src[(c + j) * size + i];
+                        for (; j < _blockC; ++j)
+                            pd[j] = 0.0f;
+                    }
+                }
+            }
+        }
+
+        void* SynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+        {
+            if (outer == 0 || count == 0 || inner == 0 || SynetSoftmax32fBlock(count, format) == 0)
+                return NULL;
+            return new SynetSoftmax32f(outer, count, inner, format);
+        }
+
+        //---------------------------------------------------------------------
+
         template<SimdSynetUnaryOperation32fType type> void SynetUnaryOperation32fLayerForward(const float* src, size_t size, float* dst)
         {
             size_t size4 = AlignLo(size, 4);
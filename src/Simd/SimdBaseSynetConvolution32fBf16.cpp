@@ -410,6 +410,8 @@ namespace Simd
             case SimdConvolutionActivationSwish:
                 _params.data[0] = params[0];
                 break;
+            case SimdConvolutionActivationGelu:
+                break;
             default:
                 assert(0);
             }
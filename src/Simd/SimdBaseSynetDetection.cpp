@@ -0,0 +1,91 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdArray.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdBase.h"
+
+#include <algorithm>
+
+namespace Simd
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace Base
+    {
+        void SynetDetectionDecode32f(const float* loc, const float* anchor, const float* variance, size_t count, float* box)
+        {
+            for (size_t i = 0; i < count; ++i, loc += 4, anchor += 4, box += 4)
+                SynetDetectionDecodeBox(loc, anchor, variance, box);
+        }
+
+        //---------------------------------------------------------------------
+
+        size_t SynetDetectionFilter32f(const float* score, size_t size, float threshold, uint32_t* index)
+        {
+            size_t count = 0;
+            for (size_t i = 0; i < size; ++i)
+                if (score[i] > threshold)
+                    index[count++] = (uint32_t)i;
+            return count;
+        }
+
+        //---------------------------------------------------------------------
+
+        size_t SynetDetectionNms32fCommon(const float* box, const float* score, const int32_t* label, size_t count,
+            float threshold, size_t topK, uint32_t* index, SynetDetectionOverlappedPtr overlapped)
+        {
+            size_t stride = topK ? Simd::Min(topK, count) : count, size = 0;
+            Array32u order(count);
+            for (size_t i = 0; i < count; ++i)
+                order[i] = (uint32_t)i;
+            std::stable_sort(order.data, order.data + count, [score](uint32_t a, uint32_t b) { return score[a] > score[b]; });
+            Array32f kept(stride * 6);
+            for (size_t i = 0; i < count && size < stride; ++i)
+            {
+                const float* b = box + 4 * order[i];
+                float area = SynetDetectionArea(b), cls = label ? (float)label[order[i]] : 0.0f;
+                if (overlapped(b, area, cls, threshold, kept.data, stride, size))
+                    continue;
+                kept[0 * stride + size] = b[0];
+                kept[1 * stride + size] = b[1];
+                kept[2 * stride + size] = b[2];
+                kept[3 * stride + size] = b[3];
+                kept[4 * stride + size] = area;
+                kept[5 * stride + size] = cls;
+                index[size++] = order[i];
+            }
+            return size;
+        }
+
+        static bool Overlapped(const float* box, float area, float label, float threshold, const float* kept, size_t stride, size_t size)
+        {
+            return SynetDetectionOverlapped(box, area, label, threshold, kept, stride, 0, size);
+        }
+
+        size_t SynetDetectionNms32f(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index)
+        {
+            return SynetDetectionNms32fCommon(box, score, label, count, threshold, topK, index, Overlapped);
+        }
+    }
+#endif
+}
@@ -118,6 +118,7 @@ namespace Simd
         {
             for (size_t i = 0; i < 4; ++i)
                 _convolution[i] = NULL;
+            _batch = 1;
             const SimdConvolutionParameters& beg = p.conv[0];
             const SimdConvolutionParameters& end = p.conv[p.count - 1];
             _sizeS = beg.srcH * beg.srcW * beg.srcC;
@@ -138,6 +139,7 @@ namespace Simd
                 case SimdConvolutionActivationMish: Set<SimdConvolutionActivationMish>(_param, i, _convolution); break;
                 case SimdConvolutionActivationHardSigmoid: Set<SimdConvolutionActivationHardSigmoid>(_param, i, _convolution); break;
                 case SimdConvolutionActivationSwish: Set<SimdConvolutionActivationSwish>(_param, i, _convolution); break;
+                case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(_param, i, _convolution); break;
                 default: assert(0);
                 }
             }
@@ -229,6 +231,8 @@ namespace Simd
                     case SimdConvolutionActivationSwish:
                         _rParams[i].data[0] = params[i][0];
                         break;
+                    case SimdConvolutionActivationGelu:
+                        break;
                     default:
                         assert(0);
                     }
@@ -296,6 +300,7 @@ namespace Simd
                 else
                     _rParams[i].Resize(2);
             }
+            _batch = count > 1 ? Simd::RestrictRange<size_t>(L3 / 2 / ((_sizeS + _sizeD) * sizeof(float)), 1, p.conv[0].batch) : 1;
             _dp[0] = p.conv[0].activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             _dp[1] = p.conv[1].activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             _dw[0] = p.conv[0].kernelY*p.conv[0].kernelX*p.conv[0].srcC;
@@ -375,32 +380,36 @@ namespace Simd
             const MergConvParam32f & p = _param;
             float * buf0 = Buffer(buf);
             float * buf1 = buf0 + _sizeB[0];
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            for (size_t b0 = 0, B = p.conv[0].batch; b0 < B; b0 += _batch)
             {
+                size_t bN = Simd::Min(B, b0 + _batch);
                 for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
                 {
                     size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
+                    for (size_t b = b0; b < bN; ++b)
                     {
-                        size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
-                        size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1)*p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
-                        _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1, 1);
-                        if (p.add && c == 0)
+                        const float* ps = src + b * _sizeS;
+                        float* pd = dst + b * _sizeD;
+                        for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
                         {
-                            size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
-                            memcpy(dst + offset, src + offset, sizeof(float)*size);
+                            size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
+                            size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1)*p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
+                            _convolution[0](ps, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                            _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], buf1, 1);
+                            if (p.add && c == 0)
+                            {
+                                size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1)*p.conv[2].dstW * p.conv[2].dstC;
+                                memcpy(pd + offset, ps + offset, sizeof(float)*size);
+                            }
+                            if(c + maC == C)
+                                _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], pd, (maC != C || p.add) ? 0 : 1);
+                            else
+                                _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], pd, (c != 0 || p.add) ? 0 : 1);
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
                         }
-                        if(c + maC == C)
-                            _convolution[2](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (maC != C || p.add) ? 0 : 1);
-                        else
-                            _convolution[3](buf1, p.conv[2], maC, yBeg1, yEnd1, _bufH, _weight[2] + c * _dw[2], _bias[2], _params[2], dst, (c != 0 || p.add) ? 0 : 1);
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
                     }
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -445,6 +454,7 @@ namespace Simd
                 else
                     _rParams[i].Resize(2);
             }
+            _batch = count > 1 ? Simd::RestrictRange<size_t>(L3 / 2 / ((_sizeS + _sizeD) * sizeof(float)), 1, p.conv[0].batch) : 1;
             _dp[0] = p.conv[0].activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             _dp[1] = p.conv[1].activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             _dw[0] = p.conv[0].kernelY * p.conv[0].kernelX * p.conv[0].srcC;
@@ -498,23 +508,27 @@ namespace Simd
             }
             const MergConvParam32f& p = _param;
             float* buf0 = Buffer(buf);
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            for (size_t b0 = 0, B = p.conv[0].batch; b0 < B; b0 += _batch)
             {
+                size_t bN = Simd::Min(B, b0 + _batch);
                 for (size_t c = 0, C = p.conv[1].dstC; c < C; c += _maC)
                 {
                     size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
+                    for (size_t b = b0; b < bN; ++b)
                     {
-                        size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
-                        size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1) * p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
-                        _convolution[0](src, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], dst + c, 1);
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        const float* ps = src + b * _sizeS;
+                        float* pd = dst + b * _sizeD;
+                        for (size_t yBeg1 = 0, yBeg0 = 0; yBeg1 < p.conv[1].dstH;)
+                        {
+                            size_t yEnd1 = Simd::Min(yBeg1 + _yStep[1], p.conv[1].dstH);
+                            size_t yEnd0 = Simd::Min(Simd::Max(yBeg0 + _yStep[0], (_yStep[1] - 1) * p.conv[1].strideY + p.conv[1].kernelY - p.conv[1].padY), p.conv[0].dstH);
+                            _convolution[0](ps, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                            _convolution[1](buf0, p.conv[1], maC, yBeg1, yEnd1, _bufH, _weight[1] + c * _dw[1], _bias[1] + c, _params[1] + c * _dp[1], pd + c, 1);
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
+                        }
                     }
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -559,6 +573,7 @@ namespace Simd
                 else
                     _rParams[i].Resize(2);
             }
+            _batch = count > 1 ? Simd::RestrictRange<size_t>(L3 / 2 / ((_sizeS + _sizeD) * sizeof(float)), 1, p.conv[0].batch) : 1;
             _dp[0] = p.conv[0].activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             _dw[0] = p.conv[0].kernelY * p.conv[0].kernelX;
             _dw[1] = AlignHiAny(p.conv[1].dstC, 2 * _miC);
@@ -616,24 +631,28 @@ namespace Simd
             }
             const MergConvParam32f& p = _param;
             float* buf0 = Buffer(buf);
-            for (size_t b = 0; b < p.conv[0].batch; ++b)
+            for (size_t b0 = 0, B = p.conv[0].batch; b0 < B; b0 += _batch)
             {
+                size_t bN = Simd::Min(B, b0 + _batch);
                 for (size_t c = 0, C = p.conv[0].dstC; c < C; c += _maC)
                 {
                     size_t maC = Simd::Min(C, c + _maC) - c;
-                    for (size_t yBeg0 = 0; yBeg0 < p.conv[0].dstH;)
+                    for (size_t b = b0; b < bN; ++b)
                     {
-                        size_t yEnd0 = Simd::Min(yBeg0 + _yStep[0], p.conv[0].dstH);
-                        _convolution[0](src + c, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
-                        if (c + maC == C)
-                            _convolution[1](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, maC == C ? 1 : 0);
-                        else
-                            _convolution[2](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], dst, c == 0 ? 1 : 0);
-                        yBeg0 = yEnd0;
+                        const float* ps = src + b * _sizeS;
+                        float* pd = dst + b * _sizeD;
+                        for (size_t yBeg0 = 0; yBeg0 < p.conv[0].dstH;)
+                        {
+                            size_t yEnd0 = Simd::Min(yBeg0 + _yStep[0], p.conv[0].dstH);
+                            _convolution[0](ps + c, p.conv[0], maC, yBeg0, yEnd0, _bufH, _weight[0] + c * _dw[0], _bias[0] + c, _params[0] + c * _dp[0], buf0, 1);
+                            if (c + maC == C)
+                                _convolution[1](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], pd, maC == C ? 1 : 0);
+                            else
+                                _convolution[2](buf0, p.conv[1], maC, yBeg0, yEnd0, _bufH, _weight[1] + c * _dw[1], _bias[1], _params[1], pd, c == 0 ? 1 : 0);
+                            yBeg0 = yEnd0;
+                        }
                     }
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -199,6 +199,7 @@ namespace Simd
                 case SimdConvolutionActivationMish: Set<SimdConvolutionActivationMish>(_param, i, _input, _depthwise, _output[0]); break;
                 case SimdConvolutionActivationHardSigmoid: Set<SimdConvolutionActivationHardSigmoid>(_param, i, _input, _depthwise, _output[0]); break;
                 case SimdConvolutionActivationSwish: Set<SimdConvolutionActivationSwish>(_param, i, _input, _depthwise, _output[0]); break;
+                case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(_param, i, _input, _depthwise, _output[0]); break;
                 default: assert(0);
                 }
             }
@@ -400,6 +401,8 @@ namespace Simd
             case SimdConvolutionActivationSwish:
                 dst.data[0] = src[0];
                 break;
+            case SimdConvolutionActivationGelu:
+                break;
             default:
                 assert(0);
             }
@@ -462,39 +465,43 @@ namespace Simd
             uint16_t* buf2 = Allocate<uint16_t>(buffer, _sizeB[2]);
             SetGap(buffer);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b0 = 0, B = c0.batch; b0 < B; b0 += a.batch)
             {
+                size_t bN = Simd::Min(B, b0 + a.batch);
                 for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                 {
                     size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t b = b0; b < bN; ++b)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        _convert(src, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
-                        _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0], 
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
-                        _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1], 
-                            _bias[1].data + c, _params[1].data + c * a.dp[1], buf2);
-                        if (p.add && c == 0)
+                        const float* ps = src + b * _sizeS;
+                        float* pd = dst + b * _sizeD;
+                        for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
                         {
-                            size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1) * p.conv[2].dstW * p.conv[2].dstC;
-                            memcpy(dst + offset, src + offset, sizeof(float) * size);
+                            size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
+                            size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
+                            size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
+                            _convert(ps, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
+                            _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0], 
+                                _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
+                            _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1], 
+                                _bias[1].data + c, _params[1].data + c * a.dp[1], buf2);
+                            if (p.add && c == 0)
+                            {
+                                size_t offset = yBeg1 * p.conv[2].dstW * p.conv[2].dstC, size = (yEnd1 - yBeg1) * p.conv[2].dstW * p.conv[2].dstC;
+                                memcpy(pd + offset, ps + offset, sizeof(float) * size);
+                            }
+                            if (c + maC == C)
+                                _output[0](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
+                                    _bias[2].data, _params[2].data, pd, (maC != C || p.add) ? 0 : 1);
+                            else
+                                _output[1](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
+                                    _bias[2].data, _params[2].data, pd, (c != 0 || p.add) ? 0 : 1);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
                         }
-                        if (c + maC == C)
-                            _output[0](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
-                                _bias[2].data, _params[2].data, dst, (maC != C || p.add) ? 0 : 1);
-                        else
-                            _output[1](buf2, c2, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[2], 
-                                _bias[2].data, _params[2].data, dst, (c != 0 || p.add) ? 0 : 1);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
                     }
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -541,6 +548,7 @@ namespace Simd
                 if (_sizeB[0] * 2 + _sizeB[1] * 4 + _sizeB[2] * 2 <= L2)
                     break;
             }
+            a.batch = count > 1 ? Simd::RestrictRange<size_t>(L3 / 2 / ((_sizeS + _sizeD) * sizeof(float)), 1, c0.batch) : 1;
             a.dp[0] = c0.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dp[1] = c1.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dw[0] = c0.kernelY * c0.kernelX * c0.srcC;
@@ -570,28 +578,32 @@ namespace Simd
             SetGap(buffer);
             float* buf1 = Allocate<float>(buffer, _sizeB[1]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b0 = 0, B = c0.batch; b0 < B; b0 += a.batch)
             {
+                size_t bN = Simd::Min(B, b0 + a.batch);
                 for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                 {
                     size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t b = b0; b < bN; ++b)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        _convert(src, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
-                        _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0],
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
-                        _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1],
-                            _bias[1].data + c, _params[1].data + c * a.dp[1], (uint16_t*)dst);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        const float* ps = src + b * _sizeS;
+                        float* pd = dst + b * _sizeD;
+                        for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                        {
+                            size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
+                            size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
+                            size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
+                            _convert(ps, c0, yBeg0, yEnd0, buf0, a.bufH[0]);
+                            _input(buf0, c0, a, maC, yBeg1, yEnd1, _weightI.data + c * a.dw[0],
+                                _bias[0].data + c, _params[0].data + c * a.dp[0], buf1);
+                            _depthwise(buf1, c1, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[1],
+                                _bias[1].data + c, _params[1].data + c * a.dp[1], (uint16_t*)pd);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
+                        }
                     }
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -635,6 +647,7 @@ namespace Simd
                 if (_sizeB[0] * 2 + _sizeB[1] * 4 <= L2)
                     break;
             }
+            a.batch = count > 1 ? Simd::RestrictRange<size_t>(L3 / 2 / ((_sizeS + _sizeD) * sizeof(float)), 1, c0.batch) : 1;
             a.dp[0] = c0.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dp[1] = c1.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dw[0] = c0.kernelY * c0.kernelX * c0.srcC;
@@ -662,29 +675,33 @@ namespace Simd
             uint16_t* buf2 = Allocate<uint16_t>(buffer, _sizeB[2]);
             SetGap(buffer);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b0 = 0, B = c0.batch; b0 < B; b0 += a.batch)
             {
+                size_t bN = Simd::Min(B, b0 + a.batch);
                 for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
                 {
                     size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t b = b0; b < bN; ++b)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c0.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c0.srcH);
-                        _depthwise(src + c, c0, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[0], _bias[0].data + c,
-                            _params[0].data + c * a.dp[0], buf2);
-                        if (c + maC == C)
-                            _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
-                                _bias[1].data, _params[1].data, dst, maC != C ? 0 : 1);
-                        else
-                            _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
-                                _bias[1].data, _params[1].data, dst, c != 0 ? 0 : 1);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
+                        const float* ps = src + b * _sizeS;
+                        float* pd = dst + b * _sizeD;
+                        for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                        {
+                            size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c0.dstH);
+                            size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c0.srcH);
+                            _depthwise(ps + c, c0, a, maC, yBeg2, yEnd2, _weightD.data + c * a.dw[0], _bias[0].data + c,
+                                _params[0].data + c * a.dp[0], buf2);
+                            if (c + maC == C)
+                                _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
+                                    _bias[1].data, _params[1].data, pd, maC != C ? 0 : 1);
+                            else
+                                _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weightO.data + c * a.dw[1],
+                                    _bias[1].data, _params[1].data, pd, c != 0 ? 0 : 1);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                        }
                     }
                 }
-                src += _sizeS;
-                dst += _sizeD;
             }
         }
 
@@ -728,6 +745,7 @@ namespace Simd
             a.bufH[1] = 0;
             _sizeB[0] = 0;
             _sizeB[1] = 0;
+            a.batch = count > 1 ? Simd::RestrictRange<size_t>(L3 / 2 / ((_sizeS + _sizeD) * sizeof(float)), 1, c0.batch) : 1;
             a.dp[0] = c0.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dp[1] = c1.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dw[0] = c0.kernelY * c0.kernelX;
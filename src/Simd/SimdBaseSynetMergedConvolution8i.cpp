@@ -90,6 +90,7 @@ namespace Simd
             case SimdConvolutionActivationMish: _depthwise = DepthwiseConvolution<SimdConvolutionActivationMish>; break;
             case SimdConvolutionActivationHardSigmoid: _depthwise = DepthwiseConvolution<SimdConvolutionActivationHardSigmoid>; break;
             case SimdConvolutionActivationSwish: _depthwise = DepthwiseConvolution<SimdConvolutionActivationSwish>; break;
+            case SimdConvolutionActivationGelu: _depthwise = DepthwiseConvolution<SimdConvolutionActivationGelu>; break;
             default: assert(0);
             }
 
@@ -211,6 +212,8 @@ namespace Simd
                 case SimdConvolutionActivationSwish:
                     _params[i][0] = params[i][0];
                     break;
+                case SimdConvolutionActivationGelu:
+                    break;
                 default:
                     assert(0);
                 }
@@ -479,6 +482,9 @@ namespace Simd
             case SimdConvolutionActivationSwish:
                 SynetSwish32f(dst, sizeD, params, dst);
                 break;
+            case SimdConvolutionActivationGelu:
+                SynetGelu32f(dst, sizeD, dst);
+                break;
             default:
                 assert(0);
             }
@@ -505,35 +511,39 @@ namespace Simd
             uint8_t* buf3 = Allocate<uint8_t>(buf, _sizeB[3]);
             int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b0 = 0, B = c0.batch; b0 < B; b0 += a.batch)
             {
+                size_t bN = Simd::Min(B, b0 + a.batch);
                 for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                 {
                     size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t b = b0; b < bN; ++b)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        if (!_s8u)
-                            _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
-                        _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c, 
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
-                        _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c, 
-                            _params[1].data + c * a.dp[1], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf3);
-                        if (c + maC == C)
-                            _output[0](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data, 
-                                _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, maC == C ? 1 : 0);
-                        else
-                            _output[1](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data,
-                                _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        const uint8_t* ps = src + b * _sizeS * (_s8u ? 1 : 4);
+                        uint8_t* pd = dst + b * _sizeD * (_d8u ? 1 : 4);
+                        for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                        {
+                            size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
+                            size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
+                            size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
+                            if (!_s8u)
+                                _cvt32fTo8u((float*)ps, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
+                            _input(_s8u ? ps : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c, 
+                                _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
+                            _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c, 
+                                _params[1].data + c * a.dp[1], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf3);
+                            if (c + maC == C)
+                                _output[0](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data, 
+                                    _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4 + (b - b0) * _sizeD, pd, maC == C ? 1 : 0);
+                            else
+                                _output[1](buf3, c2, a, maC, yBeg2, yEnd2, _weight8i[1].data + c * a.dw[2], _norm[1].data, _bias[2].data,
+                                    _params[2].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4 + (b - b0) * _sizeD, pd, c == 0 ? 1 : 0);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
+                        }
                     }
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
             }
         }
 
@@ -580,7 +590,8 @@ namespace Simd
                     break;
             }
             _sizeB[1] = 0;
-            _sizeB[4] = count > 1 ? _sizeD : 0;
+            a.batch = count > 1 ? Simd::RestrictRange<size_t>(L3 / 2 / (_sizeS * (_s8u ? 1 : 4) + _sizeD * ((_d8u ? 1 : 4) + 4)), 1, c0.batch) : 1;
+            _sizeB[4] = count > 1 ? _sizeD * a.batch : 0;
             a.dp[0] = c0.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dp[1] = c1.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dw[0] = c0.kernelY * c0.kernelX * c0.srcC;
@@ -607,29 +618,33 @@ namespace Simd
             float* buf0 = Allocate<float>(buf, _sizeB[0]);
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b0 = 0, B = c0.batch; b0 < B; b0 += a.batch)
             {
+                size_t bN = Simd::Min(B, b0 + a.batch);
                 for (size_t c = 0, C = c1.dstC; c < C; c += a.maC)
                 {
                     size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                    for (size_t b = b0; b < bN; ++b)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
-                        size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
-                        if (!_s8u)
-                            _cvt32fTo8u((float*)src, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
-                        _input(_s8u ? src : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c,
-                            _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
-                        _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c,
-                            _params[1].data + c * a.dp[1], _cvt[2].scale.data + c, _cvt[2].shift.data + c, dst + c);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
-                        yBeg0 = yEnd0;
+                        const uint8_t* ps = src + b * _sizeS * (_s8u ? 1 : 4);
+                        uint8_t* pd = dst + b * _sizeD * (_d8u ? 1 : 4);
+                        for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c1.dstH;)
+                        {
+                            size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c1.dstH);
+                            size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c1.srcH);
+                            size_t yEnd0 = Simd::RestrictRange(yBeg0 + a.yStep[0], a.yStart[0], c0.srcH);
+                            if (!_s8u)
+                                _cvt32fTo8u((float*)ps, yBeg0, yEnd0, c0.srcW, c0.srcC, _cvt[0].scale.data, _cvt[0].shift.data, buf2, a.bufH[0], c0.compatibility);
+                            _input(_s8u ? ps : buf2, c0, a, maC, yBeg1, yEnd1, _weight8i[0].data + c * a.dw[0], _norm[0].data + c,
+                                _bias[0].data + c, _params[0].data + c * a.dp[0], buf0);
+                            _depthwise(buf0, c1, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[1], _bias[1].data + c,
+                                _params[1].data + c * a.dp[1], _cvt[2].scale.data + c, _cvt[2].shift.data + c, pd + c);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                            yBeg0 = yEnd0;
+                        }
                     }
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
             }
         }
 
@@ -677,6 +692,7 @@ namespace Simd
             _sizeB[1] = 0;
             _sizeB[3] = 0;
             _sizeB[4] = 0;
+            a.batch = count > 1 ? Simd::RestrictRange<size_t>(L3 / 2 / (_sizeS * (_s8u ? 1 : 4) + _sizeD * (_d8u ? 1 : 4)), 1, c0.batch) : 1;
             a.dp[0] = c0.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dp[1] = c1.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dw[0] = c0.kernelY * c0.kernelX * c0.srcC;
@@ -703,32 +719,36 @@ namespace Simd
             uint8_t* buf2 = Allocate<uint8_t>(buf, _sizeB[2]);
             int32_t* buf4 = Allocate<int32_t>(buf, _sizeB[4]);
 
-            for (size_t b = 0; b < c0.batch; ++b)
+            for (size_t b0 = 0, B = c0.batch; b0 < B; b0 += a.batch)
             {
+                size_t bN = Simd::Min(B, b0 + a.batch);
                 for (size_t c = 0, C = c0.dstC; c < C; c += a.maC)
                 {
                     size_t maC = Simd::Min(C, c + a.maC) - c;
-                    for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c0.dstH;)
+                    for (size_t b = b0; b < bN; ++b)
                     {
-                        size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c0.dstH);
-                        size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c0.srcH);
-                        if (_s8u)
-                            _cvt8uTo32f(src + c, maC, yBeg1, yEnd1, c0.srcW, c0.srcC, _cvt[0].iScale.data + c, 
-                                _cvt[0].iShift.data + c, buf0, a.bufH[1], c0.compatibility);
-                        _depthwise(_s8u ? buf0 : (float*)src + c, c0, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[0], _bias[0].data + c,
-                            _params[0].data + c * a.dp[0], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf2);
-                        if (c + maC == C)
-                            _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
-                                _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, maC == C ? 1 : 0);
-                        else
-                            _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
-                                _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4, dst, c == 0 ? 1 : 0);
-                        yBeg2 = yEnd2;
-                        yBeg1 = yEnd1;
+                        const uint8_t* ps = src + b * _sizeS * (_s8u ? 1 : 4);
+                        uint8_t* pd = dst + b * _sizeD * (_d8u ? 1 : 4);
+                        for (size_t yBeg2 = 0, yBeg1 = 0, yBeg0 = 0; yBeg2 < c0.dstH;)
+                        {
+                            size_t yEnd2 = Simd::RestrictRange(yBeg2 + a.yStep[2], a.yStart[2], c0.dstH);
+                            size_t yEnd1 = Simd::RestrictRange(yBeg1 + a.yStep[1], a.yStart[1], c0.srcH);
+                            if (_s8u)
+                                _cvt8uTo32f(ps + c, maC, yBeg1, yEnd1, c0.srcW, c0.srcC, _cvt[0].iScale.data + c, 
+                                    _cvt[0].iShift.data + c, buf0, a.bufH[1], c0.compatibility);
+                            _depthwise(_s8u ? buf0 : (float*)ps + c, c0, a, maC, yBeg2, yEnd2, _weight32f.data + c * a.dw[0], _bias[0].data + c,
+                                _params[0].data + c * a.dp[0], _cvt[1].scale.data + c, _cvt[1].shift.data + c, buf2);
+                            if (c + maC == C)
+                                _output[0](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
+                                    _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4 + (b - b0) * _sizeD, pd, maC == C ? 1 : 0);
+                            else
+                                _output[1](buf2, c1, a, maC, yBeg2, yEnd2, _weight8i[0].data + c * a.dw[1], _norm[0].data, _bias[1].data,
+                                    _params[1].data, _cvt[2].scale.data, _cvt[2].shift.data, buf4 + (b - b0) * _sizeD, pd, c == 0 ? 1 : 0);
+                            yBeg2 = yEnd2;
+                            yBeg1 = yEnd1;
+                        }
                     }
                 }
-                src += _sizeS * (_s8u ? 1 : 4);
-                dst += _sizeD * (_d8u ? 1 : 4);
             }
         }
 
@@ -771,7 +791,8 @@ namespace Simd
             a.bufH[0] = 0;
             _sizeB[1] = 0;
             _sizeB[3] = 0;
-            _sizeB[4] = count > 1 ? _sizeD : 0;
+            a.batch = count > 1 ? Simd::RestrictRange<size_t>(L3 / 2 / (_sizeS * (_s8u ? 1 : 4) + _sizeD * ((_d8u ? 1 : 4) + 4)), 1, c0.batch) : 1;
+            _sizeB[4] = count > 1 ? _sizeD * a.batch : 0;
             a.dp[0] = c0.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dp[1] = c1.activation == ::SimdConvolutionActivationPrelu ? 1 : 0;
             a.dw[0] = c0.kernelY * c0.kernelX;
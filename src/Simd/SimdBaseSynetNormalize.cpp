@@ -23,6 +23,8 @@
 */
 #include "Simd/SimdArray.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetConvolution32f.h"
+#include "Simd/SimdSynetConvolution32fCommon.h"
 
 namespace Simd
 {
@@ -126,6 +128,199 @@ namespace Simd
             else
                 assert(0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdConvolutionActivationType type> void NormalizeV2(const float* src, size_t batch, size_t channels, size_t spatial, 
+            const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, const float* params, float* buf, float* dst)
+        {
+            float _eps = eps[0], k = 1.0f / float(channels);
+            if (format == SimdTensorFormatNchw)
+            {
+                Array32f _buf;
+                if (buf == NULL)
+                {
+                    _buf.Resize(spatial * 2);
+                    buf = _buf.data;
+                }
+                float* mean = buf, * norm = buf + spatial;
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                        mean[s] = 0.0f, norm[s] = 0.0f;
+                    for (size_t c = 0, o = 0; c < channels; ++c)
+                        for (size_t s = 0; s < spatial; ++s, ++o)
+                            mean[s] += src[o];
+                    for (size_t s = 0; s < spatial; ++s)
+                        mean[s] *= k;
+                    for (size_t c = 0, o = 0; c < channels; ++c)
+                        for (size_t s = 0; s < spatial; ++s, ++o)
+                            norm[s] += Simd::Square(src[o] - mean[s]);
+                    for (size_t s = 0; s < spatial; ++s)
+                        norm[s] = 1.0f / ::sqrt(norm[s] * k + _eps);
+                    for (size_t c = 0, o = 0; c < channels; ++c)
+                        for (size_t s = 0; s < spatial; ++s, ++o)
+                            dst[o] = Activate<type>((src[o] - mean[s]) * norm[s] * scale[c] + shift[c], params, c);
+                    src += channels * spatial;
+                    dst += channels * spatial;
+                }
+            }
+            else if (format == SimdTensorFormatNhwc)
+            {
+                for (size_t b = 0; b < batch; ++b)
+                {
+                    for (size_t s = 0; s < spatial; ++s)
+                    {
+                        float sum = 0.0f;
+                        for (size_t c = 0; c < channels; ++c)
+                            sum += src[c];
+                        float mean = sum * k;
+                        float sqsum = 0.0f;
+                        for (size_t c = 0; c < channels; ++c)
+                            sqsum += Simd::Square(src[c] - mean);
+                        float norm = 1.0f / ::sqrt(sqsum * k + _eps);
+                        for (size_t c = 0; c < channels; ++c)
+                            dst[c] = Activate<type>((src[c] - mean) * norm * scale[c] + shift[c], params, c);
+                        src += channels;
+                        dst += channels;
+                    }
+                }
+            }
+            else
+                assert(0);
+        }
+
+        void SynetNormalizeLayerForwardV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: NormalizeV2<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRelu: NormalizeV2<SimdConvolutionActivationRelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationLeakyRelu: NormalizeV2<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRestrictRange: NormalizeV2<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationPrelu: NormalizeV2<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationElu: NormalizeV2<SimdConvolutionActivationElu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHswish: NormalizeV2<SimdConvolutionActivationHswish>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationMish: NormalizeV2<SimdConvolutionActivationMish>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHardSigmoid: NormalizeV2<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationSwish: NormalizeV2<SimdConvolutionActivationSwish>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationGelu: NormalizeV2<SimdConvolutionActivationGelu>(src, batch, channels, spatial, scale, shift, eps, format, params, buf, dst); break;
+            default:
+                assert(0);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template<SimdConvolutionActivationType type> void NormalizeV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, 
+            const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, const float* params, float* buf, float* dst)
+        {
+            assert(channels % group == 0);
+            Array32f _buf;
+            if (buf == NULL)
+            {
+                _buf.Resize(channels * 2);
+                buf = _buf.data;
+            }
+            float* alpha = buf, * beta = buf + channels;
+            size_t size = channels / group;
+            float _eps = eps[0], k = 1.0f / float(size * spatial);
+            for (size_t b = 0; b < batch; ++b)
+            {
+                if (format == SimdTensorFormatNchw)
+                {
+                    for (size_t c = 0, o = 0; c < channels; ++c)
+                    {
+                        float sum = 0.0f;
+                        for (size_t s = 0; s < spatial; ++s, ++o)
+                            sum += src[o];
+                        alpha[c] = sum;
+                    }
+                }
+                else
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                        alpha[c] = 0.0f;
+                    for (size_t s = 0, o = 0; s < spatial; ++s)
+                        for (size_t c = 0; c < channels; ++c, ++o)
+                            alpha[c] += src[o];
+                }
+                for (size_t g = 0; g < group; ++g)
+                {
+                    float sum = 0.0f;
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                        sum += alpha[c];
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                        beta[c] = sum * k;
+                }
+                if (format == SimdTensorFormatNchw)
+                {
+                    for (size_t c = 0, o = 0; c < channels; ++c)
+                    {
+                        float sum = 0.0f;
+                        for (size_t s = 0; s < spatial; ++s, ++o)
+                            sum += Simd::Square(src[o] - beta[c]);
+                        alpha[c] = sum;
+                    }
+                }
+                else
+                {
+                    for (size_t c = 0; c < channels; ++c)
+                        alpha[c] = 0.0f;
+                    for (size_t s = 0, o = 0; s < spatial; ++s)
+                        for (size_t c = 0; c < channels; ++c, ++o)
+                            alpha[c] += Simd::Square(src[o] - beta[c]);
+                }
+                for (size_t g = 0; g < group; ++g)
+                {
+                    float sum = 0.0f;
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                        sum += alpha[c];
+                    float norm = 1.0f / ::sqrt(sum * k + _eps);
+                    for (size_t c = g * size, e = c + size; c < e; ++c)
+                    {
+                        alpha[c] = scale[c] * norm;
+                        beta[c] = shift[c] - beta[c] * alpha[c];
+                    }
+                }
+                if (format == SimdTensorFormatNchw)
+                {
+                    for (size_t c = 0, o = 0; c < channels; ++c)
+                        for (size_t s = 0; s < spatial; ++s, ++o)
+                            dst[o] = Activate<type>(src[o] * alpha[c] + beta[c], params, c);
+                }
+                else
+                {
+                    for (size_t s = 0, o = 0; s < spatial; ++s)
+                        for (size_t c = 0; c < channels; ++c, ++o)
+                            dst[o] = Activate<type>(src[o] * alpha[c] + beta[c], params, c);
+                }
+                src += channels * spatial;
+                dst += channels * spatial;
+            }
+        }
+
+        void SynetNormalizeLayerForwardV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+            const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+        {
+            switch (activation)
+            {
+            case SimdConvolutionActivationIdentity: NormalizeV3<SimdConvolutionActivationIdentity>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRelu: NormalizeV3<SimdConvolutionActivationRelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationLeakyRelu: NormalizeV3<SimdConvolutionActivationLeakyRelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationRestrictRange: NormalizeV3<SimdConvolutionActivationRestrictRange>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationPrelu: NormalizeV3<SimdConvolutionActivationPrelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationElu: NormalizeV3<SimdConvolutionActivationElu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHswish: NormalizeV3<SimdConvolutionActivationHswish>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationMish: NormalizeV3<SimdConvolutionActivationMish>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationHardSigmoid: NormalizeV3<SimdConvolutionActivationHardSigmoid>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationSwish: NormalizeV3<SimdConvolutionActivationSwish>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            case SimdConvolutionActivationGelu: NormalizeV3<SimdConvolutionActivationGelu>(src, batch, channels, spatial, group, scale, shift, eps, format, params, buf, dst); break;
+            default:
+                assert(0);
+            }
+        }
     }
 #endif
 }
@@ -24,6 +24,9 @@
 #include "Simd/SimdArray.h"
 #include "Simd/SimdPow.h"
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetPooling32f.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
 
 namespace Simd
 {
@@ -243,6 +246,125 @@ namespace Simd
         {
             SynetPoolingMax2D(src, srcC, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dst, dstH, dstW, format);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetPooling32f::SynetPooling32f(const Pooling32fParam& param)
+            : _param(param)
+            , _poolingMax(Base::SynetPoolingMax32f)
+            , _poolingAverage(Base::SynetPoolingAverage)
+            , _threads(Base::GetThreadNumber())
+        {
+            const Pooling32fParam& p = _param;
+            _block = p.Block();
+            _count = p.batch * DivHi(p.channels, _block);
+            _tiles = 1;
+            if (p.format != SimdTensorFormatNchw && _count < _threads)
+            {
+                _tiles = Simd::Min(DivHi(_threads, _count), p.IsGlobal() ? p.srcH : p.dstH);
+                if (p.IsGlobal() && _tiles > 1)
+                    _buffer.Resize(_count * _tiles * _block);
+            }
+        }
+
+        void SynetPooling32f::Forward(const float* src, float* dst)
+        {
+            const Pooling32fParam& p = _param;
+            if (p.format == SimdTensorFormatNchw)
+            {
+                size_t srcS = p.srcH * p.srcW, dstS = p.dstH * p.dstW;
+                Parallel(0, _count, [&](size_t thread, size_t begin, size_t end)
+                {
+                    PoolingRows(src + begin * srcS, end - begin, 0, p.dstH, SimdTensorFormatNchw, dst + begin * dstS);
+                }, _threads);
+            }
+            else if (_buffer.size)
+                PoolingGlobal(src, dst);
+            else
+            {
+                size_t srcI = p.srcH * p.srcW * _block, dstI = p.dstH * p.dstW * _block;
+                Parallel(0, _count * _tiles, [&](size_t thread, size_t begin, size_t end)
+                {
+                    for (size_t i = begin; i < end; ++i)
+                    {
+                        size_t n = i / _tiles, t = i % _tiles;
+                        size_t dstY = t * p.dstH / _tiles, dstE = (t + 1) * p.dstH / _tiles;
+                        PoolingRows(src + n * srcI, _block, dstY, dstE, SimdTensorFormatNhwc, dst + n * dstI + dstY * p.dstW * _block);
+                    }
+                }, _threads);
+            }
+        }
+
+        void SynetPooling32f::PoolingRows(const float* src, size_t channels, size_t dstY, size_t dstE, SimdTensorFormatType format, float* dst)
+        {
+            const Pooling32fParam& p = _param;
+            ptrdiff_t srcY = dstY * p.strideY - p.padY;
+            size_t padY = srcY < 0 ? -srcY : 0, srcH = p.srcH;
+            if (srcY > 0)
+            {
+                src += srcY * p.srcW * channels;
+                srcH -= srcY;
+            }
+            if (p.method == SimdSynetPoolingMethodMax)
+                _poolingMax(src, channels, srcH, p.srcW, 1, p.kernelY, p.kernelX, 1, p.strideY, p.strideX, 
+                    0, padY, p.padX, dst, channels, dstE - dstY, p.dstW, format);
+            else
+                _poolingAverage(src, channels, srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX, 
+                    padY, p.padX, dst, dstE - dstY, p.dstW, p.excludePad, format);
+        }
+
+        void SynetPooling32f::PoolingGlobal(const float* src, float* dst)
+        {
+            const Pooling32fParam& p = _param;
+            size_t srcI = p.srcH * p.srcW * _block;
+            float* buf = _buffer.data;
+            Parallel(0, _count * _tiles, [&](size_t thread, size_t begin, size_t end)
+            {
+                for (size_t i = begin; i < end; ++i)
+                {
+                    size_t n = i / _tiles, t = i % _tiles;
+                    size_t srcY = t * p.srcH / _tiles, srcH = (t + 1) * p.srcH / _tiles - srcY;
+                    const float* ps = src + n * srcI + srcY * p.srcW * _block;
+                    if (p.method == SimdSynetPoolingMethodMax)
+                        _poolingMax(ps, _block, srcH, p.srcW, 1, srcH, p.srcW, 1, 1, 1, 0, 0, 0, buf + i * _block, _block, 1, 1, SimdTensorFormatNhwc);
+                    else
+                        _poolingAverage(ps, _block, srcH, p.srcW, srcH, p.srcW, 1, 1, 0, 0, buf + i * _block, 1, 1, SimdTrue, SimdTensorFormatNhwc);
+                }
+            }, _threads);
+            for (size_t n = 0; n < _count; ++n, buf += _tiles * _block, dst += _block)
+            {
+                if (p.method == SimdSynetPoolingMethodMax)
+                {
+                    for (size_t c = 0; c < _block; ++c)
+                        dst[c] = buf[c];
+                    for (size_t t = 1; t < _tiles; ++t)
+                        for (size_t c = 0; c < _block; ++c)
+                            dst[c] = Simd::Max(dst[c], buf[t * _block + c]);
+                }
+                else
+                {
+                    for (size_t c = 0; c < _block; ++c)
+                        dst[c] = 0.0f;
+                    for (size_t t = 0; t < _tiles; ++t)
+                    {
+                        float k = float((t + 1) * p.srcH / _tiles - t * p.srcH / _tiles) / float(p.srcH);
+                        for (size_t c = 0; c < _block; ++c)
+                            dst[c] += buf[t * _block + c] * k;
+                    }
+                }
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX,
+            size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format)
+        {
+            Pooling32fParam param(batch, channels, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dstH, dstW, method, excludePad, format);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPooling32f(param);
+        }
     }
 #endif
 }
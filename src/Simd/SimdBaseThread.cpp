@@ -23,6 +23,7 @@
 */
 #include "Simd/SimdMath.h"
 #include "Simd/SimdBase.h"
+#include "Simd/SimdParallelRows.h"
 
 #include <thread>
 
@@ -41,5 +42,36 @@ namespace Simd
         {
             g_threadNumber = Simd::RestrictRange<size_t>(threadNumber, 1, std::thread::hardware_concurrency());
         }
+
+        size_t g_parallelThreshold = 0;
+
+        size_t GetParallelThreshold()
+        {
+            return g_parallelThreshold;
+        }
+
+        void SetParallelThreshold(size_t area)
+        {
+            g_parallelThreshold = area;
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        static thread_local bool g_parallelRowsWorker = false;
+
+        ParallelRowsWorker::ParallelRowsWorker()
+        {
+            g_parallelRowsWorker = true;
+        }
+
+        ParallelRowsWorker::~ParallelRowsWorker()
+        {
+            g_parallelRowsWorker = false;
+        }
+
+        bool ParallelRowsEnable(size_t width, size_t height)
+        {
+            return g_parallelThreshold && width * height >= g_parallelThreshold && g_threadNumber > 1 && !g_parallelRowsWorker;
+        }
     }
 }
@@ -0,0 +1,215 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdYuvToBgr.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        template<class T> SIMD_INLINE int Yuv10ToBlue32(int y, int u)
+        {
+            return T::Y_2_A * (y - 4 * T::Y_LO) + T::U_2_B * (u - 4 * T::UV_Z);
+        }
+
+        template<class T> SIMD_INLINE int Yuv10ToGreen32(int y, int u, int v)
+        {
+            return T::Y_2_A * (y - 4 * T::Y_LO) + T::U_2_G * (u - 4 * T::UV_Z) + T::V_2_G * (v - 4 * T::UV_Z);
+        }
+
+        template<class T> SIMD_INLINE int Yuv10ToRed32(int y, int v)
+        {
+            return T::Y_2_A * (y - 4 * T::Y_LO) + T::V_2_R * (v - 4 * T::UV_Z);
+        }
+
+        template<class T> SIMD_INLINE int Yuv10ToU8(int value)
+        {
+            return RestrictRange((value + 4 * T::F_ROUND) >> (T::F_SHIFT + 2));
+        }
+
+        template<class T, size_t N> SIMD_INLINE void Yuv10ToBgr(int y, int u, int v, uint8_t alpha, uint8_t* dst)
+        {
+            dst[0] = Yuv10ToU8<T>(Yuv10ToBlue32<T>(y, u));
+            dst[1] = Yuv10ToU8<T>(Yuv10ToGreen32<T>(y, u, v));
+            dst[2] = Yuv10ToU8<T>(Yuv10ToRed32<T>(y, v));
+            if (N == 4)
+                dst[3] = alpha;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, size_t N> void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint16_t* y0 = (const uint16_t*)y;
+                const uint16_t* y1 = (const uint16_t*)(y + yStride);
+                const uint16_t* _uv = (const uint16_t*)uv;
+                uint8_t* dst0 = dst, * dst1 = dst + dstStride;
+                for (size_t col = 0; col < width; col += 2)
+                {
+                    int u = _uv[col + 0] >> 6, v = _uv[col + 1] >> 6;
+                    Yuv10ToBgr<T, N>(y0[col + 0] >> 6, u, v, alpha, dst0 + (col + 0) * N);
+                    Yuv10ToBgr<T, N>(y0[col + 1] >> 6, u, v, alpha, dst0 + (col + 1) * N);
+                    Yuv10ToBgr<T, N>(y1[col + 0] >> 6, u, v, alpha, dst1 + (col + 0) * N);
+                    Yuv10ToBgr<T, N>(y1[col + 1] >> 6, u, v, alpha, dst1 + (col + 1) * N);
+                }
+                y += 2 * yStride;
+                uv += uvStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <size_t N> void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P010ToBgr<Base::Bt601, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt709: P010ToBgr<Base::Bt709, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: P010ToBgr<Base::Bt2020, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: P010ToBgr<Base::Trect871, N>(y, yStride, uv, uvStride, width, height, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void P010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            P010ToBgr<3>(y, yStride, uv, uvStride, width, height, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void P010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            P010ToBgr<4>(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T, size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2) && (bitDepth >= 10) && (bitDepth <= 16));
+
+            int shift = int(bitDepth) - 10;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                const uint16_t* y0 = (const uint16_t*)y;
+                const uint16_t* y1 = (const uint16_t*)(y + yStride);
+                const uint16_t* u16 = (const uint16_t*)u;
+                const uint16_t* v16 = (const uint16_t*)v;
+                uint8_t* dst0 = dst, * dst1 = dst + dstStride;
+                for (size_t col = 0; col < width; col += 2)
+                {
+                    int _u = u16[col / 2] >> shift, _v = v16[col / 2] >> shift;
+                    Yuv10ToBgr<T, N>(y0[col + 0] >> shift, _u, _v, alpha, dst0 + (col + 0) * N);
+                    Yuv10ToBgr<T, N>(y0[col + 1] >> shift, _u, _v, alpha, dst0 + (col + 1) * N);
+                    Yuv10ToBgr<T, N>(y1[col + 0] >> shift, _u, _v, alpha, dst1 + (col + 0) * N);
+                    Yuv10ToBgr<T, N>(y1[col + 1] >> shift, _u, _v, alpha, dst1 + (col + 1) * N);
+                }
+                y += 2 * yStride;
+                u += uStride;
+                v += vStride;
+                dst += 2 * dstStride;
+            }
+        }
+
+        template <size_t N> void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: Yuv420p16ToBgr<Base::Bt601, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            case SimdYuvBt709: Yuv420p16ToBgr<Base::Bt709, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            case SimdYuvBt2020: Yuv420p16ToBgr<Base::Bt2020, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            case SimdYuvTrect871: Yuv420p16ToBgr<Base::Trect871, N>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, dst, dstStride, alpha); break;
+            default:
+                assert(0);
+            }
+        }
+
+        void Yuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+        {
+            Yuv420p16ToBgr<3>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, 0xFF, yuvType);
+        }
+
+        void Yuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+            size_t width, size_t height, size_t bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+        {
+            Yuv420p16ToBgr<4>(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        template <class T> void P010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride,
+            size_t width, size_t height, const float* lower, const float* upper, float* dst, SimdBool rgb)
+        {
+            assert((width % 2 == 0) && (height % 2 == 0) && (width >= 2) && (height >= 2));
+
+            const int max = 255 * 4 * T::F_RANGE;
+            size_t size = width * height, ib = rgb ? 2 : 0, ir = rgb ? 0 : 2;
+            float scaleB = (upper[ib] - lower[ib]) / float(max), shiftB = lower[ib];
+            float scaleG = (upper[1] - lower[1]) / float(max), shiftG = lower[1];
+            float scaleR = (upper[ir] - lower[ir]) / float(max), shiftR = lower[ir];
+            float* b = dst + ib * size, * g = dst + size, * r = dst + ir * size;
+            for (size_t row = 0; row < height; row += 1)
+            {
+                const uint16_t* y16 = (const uint16_t*)y;
+                const uint16_t* uv16 = (const uint16_t*)uv;
+                for (size_t col = 0; col < width; col += 1)
+                {
+                    int _y = y16[col] >> 6, _u = uv16[col & (~1)] >> 6, _v = uv16[col | 1] >> 6;
+                    b[col] = float(RestrictRange(Yuv10ToBlue32<T>(_y, _u), 0, max)) * scaleB + shiftB;
+                    g[col] = float(RestrictRange(Yuv10ToGreen32<T>(_y, _u, _v), 0, max)) * scaleG + shiftG;
+                    r[col] = float(RestrictRange(Yuv10ToRed32<T>(_y, _v), 0, max)) * scaleR + shiftR;
+                }
+                y += yStride;
+                if (row & 1)
+                    uv += uvStride;
+                b += width;
+                g += width;
+                r += width;
+            }
+        }
+
+        void P010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+            const float* lower, const float* upper, float* dst, SimdBool rgb, SimdYuvType yuvType)
+        {
+            switch (yuvType)
+            {
+            case SimdYuvBt601: P010ToPlanar32f<Base::Bt601>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            case SimdYuvBt709: P010ToPlanar32f<Base::Bt709>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            case SimdYuvBt2020: P010ToPlanar32f<Base::Bt2020>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            case SimdYuvTrect871: P010ToPlanar32f<Base::Trect871>(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb); break;
+            default:
+                assert(0);
+            }
+        }
+    }
+}
@@ -133,6 +133,24 @@ namespace Simd
             dst11[1] = BayerToGreen(src[3][col2], src[2][col3], src[3][col4], src[4][col3], src[3][col1], src[1][col3], src[3][col5], src[5][col3]);
             dst11[2] = src[3][col3];
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        const int BAYER16_GAIN_SHIFT = 12;
+        const int BAYER16_GAIN_MAX = (8 << BAYER16_GAIN_SHIFT) - 1;
+
+        typedef void(*Bayer16GainPtr)(const uint16_t* src, size_t width, const uint32_t gain[2], uint32_t max, uint16_t* dst);
+        typedef void(*Bayer16DemosaicPtr)(const uint16_t* src[5], size_t width, bool malvar, bool red, bool greenFirst, int shift, int max, uint16_t* b, uint16_t* g, uint16_t* r);
+        typedef void(*Bayer16StorePtr)(const uint16_t* b, const uint16_t* g, const uint16_t* r, size_t width, size_t bgrDepth, uint8_t* bgr);
+
+        void Bayer16GainRow(const uint16_t* src, size_t width, const uint32_t gain[2], uint32_t max, uint16_t* dst);
+
+        void Bayer16DemosaicRow(const uint16_t* src[5], size_t width, bool malvar, bool red, bool greenFirst, int shift, int max, uint16_t* b, uint16_t* g, uint16_t* r);
+
+        void Bayer16StoreRow(const uint16_t* b, const uint16_t* g, const uint16_t* r, size_t width, size_t bgrDepth, uint8_t* bgr);
+
+        void Bayer16ToBgr(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth, const float* gains,
+            SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth, Bayer16GainPtr gainRow, Bayer16DemosaicPtr demosaicRow, Bayer16StorePtr storeRow);
     }
 
 #ifdef SIMD_SSE41_ENABLE
@@ -236,6 +254,10 @@ namespace Simd
             d[4] = Merge16(Get<7, 0>(s), BayerToGreen(Get<7, 0>(s), Get<4, 1>(s), Get<8, 0>(s), Get<11, 0>(s), Get<6, 1>(s), Get<2, 0>(s), Get<8, 1>(s), Get<10, 1>(s)));
             d[5] = Merge16(_mm_avg_epu16(Get<6, 1>(s), Get<7, 1>(s)), Get<7, 1>(s));
         }
+
+        //-----------------------------------------------------------------------------------------
+
+        void Bayer16StoreRow(const uint16_t* b, const uint16_t* g, const uint16_t* r, size_t width, size_t bgrDepth, uint8_t* bgr);
     }
 #endif//SIMD_SSE41_ENABLE
 
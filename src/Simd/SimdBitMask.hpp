@@ -0,0 +1,204 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdBitMask_hpp__
+#define __SimdBitMask_hpp__
+
+#include "Simd/SimdView.hpp"
+
+namespace Simd
+{
+    /*! @ingroup cpp_bit_mask
+
+        \short The BitMask structure provides storage of bit-packed 1-bit masks.
+
+        Every row of the mask consists of (width + 7) / 8 bytes. Point x of the row is stored in bit (x & 7) of byte (x >> 3).
+        Unused bits of the last byte in every row are equal to zero.
+        The mask occupies 8 times less memory than 8-bit gray mask.
+
+        \ref cpp_bit_mask_functions.
+    */
+    template <template<class> class A> struct BitMask
+    {
+        typedef A<uint8_t> Allocator; /*!< Allocator type definition. */
+
+        size_t width; /*!< \brief A width of the mask (in points). */
+        size_t height; /*!< \brief A height of the mask. */
+        View<A> bits; /*!< \brief An 8-bit gray image which stores packed bits of the mask. Its width is equal to (width + 7) / 8. */
+
+        /*!
+            Creates a new empty BitMask structure.
+        */
+        BitMask();
+
+        /*!
+            Creates a new BitMask structure with specified size. All points of the mask are cleared.
+
+            \param [in] width - a width of created mask.
+            \param [in] height - a height of created mask.
+        */
+        BitMask(size_t width, size_t height);
+
+        /*!
+            Creates a new BitMask structure with specified size. All points of the mask are cleared.
+
+            \param [in] size - a size (width and height) of created mask.
+        */
+        BitMask(const Point<ptrdiff_t> & size);
+
+        /*!
+            Re-creates a BitMask structure with specified size. All points of the mask are cleared.
+
+            \param [in] width - a new width of the mask.
+            \param [in] height - a new height of the mask.
+        */
+        void Recreate(size_t width, size_t height);
+
+        /*!
+            Re-creates a BitMask structure with specified size. All points of the mask are cleared.
+
+            \param [in] size - a new size (width and height) of the mask.
+        */
+        void Recreate(const Point<ptrdiff_t> & size);
+
+        /*!
+            Gets size (width and height) of the mask.
+
+            \return - a new Point structure with mask width and height.
+        */
+        Point<ptrdiff_t> Size() const;
+
+        /*!
+            Clears all points of the mask.
+        */
+        void Clear();
+
+        /*!
+            Gets value of the point of the mask.
+
+            \param [in] x - a x-coordinate of the point.
+            \param [in] y - a y-coordinate of the point.
+            \return - a value of the point.
+        */
+        bool Get(size_t x, size_t y) const;
+
+        /*!
+            Sets value of the point of the mask.
+
+            \param [in] x - a x-coordinate of the point.
+            \param [in] y - a y-coordinate of the point.
+            \param [in] value - a new value of the point.
+        */
+        void Set(size_t x, size_t y, bool value);
+
+        /*!
+            Swaps two masks.
+
+            \param [in] mask - other mask.
+        */
+        void Swap(BitMask<A> & mask);
+    };
+
+    //-------------------------------------------------------------------------
+
+    // struct BitMask implementation:
+
+    template <template<class> class A>
+    SIMD_INLINE BitMask<A>::BitMask()
+        : width(0)
+        , height(0)
+    {
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE BitMask<A>::BitMask(size_t w, size_t h)
+        : width(0)
+        , height(0)
+    {
+        Recreate(w, h);
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE BitMask<A>::BitMask(const Point<ptrdiff_t> & size)
+        : width(0)
+        , height(0)
+    {
+        Recreate(size.x, size.y);
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void BitMask<A>::Recreate(size_t w, size_t h)
+    {
+        width = w;
+        height = h;
+        bits.Recreate((w + 7) / 8, h, View<A>::Gray8);
+        Clear();
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void BitMask<A>::Recreate(const Point<ptrdiff_t> & size)
+    {
+        Recreate(size.x, size.y);
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE Point<ptrdiff_t> BitMask<A>::Size() const
+    {
+        return Point<ptrdiff_t>(width, height);
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void BitMask<A>::Clear()
+    {
+        for (size_t row = 0; row < bits.height; ++row)
+            memset(bits.data + row * bits.stride, 0, bits.width);
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE bool BitMask<A>::Get(size_t x, size_t y) const
+    {
+        assert(x < width && y < height);
+        return (bits.data[y * bits.stride + (x >> 3)] & (1 << (x & 7))) != 0;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void BitMask<A>::Set(size_t x, size_t y, bool value)
+    {
+        assert(x < width && y < height);
+        uint8_t & byte = bits.data[y * bits.stride + (x >> 3)];
+        if (value)
+            byte |= uint8_t(1 << (x & 7));
+        else
+            byte &= uint8_t(~(1 << (x & 7)));
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void BitMask<A>::Swap(BitMask<A> & mask)
+    {
+        std::swap(width, mask.width);
+        std::swap(height, mask.height);
+        bits.Swap(mask.bits);
+    }
+}
+
+#endif//__SimdBitMask_hpp__
@@ -26,8 +26,11 @@
 #define __SimdContour_hpp__
 
 #include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
+#include <algorithm>
+#include <thread>
 
 namespace Simd
 {
@@ -77,6 +80,15 @@ namespace Simd
         typedef std::vector<Point> Contour; /*!< A contour type definition. */
         typedef std::vector<Contour> Contours; /*!< A vector of contours type definition. */
 
+        /*!
+            Creates a new ContourDetector structure.
+        */
+        ContourDetector()
+            : _threadNumber(std::max<size_t>(std::thread::hardware_concurrency(), 1))
+            , _tiledRouting(false)
+        {
+        }
+
         /*!
             Prepares ContourDetector structure to work with image of given size.
 
@@ -85,10 +97,33 @@ namespace Simd
         void Init(Size size)
         {
             _m.Recreate(size, View::Int16);
-            _a.Recreate(size, View::Gray8);
             _e.Recreate(size, View::Gray8);
         }
 
+        /*!
+            Sets maximal number of threads used by ContourDetector. By default it is equal to number of hardware threads.
+            Contour metrics and anchors are estimated in parallel row bands, the result does not depend on number of threads.
+
+            \param [in] threadNumber - a number of threads.
+        */
+        void SetThreadNumber(size_t threadNumber)
+        {
+            _threadNumber = std::max<size_t>(threadNumber, 1);
+        }
+
+        /*!
+            Enables or disables tiled routing of contours. By default it is disabled.
+            In tiled mode every thread routes contours from anchors of its own horizontal tile, then contours which
+            cross boundaries of tiles are stitched together. Contours may slightly differ from ones found by serial routing
+            because priority of anchors is kept only inside a tile.
+
+            \param [in] tiledRouting - a flag to enable tiled routing.
+        */
+        void SetTiledRouting(bool tiledRouting)
+        {
+            _tiledRouting = tiledRouting;
+        }
+
         /*!
             Detects contours at given image.
 
@@ -106,14 +141,16 @@ namespace Simd
         bool Detect(const View & src, Contours & contours, const View & mask = View(), uint8_t indexMin = 3, const Rect & roi = Rect(),
             int gradientThreshold = 40, int anchorThreshold = 0, int anchorScanInterval = 2, int minSegmentLength = 2)
         {
-            if (!Simd::Compatible(src, _a))
+            if (!Simd::Compatible(src, _e))
                 return false;
-            if (mask.format != View::None && !Simd::Compatible(mask, _a))
+            if (mask.format != View::None && !Simd::Compatible(mask, _e))
                 return false;
 
             _roi = roi.Empty() ? Rect(src.Size()) : roi;
             _roi.Intersection(Rect(src.Size()));
 
+            InitBands();
+
             ContourMetrics(src, mask, indexMin);
 
             if (gradientThreshold < 0)
@@ -153,37 +190,99 @@ namespace Simd
         };
         typedef std::vector<Anchor> Anchors;
 
+        struct Band
+        {
+            ptrdiff_t top, bottom;
+            View metrics, anchors;
+            Anchors found;
+            Contour contour;
+            Contours contours;
+        };
+        typedef std::vector<Band> Bands;
+
+        static const size_t BAND_HEIGHT_MIN = 16;
+
+        size_t _threadNumber;
+        bool _tiledRouting;
         Rect _roi;
         View _m;
-        View _a;
         View _e;
         Anchors _anchors;
-        Contour _contour;
+        Bands _bands;
 
-        void ContourMetrics(const View & src, const View & mask, uint8_t indexMin)
+        void InitBands()
+        {
+            if (_bands.size() < _threadNumber)
+            {
+                _bands.clear();
+                _bands.resize(_threadNumber);
+            }
+        }
+
+        static void ContourMetrics(const View & src, const View & mask, uint8_t indexMin, size_t begin, size_t end, View & dst)
         {
             if (mask.format == View::Gray8)
-                Simd::ContourMetrics(src.Region(_roi), mask.Region(_roi), indexMin, _m.Region(_roi).Ref());
+                Simd::ContourMetrics(src.Region(0, begin, src.width, end), mask.Region(0, begin, src.width, end), indexMin, dst.Region(0, begin, src.width, end).Ref());
             else
-                Simd::ContourMetrics(src.Region(_roi), _m.Region(_roi).Ref());
+                Simd::ContourMetrics(src.Region(0, begin, src.width, end), dst.Region(0, begin, src.width, end).Ref());
         }
 
-        void ContourAnchors(int anchorThreshold, int anchorScanInterval)
+        static void ContourMetricsRow(const View & src, const View & mask, uint8_t indexMin, size_t row, View & buffer, View & dst)
         {
-            Simd::ContourAnchors(_m.Region(_roi), anchorScanInterval, anchorThreshold, _a.Region(_roi).Ref());
+            size_t begin = std::max<size_t>(row, 1) - 1, end = std::min<size_t>(row + 2, src.height);
+            if (buffer.width != src.width)
+                buffer.Recreate(src.width, 3, View::Int16);
+            View rows = buffer.Region(0, 0, src.width, end - begin);
+            if (mask.format == View::Gray8)
+                Simd::ContourMetrics(src.Region(0, begin, src.width, end), mask.Region(0, begin, src.width, end), indexMin, rows);
+            else
+                Simd::ContourMetrics(src.Region(0, begin, src.width, end), rows);
+            Simd::Copy(rows.Region(0, row - begin, src.width, row - begin + 1), dst.Region(0, row, src.width, row + 1).Ref());
+        }
 
-            _anchors.clear();
-            for (ptrdiff_t row = _roi.Top() + 1; row < _roi.Bottom() - 1; row += anchorScanInterval)
+        void ContourMetrics(const View & src, const View & mask, uint8_t indexMin)
+        {
+            const View s = src.Region(_roi), k = mask.format == View::Gray8 ? mask.Region(_roi) : View();
+            View m = _m.Region(_roi);
+            Simd::Parallel(0, s.height, [&](size_t thread, size_t begin, size_t end)
             {
-                const uint8_t * a = &At<A, uint8_t>(_a, 0, row);
-                for (ptrdiff_t col = _roi.Left() + 1; col < _roi.Right() - 1; col += anchorScanInterval)
+                ContourMetrics(s, k, indexMin, begin, end, m);
+                if (begin > 0)
+                    ContourMetricsRow(s, k, indexMin, begin, _bands[thread].metrics, m);
+                if (end < s.height)
+                    ContourMetricsRow(s, k, indexMin, end - 1, _bands[thread].metrics, m);
+            }, _threadNumber, BAND_HEIGHT_MIN);
+        }
+
+        void ContourAnchors(int anchorThreshold, int anchorScanInterval)
+        {
+            const View m = _m.Region(_roi);
+            size_t step = anchorScanInterval, count = m.height > 2 ? (m.height - 3) / step + 1 : 0;
+            for (size_t i = 0; i < _bands.size(); ++i)
+                _bands[i].found.clear();
+            Simd::Parallel(0, count, [&](size_t thread, size_t begin, size_t end)
+            {
+                Band & band = _bands[thread];
+                size_t top = begin * step, bottom = (end - 1) * step + 3;
+                if (band.anchors.width != m.width || band.anchors.height < bottom - top)
+                    band.anchors.Recreate(m.width, bottom - top, View::Gray8);
+                View a = band.anchors.Region(0, 0, m.width, bottom - top);
+                Simd::ContourAnchors(m.Region(0, top, m.width, bottom), step, anchorThreshold, a);
+                for (size_t row = 1; row < a.height - 1; row += step)
                 {
-                    if (a[col])
-                        _anchors.push_back(Anchor(Point(col, row), At<A, uint16_t>(_m, col, row) / 2));
+                    const uint8_t * pa = &At<A, uint8_t>(a, 0, row);
+                    ptrdiff_t y = _roi.Top() + top + row;
+                    for (size_t col = 1; col < a.width - 1; col += step)
+                    {
+                        if (pa[col])
+                            band.found.push_back(Anchor(Point(_roi.Left() + col, y), At<A, uint16_t>(m, col, top + row) / 2));
+                    }
                 }
-            }
+            }, _threadNumber, std::max<size_t>(BAND_HEIGHT_MIN / step, 1));
 
-            std::stable_sort(_anchors.begin(), _anchors.end(), Anchor::Compare);
+            _anchors.clear();
+            for (size_t i = 0; i < _bands.size(); ++i)
+                _anchors.insert(_anchors.end(), _bands[i].found.begin(), _bands[i].found.end());
         }
 
         void PerformSmartRouting(Contours & contours, size_t minSegmentLength, uint16_t gradientThreshold)
@@ -193,22 +292,114 @@ namespace Simd
             Simd::Fill(e.Region(frame).Ref(), 0);
             Simd::FillFrame(e, frame, 255);
 
-            _contour.reserve(200);
-            for (size_t i = 0; i < _anchors.size(); i++)
+            if (_tiledRouting && _threadNumber > 1)
+                PerformTiledRouting(contours, minSegmentLength, gradientThreshold);
+            else
+            {
+                std::stable_sort(_anchors.begin(), _anchors.end(), Anchor::Compare);
+                Band & band = _bands[0];
+                band.top = _roi.Top();
+                band.bottom = _roi.Bottom();
+                Route(band, _anchors.begin(), _anchors.end(), contours, minSegmentLength, gradientThreshold);
+            }
+        }
+
+        void PerformTiledRouting(Contours & contours, size_t minSegmentLength, uint16_t gradientThreshold)
+        {
+            for (size_t i = 0; i < _bands.size(); ++i)
+            {
+                _bands[i].top = _bands[i].bottom = 0;
+                _bands[i].contours.clear();
+            }
+            Simd::Parallel(_roi.Top(), _roi.Bottom(), [&](size_t thread, size_t begin, size_t end)
+            {
+                Band & band = _bands[thread];
+                band.top = begin;
+                band.bottom = end;
+                band.found.clear();
+                for (size_t i = 0; i < _anchors.size(); ++i)
+                    if (_anchors[i].p.y >= band.top && _anchors[i].p.y < band.bottom)
+                        band.found.push_back(_anchors[i]);
+                std::stable_sort(band.found.begin(), band.found.end(), Anchor::Compare);
+                Route(band, band.found.begin(), band.found.end(), band.contours, 0, gradientThreshold);
+            }, _threadNumber, BAND_HEIGHT_MIN);
+
+            Contours tiled;
+            for (size_t i = 0; i < _bands.size() && _bands[i].bottom > _bands[i].top; ++i)
+            {
+                size_t begin = tiled.size();
+                for (size_t j = 0; j < _bands[i].contours.size(); ++j)
+                    tiled.push_back(_bands[i].contours[j]);
+                if (i)
+                    Stitch(tiled, begin, _bands[i].top);
+            }
+            for (size_t i = 0; i < tiled.size(); ++i)
+                if (tiled[i].size() > minSegmentLength)
+                    contours.push_back(tiled[i]);
+        }
+
+        void Route(Band & band, typename Anchors::const_iterator begin, typename Anchors::const_iterator end,
+            Contours & contours, size_t minSegmentLength, uint16_t gradientThreshold)
+        {
+            band.contour.reserve(200);
+            for (typename Anchors::const_iterator anchor = begin; anchor != end; ++anchor)
+            {
+                if (anchor->val > 0)
+                {
+                    band.contour.clear();
+                    SmartRoute(band, contours, anchor->p.x, anchor->p.y, minSegmentLength, gradientThreshold, Unknown);
+                    if (band.contour.size() > minSegmentLength)
+                        contours.push_back(band.contour);
+                }
+            }
+        }
+
+        static SIMD_INLINE bool Adjacent(const Point & a, const Point & b)
+        {
+            return std::abs(a.x - b.x) <= 1 && std::abs(a.y - b.y) <= 1;
+        }
+
+        static void Stitch(Contours & contours, size_t lower, ptrdiff_t seam)
+        {
+            std::vector<size_t> uppers, lowers;
+            for (size_t i = 0; i < lower; ++i)
+                if (contours[i].size() && (contours[i].front().y == seam - 1 || contours[i].back().y == seam - 1))
+                    uppers.push_back(i);
+            for (size_t i = lower; i < contours.size(); ++i)
+                if (contours[i].front().y == seam || contours[i].back().y == seam)
+                    lowers.push_back(i);
+
+            for (size_t u = 0; u < uppers.size(); ++u)
             {
-                const Anchor & anchor = _anchors[i];
-                if (anchor.val > 0)
+                Contour & a = contours[uppers[u]];
+                for (size_t l = 0; l < lowers.size(); ++l)
                 {
-                    _contour.clear();
-                    SmartRoute(contours, _contour, anchor.p.x, anchor.p.y, minSegmentLength, gradientThreshold, Unknown);
-                    if (_contour.size() > minSegmentLength)
-                        contours.push_back(_contour);
+                    Contour & b = contours[lowers[l]];
+                    if (b.empty())
+                        continue;
+                    if (Adjacent(a.back(), b.front()))
+                        a.insert(a.end(), b.begin(), b.end());
+                    else if (Adjacent(a.back(), b.back()))
+                        a.insert(a.end(), b.rbegin(), b.rend());
+                    else if (Adjacent(a.front(), b.back()))
+                        a.insert(a.begin(), b.begin(), b.end());
+                    else if (Adjacent(a.front(), b.front()))
+                        a.insert(a.begin(), b.rbegin(), b.rend());
+                    else
+                        continue;
+                    b.clear();
                 }
             }
         }
 
-        void SmartRoute(Contours & contours, Contour & contour, ptrdiff_t x, ptrdiff_t y, size_t minSegmentLength, uint16_t gradientThreshold, Direction direction)
+        SIMD_INLINE bool Blocked(const Band & band, ptrdiff_t x, ptrdiff_t y) const
+        {
+            return y < band.top || y >= band.bottom || At<A, uint8_t>(_e, x, y) != 0;
+        }
+
+        void SmartRoute(Band & band, Contours & contours, ptrdiff_t x, ptrdiff_t y, size_t minSegmentLength, uint16_t gradientThreshold, Direction direction)
         {
+            Contour & contour = band.contour;
             switch (direction)
             {
             case Unknown:
@@ -239,7 +430,7 @@ namespace Simd
                     }
                     else
                         x--;
-                    if (At<A, uint8_t>(_e, x, y) != 0)
+                    if (Blocked(band, x, y))
                         break;
                 }
                 break;
@@ -269,7 +460,7 @@ namespace Simd
                     }
                     else
                         x++;
-                    if (At<A, uint8_t>(_e, x, y) != 0)
+                    if (Blocked(band, x, y))
                         break;
                 }
                 break;
@@ -299,7 +490,7 @@ namespace Simd
                     }
                     else
                         y--;
-                    if (At<A, uint8_t>(_e, x, y) != 0)
+                    if (Blocked(band, x, y))
                         break;
                 }
                 break;
@@ -329,25 +520,25 @@ namespace Simd
                     }
                     else
                         y++;
-                    if (At<A, uint8_t>(_e, x, y) != 0)
+                    if (Blocked(band, x, y))
                         break;
                 }
                 break;
             }
 
-            if (At<A, uint8_t>(_e, x, y) != 0 || At<A, uint16_t>(_m, x, y) < gradientThreshold)
+            if (Blocked(band, x, y) || At<A, uint16_t>(_m, x, y) < gradientThreshold)
                 return;
 
             uint16_t d = At<A, uint16_t>(_m, x, y) & 1;
             if (d == 0)
             {
-                SmartRoute(contours, contour, x, y, minSegmentLength, gradientThreshold, Up);
-                SmartRoute(contours, contour, x, y, minSegmentLength, gradientThreshold, Down);
+                SmartRoute(band, contours, x, y, minSegmentLength, gradientThreshold, Up);
+                SmartRoute(band, contours, x, y, minSegmentLength, gradientThreshold, Down);
             }
             else if (d == 1)
             {
-                SmartRoute(contours, contour, x, y, minSegmentLength, gradientThreshold, Right);
-                SmartRoute(contours, contour, x, y, minSegmentLength, gradientThreshold, Left);
+                SmartRoute(band, contours, x, y, minSegmentLength, gradientThreshold, Right);
+                SmartRoute(band, contours, x, y, minSegmentLength, gradientThreshold, Left);
             }
         }
 
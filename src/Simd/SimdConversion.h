@@ -184,6 +184,7 @@ namespace Simd
                 switch (sector)
                 {
                 case 0:
+                case 6:
                     bgr[0] = min;
                     bgr[1] = min + delta;
                     bgr[2] = value;
@@ -231,16 +232,17 @@ namespace Simd
             {
                 int sector = hue * 6 / 255;
                 int max;
-                if (lightness <= 128)
+                if (lightness < 128)
                     max = lightness * (255 + saturation) / 255;
                 else
                     max = ((255 - lightness)*saturation + lightness * 255) / 255;
-                int min = (255 - saturation)*max / 255;
+                int min = 2 * lightness - max;
                 int delta = (max - min)*(hue * 6 - sector * 255) / 255;
 
                 switch (sector)
                 {
                 case 0:
+                case 6:
                     bgr[0] = min;
                     bgr[1] = min + delta;
                     bgr[2] = max;
@@ -31,6 +31,7 @@
 #include "Simd/SimdView.hpp"
 
 #include <vector>
+#include <mutex>
 
 namespace Simd
 {
@@ -117,6 +118,19 @@ namespace Simd
             bool hasTilted;
             bool isInt16;
             int ncategories;
+            size_t stageNumber;
+
+            bool profiling;
+            mutable std::mutex profileMutex;
+            mutable uint64_t profileWindows;
+            mutable std::vector<uint64_t> profileRejected;
+
+            HidBase()
+                : stageNumber(0)
+                , profiling(false)
+                , profileWindows(0)
+            {
+            }
 
             virtual ~HidBase() {}
         };
@@ -295,6 +309,44 @@ namespace Simd
 
         int Detect32f(const struct HidHaarCascade & hid, size_t offset, int startStage, float norm);
 
+        class DetectionProfiler
+        {
+        public:
+            DetectionProfiler(const HidBase & hid)
+                : _hid(hid)
+                , _windows(0)
+            {
+                if (hid.profiling)
+                    _rejected.resize(hid.stageNumber + 1, 0);
+            }
+
+            SIMD_INLINE void Add(int result)
+            {
+                if (_rejected.size())
+                {
+                    _windows++;
+                    if (result <= 0)
+                        _rejected[-result]++;
+                }
+            }
+
+            ~DetectionProfiler()
+            {
+                if (_rejected.size())
+                {
+                    std::lock_guard<std::mutex> lock(_hid.profileMutex);
+                    _hid.profileWindows += _windows;
+                    for (size_t i = 0; i < _hid.profileRejected.size() && i < _rejected.size(); ++i)
+                        _hid.profileRejected[i] += _rejected[i];
+                }
+            }
+
+        private:
+            const HidBase & _hid;
+            uint64_t _windows;
+            std::vector<uint64_t> _rejected;
+        };
+
         template< class T> SIMD_INLINE T IntegralSum(const T * p0, const T * p1, const T * p2, const T * p3, ptrdiff_t offset)
         {
             return p0[offset] - p1[offset] - p2[offset] + p3[offset];
@@ -29,8 +29,9 @@
 #include "Simd/SimdParallel.hpp"
 
 #include <vector>
-#include <map>
 #include <memory>
+#include <algorithm>
+#include <chrono>
 
 #include <limits.h>
 
@@ -205,10 +206,25 @@ namespace Simd
         };
         typedef std::vector<Object> Objects; /*!< A vector of objects type defenition. */
 
+        /*!
+            \short The Profile structure describes cascade stage statistics of one classifier at one scale level.
+        */
+        struct Profile
+        {
+            Tag tag; /*!< \brief A tag of the classifier. */
+            double scale; /*!< \brief A scale of the level. */
+            Size size; /*!< \brief A size of scanning window at original image. */
+            double time; /*!< \brief A total time (in seconds) spent on cascade evaluation at this level. */
+            uint64_t windows; /*!< \brief A number of scanned windows. */
+            std::vector<uint64_t> passed; /*!< \brief A number of windows which passed every stage of the cascade. */
+        };
+        typedef std::vector<Profile> Profiles; /*!< A vector of profiles type defenition. */
+
         /*!
             Creates a new empty Detection structure.
         */
         Detection()
+            : _profiling(false)
         {
         }
 
@@ -295,7 +311,61 @@ namespace Simd
             _imageSize = imageSize;
             ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
             _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
-            return InitLevels(scaleFactor, sizeMin, sizeMax, roi);
+            if (!InitLevels(scaleFactor, sizeMin, sizeMax, roi))
+                return false;
+            if (_profiling)
+                SetProfiling(true);
+            return true;
+        }
+
+        /*!
+            Enables or disables collection of cascade stage statistics (number of windows which passed every stage and time spent at every level).
+            Every call of this function resets accumulated statistics. It must be called after Simd::Detection::Init.
+
+            \note Detection with enabled profiling uses scalar implementation of cascade evaluation. So it is much slower.
+
+            \param [in] enable - a flag to enable profiling.
+        */
+        void SetProfiling(bool enable)
+        {
+            _profiling = enable;
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    ::SimdDetectionSetProfiling(level.hids[j].handle, enable ? ::SimdTrue : ::SimdFalse);
+                    level.hids[j].time = 0;
+                }
+            }
+        }
+
+        /*!
+            Gets cascade stage statistics accumulated since last call of Simd::Detection::SetProfiling.
+
+            \param [out] profiles - statistics for every classifier at every scale level.
+        */
+        void GetProfiling(Profiles & profiles) const
+        {
+            profiles.clear();
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                const Level & level = *_levels[i];
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    const Hid & hid = level.hids[j];
+                    Profile profile;
+                    profile.tag = hid.data->tag;
+                    profile.scale = level.scale;
+                    profile.size = hid.data->size * level.scale;
+                    profile.time = hid.time;
+                    size_t stageNumber = 0;
+                    ::SimdDetectionGetProfiling(hid.handle, &stageNumber, NULL, NULL);
+                    profile.passed.resize(stageNumber);
+                    ::SimdDetectionGetProfiling(hid.handle, NULL, &profile.windows, profile.passed.data());
+                    profiles.push_back(profile);
+                }
+            }
         }
 
         /*!
@@ -320,35 +390,47 @@ namespace Simd
 
             FillLevels(src);
 
-            typedef std::map<Tag, Objects> Candidates;
-            Candidates candidates;
+            PrepareTasks(motionMask, motionRegions);
+
+            ParallelQueue(_tasks.size(), _threadNumber, [&](size_t thread, size_t i)
+            {
+                Task & task = _tasks[i];
+                const Hid & hid = *task.hid;
+                std::chrono::high_resolution_clock::time_point start;
+                if (_profiling)
+                    start = std::chrono::high_resolution_clock::now();
+                hid.detect(hid.handle, hid.mask.data, hid.mask.stride, hid.rect.left, task.begin, hid.rect.right, task.end, hid.dst.data, hid.dst.stride);
+                if (_profiling)
+                    task.time = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+            });
+            if (_profiling)
+            {
+                for (size_t i = 0; i < _tasks.size(); ++i)
+                    _tasks[i].hid->time += _tasks[i].time;
+            }
 
+            _candidates.clear();
             for (size_t i = 0; i < _levels.size(); ++i)
             {
                 Level & level = *_levels[i];
-                View mask = level.roi;
-                Rect rect = level.rect;
-                if (motionMask)
-                {
-                    FillMotionMask(motionRegions, level, rect);
-                    mask = level.mask;
-                }
-                if (rect.Empty())
-                    continue;
                 for (size_t j = 0; j < level.hids.size(); ++j)
                 {
-                    Hid & hid = level.hids[j];
-
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
-
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
+                    const Hid & hid = level.hids[j];
+                    if (hid.rect.Empty())
+                        continue;
+                    AddObjects(_candidates, hid.dst, hid.rect, hid.data->size, level.scale,
                         level.throughColumn ? 2 : 1, hid.data->tag);
                 }
             }
+            std::sort(_candidates.begin(), _candidates.end(), Less);
 
             objects.clear();
-            for (typename Candidates::iterator it = candidates.begin(); it != candidates.end(); ++it)
-                GroupObjects(objects, it->second, groupSizeMin, sizeDifferenceMax);
+            for (size_t begin = 0, end = 0; begin < _candidates.size(); begin = end)
+            {
+                for (end = begin + 1; end < _candidates.size() && _candidates[end].tag == _candidates[begin].tag;)
+                    end++;
+                GroupObjects(objects, _candidates.data() + begin, end - begin, groupSizeMin, sizeDifferenceMax);
+            }
 
             return true;
         }
@@ -381,22 +463,10 @@ namespace Simd
             Handle handle;
             Data * data;
             DetectPtr detect;
-
-            void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
-            {
-                SIMD_CHECK_PERFORMANCE();
-
-                Size s = dst.Size() - data->size;
-                View m = mask.Region(s, View::MiddleCenter);
-                Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
-                Simd::Fill(dst, 0);
-                ::SimdDetectionPrepare(handle);
-
-                Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
-                {
-                    detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, rect.Area() >= (data->Haar() ? 10000 : 30000) ? threadNumber : 1, throughColumn ? 2 : 1);
-            }
+            View dst;
+            View mask;
+            Rect rect;
+            double time;
         };
         typedef std::vector<Hid> Hids;
 
@@ -415,16 +485,31 @@ namespace Simd
             View sqsum;
             View tilted;
 
-            View dst;
-
             bool throughColumn;
             bool needSqsum;
             bool needTilted;
 
+            Handle resizer;
+
+            Level()
+                : resizer(NULL)
+            {
+            }
+
             ~Level()
             {
                 for (size_t i = 0; i < hids.size(); ++i)
                     ::SimdRelease(hids[i].handle);
+                if (resizer)
+                    ::SimdRelease(resizer);
+            }
+
+            void Resize(const View & image)
+            {
+                if (resizer)
+                    ::SimdResizerRun(resizer, image.data, image.stride, src.data, src.stride);
+                else
+                    Simd::Copy(image, src);
             }
         };
         typedef std::shared_ptr<Level> LevelPtr;
@@ -435,6 +520,26 @@ namespace Simd
         bool _needNormalization;
         ptrdiff_t _threadNumber;
         LevelPtrs _levels;
+        bool _profiling;
+
+        struct Task
+        {
+            Hid * hid;
+            ptrdiff_t begin, end;
+            size_t area;
+            double time;
+
+            bool operator < (const Task & other) const
+            {
+                return area > other.area;
+            }
+        };
+        typedef std::vector<Task> Tasks;
+        Tasks _tasks;
+
+        View _gray;
+        Objects _candidates, _groups;
+        std::vector<int> _nodes, _labels;
 
         bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
         {
@@ -470,6 +575,10 @@ namespace Simd
                     Size scaledSize(_imageSize / scale);
 
                     level.src.Recreate(scaledSize, View::Gray8);
+                    Size resizerSize = _levels.size() == 1 ? _imageSize : _levels[0]->src.Size();
+                    if (resizerSize != scaledSize)
+                        level.resizer = ::SimdResizerInit(resizerSize.x, resizerSize.y, scaledSize.x, scaledSize.y, 1,
+                            ::SimdResizeChannelByte, ::SimdResizeMethodBilinear);
                     level.roi.Recreate(scaledSize, View::Gray8);
                     level.mask.Recreate(scaledSize, View::Gray8);
 
@@ -477,9 +586,8 @@ namespace Simd
                     level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
                     level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
 
-                    level.dst.Recreate(scaledSize, View::Gray8);
-
                     level.needSqsum = false, level.needTilted = false;
+                    level.hids.reserve(_data.size());
                     for (size_t i = 0; i < _data.size(); ++i)
                     {
                         if (!inserts[i])
@@ -491,6 +599,7 @@ namespace Simd
                             Hid hid;
                             hid.handle = handle;
                             hid.data = &_data[i];
+                            hid.time = 0;
                             if (_data[i].Haar())
                                 hid.detect = level.throughColumn ? ::SimdDetectionHaarDetect32fi : ::SimdDetectionHaarDetect32fp;
                             else
@@ -501,6 +610,7 @@ namespace Simd
                                     hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect32fi : ::SimdDetectionLbpDetect32fp;
                             }
                             level.hids.push_back(hid);
+                            level.hids.back().dst.Recreate(scaledSize, View::Gray8);
                         }
                         else
                             return false;
@@ -521,28 +631,105 @@ namespace Simd
                 }
                 scale *= scaleFactor;
             } while (true);
+            ReserveBuffers();
             return !_levels.empty();
         }
 
+        void ReserveBuffers()
+        {
+            size_t tasks = 0, windows = 0;
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                const Level & level = *_levels[i];
+                size_t step = level.throughColumn ? 2 : 1;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    tasks += (level.src.height + step - 1) / step;
+                    windows += level.src.Area() / (level.hids[j].data->size.x * level.hids[j].data->size.y) + 1;
+                }
+            }
+            _tasks.reserve(tasks);
+            _candidates.reserve(windows);
+            _groups.reserve(windows);
+            _nodes.reserve(windows * 2);
+            _labels.reserve(windows);
+        }
+
         void FillLevels(View src)
         {
-            View gray;
             if (src.format != View::Gray8)
             {
-                gray.Recreate(src.Size(), View::Gray8);
-                Convert(src, gray);
-                src = gray;
+                if (_gray.Size() != src.Size())
+                    _gray.Recreate(src.Size(), View::Gray8);
+                Convert(src, _gray);
+                src = _gray;
             }
 
-            Simd::ResizeBilinear(src, _levels[0]->src);
+            _levels[0]->Resize(src);
             if (_needNormalization)
                 Simd::NormalizeHistogram(_levels[0]->src, _levels[0]->src);
-            EstimateIntegral(*_levels[0]);
-            for (size_t i = 1; i < _levels.size(); ++i)
+            ParallelQueue(_levels.size(), _threadNumber, [&](size_t thread, size_t i)
             {
-                Simd::ResizeBilinear(_levels[0]->src, _levels[i]->src);
+                if (i)
+                    _levels[i]->Resize(_levels[0]->src);
                 EstimateIntegral(*_levels[i]);
+            });
+        }
+
+        void PrepareTasks(bool motionMask, const Rects & motionRegions)
+        {
+            _tasks.clear();
+            size_t area = 0;
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                View mask = level.roi;
+                Rect rect = level.rect;
+                if (motionMask)
+                {
+                    FillMotionMask(motionRegions, level, rect);
+                    mask = level.mask;
+                }
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    Hid & hid = level.hids[j];
+                    Size s = hid.dst.Size() - hid.data->size;
+                    hid.mask = mask.Region(s, View::MiddleCenter);
+                    hid.rect = rect.Empty() ? Rect() : rect.Shifted(-hid.data->size / 2).Intersection(Rect(s));
+                    if (hid.rect.Empty())
+                        continue;
+                    Simd::Fill(hid.dst, 0);
+                    ::SimdDetectionPrepare(hid.handle);
+                    area += hid.rect.Area();
+                }
             }
+
+            const size_t TASKS_PER_THREAD = 8, TASK_AREA_MIN = 4096;
+            size_t taskArea = std::max(area / (_threadNumber * TASKS_PER_THREAD), TASK_AREA_MIN);
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = *_levels[i];
+                ptrdiff_t step = level.throughColumn ? 2 : 1;
+                for (size_t j = 0; j < level.hids.size(); ++j)
+                {
+                    Hid & hid = level.hids[j];
+                    if (hid.rect.Empty())
+                        continue;
+                    ptrdiff_t band = std::max<ptrdiff_t>((taskArea + hid.rect.Width() - 1) / hid.rect.Width(), step);
+                    band = (band + step - 1) / step * step;
+                    for (ptrdiff_t row = hid.rect.top; row < hid.rect.bottom; row += band)
+                    {
+                        Task task;
+                        task.hid = &hid;
+                        task.begin = row;
+                        task.end = std::min(row + band, hid.rect.bottom);
+                        task.area = (task.end - task.begin) * hid.rect.Width();
+                        task.time = 0;
+                        _tasks.push_back(task);
+                    }
+                }
+            }
+            std::stable_sort(_tasks.begin(), _tasks.end());
         }
 
         void EstimateIntegral(Level & level)
@@ -572,10 +759,8 @@ namespace Simd
             Simd::OperationBinary8u(level.mask, level.roi, level.mask, SimdOperationBinary8uAnd);
         }
 
-        void AddObjects(Objects & objects, const View & dst, const Rect & rect, const Size & size, double scale, size_t step, Tag tag)
+        void AddObjects(Objects & objects, const View & dst, const Rect & r, const Size & size, double scale, size_t step, Tag tag)
         {
-            Size s = dst.Size() - size;
-            Rect r = rect.Shifted(-size / 2).Intersection(Rect(s));
             for (ptrdiff_t row = r.top; row < r.bottom; row += step)
             {
                 const uint8_t * mask = dst.data + row*dst.stride;
@@ -607,15 +792,28 @@ namespace Simd
             double _sizeDifferenceMax;
         };
 
-        template<typename T> int Partition(const std::vector<T> & vec, std::vector<int> & labels, double sizeDifferenceMax)
+        static bool Less(const Object & a, const Object & b)
+        {
+            if (a.tag != b.tag)
+                return a.tag < b.tag;
+            if (a.rect.left != b.rect.left)
+                return a.rect.left < b.rect.left;
+            if (a.rect.top != b.rect.top)
+                return a.rect.top < b.rect.top;
+            if (a.rect.right != b.rect.right)
+                return a.rect.right < b.rect.right;
+            return a.rect.bottom < b.rect.bottom;
+        }
+
+        int Partition(const Object * objs, size_t size, double sizeDifferenceMax)
         {
             Similar similar(sizeDifferenceMax);
-            int i, j, N = (int)vec.size();
+            int i, j, N = (int)size;
             const int PARENT = 0;
             const int RANK = 1;
 
-            std::vector<int> _nodes(N * 2);
-            int(*nodes)[2] = (int(*)[2])&_nodes[0];
+            _nodes.resize(N * 2);
+            int(*nodes)[2] = (int(*)[2])_nodes.data();
 
             for (i = 0; i < N; i++)
             {
@@ -629,9 +827,11 @@ namespace Simd
                 while (nodes[root][PARENT] >= 0)
                     root = nodes[root][PARENT];
 
-                for (j = 0; j < N; j++)
+                const Rect & ri = objs[i].rect;
+                double deltaMax = sizeDifferenceMax * (ri.Width() + ri.Height()) * 0.5;
+                for (j = i + 1; j < N && double(objs[j].rect.left - ri.left) <= deltaMax; j++)
                 {
-                    if (i == j || !similar(vec[i], vec[j]))
+                    if (!similar(objs[i], objs[j]))
                         continue;
                     int root2 = j;
 
@@ -668,7 +868,7 @@ namespace Simd
                 }
             }
 
-            labels.resize(N);
+            _labels.resize(N);
             int nclasses = 0;
 
             for (i = 0; i < N; i++)
@@ -678,25 +878,24 @@ namespace Simd
                     root = nodes[root][PARENT];
                 if (nodes[root][RANK] >= 0)
                     nodes[root][RANK] = ~nclasses++;
-                labels[i] = ~nodes[root][RANK];
+                _labels[i] = ~nodes[root][RANK];
             }
 
             return nclasses;
         }
 
-        void GroupObjects(Objects & dst, const Objects & src, size_t groupSizeMin, double sizeDifferenceMax)
+        void GroupObjects(Objects & dst, const Object * src, size_t size, size_t groupSizeMin, double sizeDifferenceMax)
         {
-            if (groupSizeMin == 0 || src.size() < groupSizeMin)
+            if (groupSizeMin == 0 || size < groupSizeMin)
                 return;
 
-            std::vector<int> labels;
-            int nclasses = Partition(src, labels, sizeDifferenceMax);
+            int nclasses = Partition(src, size, sizeDifferenceMax);
 
-            Objects buffer;
-            buffer.resize(nclasses);
-            for (size_t i = 0; i < labels.size(); ++i)
+            Objects & buffer = _groups;
+            buffer.assign(nclasses, Object());
+            for (size_t i = 0; i < size; ++i)
             {
-                int cls = labels[i];
+                int cls = _labels[i];
                 buffer[cls].rect += src[i].rect;
                 buffer[cls].weight++;
                 buffer[cls].tag = src[i].tag;
@@ -32,143 +32,194 @@ namespace Simd
 {
     /*! @ingroup cpp_drawing
 
-        \fn void DrawLine(View<A> & canvas, ptrdiff_t x1, ptrdiff_t y1, ptrdiff_t x2, ptrdiff_t y2, const Color & color, size_t width = 1)
+        \fn void DrawFilledRectangle(View<A> & canvas, Rectangle<ptrdiff_t> rect, const Color & color)
 
-        \short Draws a line at the image.
+        \short Draws a filled rectangle at the image.
 
-        \param [out] canvas - a canvas (image where we draw line).
-        \param [in] x1 - X coordinate of the first point of the line.
-        \param [in] y1 - Y coordinate of the first point of the line.
-        \param [in] x2 - X coordinate of the second point of the line.
-        \param [in] y2 - Y coordinate of the second point of the line.
-        \param [in] color - a color of the line.
-        \param [in] width - a width of the line. By default it is equal to 1.
+        \param [out] canvas - a canvas (image where we draw filled rectangle).
+        \param [in] rect - a rectangle to fill.
+        \param [in] color - a color of the filled rectangle.
     */
-    template<template<class> class A, class Color> SIMD_INLINE void DrawLine(View<A> & canvas, ptrdiff_t x1, ptrdiff_t y1, ptrdiff_t x2, ptrdiff_t y2, const Color & color, size_t width = 1)
+    template<template<class> class A, class Color> SIMD_INLINE void DrawFilledRectangle(View<A> & canvas, Rectangle<ptrdiff_t> rect, const Color & color)
     {
-        assert(canvas.PixelSize() == sizeof(Color));
+        assert(canvas.PixelSize() == sizeof(color));
 
-        const ptrdiff_t w = canvas.width - 1;
-        const ptrdiff_t h = canvas.height - 1;
+        rect &= Rectangle<ptrdiff_t>(canvas.Size());
+        if (rect.Empty())
+            return;
 
-        if (x1 < 0 || y1 < 0 || x1 > w || y1 > h || x2 < 0 || y2 < 0 || x2 > w || y2 > h)
+        if (sizeof(Color) <= 4)
         {
-            if ((x1 < 0 && x2 < 0) || (y1 < 0 && y2 < 0) || (x1 > w && x2 > w) || (y1 > h && y2 > h))
-                return;
-
-            if (y1 == y2)
-            {
-                x1 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(x1, 0), w);
-                x2 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(x2, 0), w);
-            }
-            else if (x1 == x2)
+            const Color pixel = color;
+            Simd::FillPixel<A, Color>(canvas.Region(rect).Ref(), pixel);
+        }
+        else
+        {
+            for (ptrdiff_t row = rect.top; row < rect.bottom; ++row)
             {
-                y1 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(y1, 0), h);
-                y2 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(y2, 0), h);
+                Color * dst = &At<A, Color>(canvas, 0, row);
+                for (ptrdiff_t col = rect.left; col < rect.right; ++col)
+                    dst[col] = color;
             }
-            else
+        }
+    }
+
+    /*! \cond PRIVATE */
+    namespace Detail
+    {
+        template<template<class> class A, class Color> SIMD_INLINE void DrawLine(View<A> & canvas, ptrdiff_t x1, ptrdiff_t y1, ptrdiff_t x2, ptrdiff_t y2, const Color & color, size_t width, ptrdiff_t rowBegin, ptrdiff_t rowEnd)
+        {
+            assert(canvas.PixelSize() == sizeof(Color));
+
+            const ptrdiff_t w = canvas.width - 1;
+            const ptrdiff_t h = canvas.height - 1;
+
+            if (x1 < 0 || y1 < 0 || x1 > w || y1 > h || x2 < 0 || y2 < 0 || x2 > w || y2 > h)
             {
-                ptrdiff_t x0 = (x1*y2 - y1*x2) / (y2 - y1);
-                ptrdiff_t y0 = (y1*x2 - x1*y2) / (x2 - x1);
-                ptrdiff_t xh = (x1*y2 - y1*x2 + h*(x2 - x1)) / (y2 - y1);
-                ptrdiff_t yw = (y1*x2 - x1*y2 + w*(y2 - y1)) / (x2 - x1);
+                if ((x1 < 0 && x2 < 0) || (y1 < 0 && y2 < 0) || (x1 > w && x2 > w) || (y1 > h && y2 > h))
+                    return;
 
-                if (x1 < 0)
+                if (y1 == y2)
                 {
-                    x1 = 0;
-                    y1 = y0;
+                    x1 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(x1, 0), w);
+                    x2 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(x2, 0), w);
                 }
-                if (x2 < 0)
+                else if (x1 == x2)
                 {
-                    x2 = 0;
-                    y2 = y0;
+                    y1 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(y1, 0), h);
+                    y2 = std::min<ptrdiff_t>(std::max<ptrdiff_t>(y2, 0), h);
                 }
-                if (x1 > w)
+                else
                 {
-                    x1 = w;
-                    y1 = yw;
-                }
-                if (x2 > w)
-                {
-                    x2 = w;
-                    y2 = yw;
-                }
-                if ((y1 < 0 && y2 < 0) || (y1 > h && y2 > h))
-                    return;
+                    ptrdiff_t x0 = (x1*y2 - y1*x2) / (y2 - y1);
+                    ptrdiff_t y0 = (y1*x2 - x1*y2) / (x2 - x1);
+                    ptrdiff_t xh = (x1*y2 - y1*x2 + h*(x2 - x1)) / (y2 - y1);
+                    ptrdiff_t yw = (y1*x2 - x1*y2 + w*(y2 - y1)) / (x2 - x1);
 
-                if (y1 < 0)
-                {
-                    x1 = x0;
-                    y1 = 0;
-                }
-                if (y2 < 0)
-                {
-                    x2 = x0;
-                    y2 = 0;
-                }
+                    if (x1 < 0)
+                    {
+                        x1 = 0;
+                        y1 = y0;
+                    }
+                    if (x2 < 0)
+                    {
+                        x2 = 0;
+                        y2 = y0;
+                    }
+                    if (x1 > w)
+                    {
+                        x1 = w;
+                        y1 = yw;
+                    }
+                    if (x2 > w)
+                    {
+                        x2 = w;
+                        y2 = yw;
+                    }
+                    if ((y1 < 0 && y2 < 0) || (y1 > h && y2 > h))
+                        return;
 
-                if (y1 > h)
-                {
-                    x1 = xh;
-                    y1 = h;
-                }
-                if (y2 > h)
-                {
-                    x2 = xh;
-                    y2 = h;
+                    if (y1 < 0)
+                    {
+                        x1 = x0;
+                        y1 = 0;
+                    }
+                    if (y2 < 0)
+                    {
+                        x2 = x0;
+                        y2 = 0;
+                    }
+
+                    if (y1 > h)
+                    {
+                        x1 = xh;
+                        y1 = h;
+                    }
+                    if (y2 > h)
+                    {
+                        x2 = xh;
+                        y2 = h;
+                    }
                 }
             }
-        }
 
-        const bool inverse = std::abs(y2 - y1) > std::abs(x2 - x1);
-        if (inverse)
-        {
-            std::swap(x1, y1);
-            std::swap(x2, y2);
-        }
+            if (y1 == y2 || x1 == x2)
+            {
+                ptrdiff_t shift = width / 2;
+                Rectangle<ptrdiff_t> span = y1 == y2 ?
+                    Rectangle<ptrdiff_t>(std::min(x1, x2), y1 - shift, std::max(x1, x2) + 1, y1 - shift + width) :
+                    Rectangle<ptrdiff_t>(x1 - shift, std::min(y1, y2), x1 - shift + width, std::max(y1, y2) + 1);
+                DrawFilledRectangle(canvas, span.Intersection(Rectangle<ptrdiff_t>(0, rowBegin, canvas.width, rowEnd)), color);
+                return;
+            }
 
-        if (x1 > x2)
-        {
-            std::swap(x1, x2);
-            std::swap(y1, y2);
-        }
+            const bool inverse = std::abs(y2 - y1) > std::abs(x2 - x1);
+            if (inverse)
+            {
+                std::swap(x1, y1);
+                std::swap(x2, y2);
+            }
 
-        const double dx = double(x2 - x1);
-        const double dy = (double)std::abs(y2 - y1);
+            if (x1 > x2)
+            {
+                std::swap(x1, x2);
+                std::swap(y1, y2);
+            }
 
-        double error = dx / 2.0f;
-        const ptrdiff_t ystep = (y1 < y2) ? 1 : -1;
-        ptrdiff_t y0 = y1 - width / 2;
+            const double dx = double(x2 - x1);
+            const double dy = (double)std::abs(y2 - y1);
 
-        for (ptrdiff_t x = x1; x <= x2; x++)
-        {
-            for (size_t i = 0; i < width; ++i)
+            double error = dx / 2.0f;
+            const ptrdiff_t ystep = (y1 < y2) ? 1 : -1;
+            ptrdiff_t y0 = y1 - width / 2;
+
+            for (ptrdiff_t x = x1; x <= x2; x++)
             {
-                ptrdiff_t y = y0 + i;
-                if (y >= 0)
+                for (size_t i = 0; i < width; ++i)
                 {
+                    ptrdiff_t y = y0 + i;
                     if (inverse)
                     {
-                        if (y <= w)
+                        if (y >= 0 && y <= w && x >= rowBegin && x < rowEnd)
                             At<A, Color>(canvas, y, x) = color;
                     }
                     else
                     {
-                        if (y <= h)
+                        if (y >= rowBegin && y < rowEnd && x >= 0 && x <= w)
                             At<A, Color>(canvas, x, y) = color;
                     }
-                }
 
-            }
+                }
 
-            error -= dy;
-            if (error < 0)
-            {
-                y0 += ystep;
-                error += dx;
+                error -= dy;
+                if (error < 0)
+                {
+                    y0 += ystep;
+                    error += dx;
+                }
             }
         }
     }
+    /*! \endcond */
+
+    /*! @ingroup cpp_drawing
+
+        \fn void DrawLine(View<A> & canvas, ptrdiff_t x1, ptrdiff_t y1, ptrdiff_t x2, ptrdiff_t y2, const Color & color, size_t width = 1)
+
+        \short Draws a line at the image.
+
+        \param [out] canvas - a canvas (image where we draw line).
+        \param [in] x1 - X coordinate of the first point of the line.
+        \param [in] y1 - Y coordinate of the first point of the line.
+        \param [in] x2 - X coordinate of the second point of the line.
+        \param [in] y2 - Y coordinate of the second point of the line.
+        \param [in] color - a color of the line.
+        \param [in] width - a width of the line. By default it is equal to 1.
+    */
+    template<template<class> class A, class Color> SIMD_INLINE void DrawLine(View<A> & canvas, ptrdiff_t x1, ptrdiff_t y1, ptrdiff_t x2, ptrdiff_t y2, const Color & color, size_t width = 1)
+    {
+        Detail::DrawLine(canvas, x1, y1, x2, y2, color, width, 0, canvas.height);
+    }
 
     /*! @ingroup cpp_drawing
 
@@ -242,34 +293,6 @@ namespace Simd
         DrawRectangle<A, Color>(canvas, Rectangle<ptrdiff_t>(left, top, right, bottom), color, width);
     }
 
-    /*! @ingroup cpp_drawing
-
-        \fn void DrawFilledRectangle(View<A> & canvas, Rectangle<ptrdiff_t> rect, const Color & color)
-
-        \short Draws a filled rectangle at the image.
-
-        \param [out] canvas - a canvas (image where we draw filled rectangle).
-        \param [in] rect - a rectangle to fill.
-        \param [in] color - a color of the filled rectangle.
-    */
-    template<template<class> class A, class Color> SIMD_INLINE void DrawFilledRectangle(View<A> & canvas, Rectangle<ptrdiff_t> rect, const Color & color)
-    {
-        assert(canvas.PixelSize() == sizeof(color));
-
-        if (sizeof(Color) <= 4)
-            Simd::FillPixel<A, Color>(canvas.Region(rect).Ref(), color);
-        else
-        {
-            rect &= Rectangle<ptrdiff_t>(canvas.Size());
-            for (ptrdiff_t row = rect.top; row < rect.bottom; ++row)
-            {
-                Color * dst = &At<A, Color>(canvas, 0, row);
-                for (ptrdiff_t col = rect.left; col < rect.right; ++col)
-                    dst[col] = color;
-            }
-        }
-    }
-
     /*! @ingroup cpp_drawing
 
         \fn void DrawPolygon(View<A> & canvas, const std::vector<Simd::Point<ptrdiff_t>> & polygon, const Color & color, size_t width = 1)
@@ -332,13 +355,7 @@ namespace Simd
             assert(intersections.size() % 2 == 0);
             std::sort(intersections.begin(), intersections.end());
             for (size_t i = 0; i < intersections.size(); i += 2)
-            {
-                ptrdiff_t left = std::max<ptrdiff_t>(0, intersections[i + 0]);
-                ptrdiff_t right = std::min<ptrdiff_t>(canvas.width, intersections[i + 1]);
-                Color * dst = &At<A, Color>(canvas, 0, y);
-                for (ptrdiff_t x = left; x < right; ++x)
-                    dst[x] = color;
-            }
+                DrawFilledRectangle(canvas, Rectangle<ptrdiff_t>(intersections[i + 0], y, intersections[i + 1], y + 1), color);
         }
     }
 
@@ -170,6 +170,23 @@ namespace Simd
             return Combine(mask, neg, value);
         }
 
+        SIMD_INLINE __m128 Erf(__m128 value)
+        {
+            __m128 _1 = _mm_set1_ps(1.0f);
+            __m128 sign = _mm_and_ps(value, _mm_set1_ps(-0.0f));
+            __m128 x = _mm_xor_ps(value, sign);
+            __m128 t = _mm_div_ps(_1, _mm_add_ps(_1, _mm_mul_ps(_mm_set1_ps(0.3275911f), x)));
+            __m128 p = Detail::Poly5(t, 0.0f, 0.254829592f, -0.284496736f, 1.421413741f, -1.453152027f, 1.061405429f);
+            __m128 erf = _mm_sub_ps(_1, _mm_mul_ps(p, Exponent(_mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(x, x)))));
+            return _mm_or_ps(erf, sign);
+        }
+
+        SIMD_INLINE __m128 Gelu(__m128 value)
+        {
+            __m128 erf = Erf(_mm_mul_ps(value, _mm_set1_ps(0.70710678f)));
+            return _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), value), _mm_add_ps(_mm_set1_ps(1.0f), erf));
+        }
+
         SIMD_INLINE __m128 Logarithm(__m128 value)
         {
             return _mm_mul_ps(_mm_set1_ps(0.693147181f), Detail::Log2(value));
@@ -335,6 +352,23 @@ namespace Simd
             return _mm256_blendv_ps(value, neg, mask);
         }
 
+        SIMD_INLINE __m256 Erf(__m256 value)
+        {
+            __m256 _1 = _mm256_set1_ps(1.0f);
+            __m256 sign = _mm256_and_ps(value, _mm256_set1_ps(-0.0f));
+            __m256 x = _mm256_xor_ps(value, sign);
+            __m256 t = _mm256_div_ps(_1, _mm256_fmadd_ps(_mm256_set1_ps(0.3275911f), x, _1));
+            __m256 p = Detail::Poly5(t, 0.0f, 0.254829592f, -0.284496736f, 1.421413741f, -1.453152027f, 1.061405429f);
+            __m256 erf = _mm256_fnmadd_ps(p, Exponent(_mm256_fnmadd_ps(x, x, _mm256_setzero_ps())), _1);
+            return _mm256_or_ps(erf, sign);
+        }
+
+        SIMD_INLINE __m256 Gelu(__m256 value)
+        {
+            __m256 erf = Erf(_mm256_mul_ps(value, _mm256_set1_ps(0.70710678f)));
+            return _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), value), _mm256_add_ps(_mm256_set1_ps(1.0f), erf));
+        }
+
         SIMD_INLINE __m256 Logarithm(__m256 value)
         {
             return _mm256_mul_ps(_mm256_set1_ps(0.693147181f), Detail::Log2(value));
@@ -500,6 +534,23 @@ namespace Simd
             return _mm512_mask_blend_ps(mask, value, neg);
         }
 
+        SIMD_INLINE __m512 Erf(__m512 value)
+        {
+            __m512 _1 = _mm512_set1_ps(1.0f);
+            __m512 sign = _mm512_and_ps(value, _mm512_set1_ps(-0.0f));
+            __m512 x = _mm512_xor_ps(value, sign);
+            __m512 t = _mm512_div_ps(_1, _mm512_fmadd_ps(_mm512_set1_ps(0.3275911f), x, _1));
+            __m512 p = Detail::Poly5(t, 0.0f, 0.254829592f, -0.284496736f, 1.421413741f, -1.453152027f, 1.061405429f);
+            __m512 erf = _mm512_fnmadd_ps(p, Exponent(_mm512_fnmadd_ps(x, x, _mm512_setzero_ps())), _1);
+            return _mm512_or_ps(erf, sign);
+        }
+
+        SIMD_INLINE __m512 Gelu(__m512 value)
+        {
+            __m512 erf = Erf(_mm512_mul_ps(value, _mm512_set1_ps(0.70710678f)));
+            return _mm512_mul_ps(_mm512_mul_ps(_mm512_set1_ps(0.5f), value), _mm512_add_ps(_mm512_set1_ps(1.0f), erf));
+        }
+
         SIMD_INLINE __m512 Logarithm(__m512 value)
         {
             return _mm512_mul_ps(_mm512_set1_ps(0.693147181f), Detail::Log2(value));
@@ -665,6 +716,22 @@ namespace Simd
             return vbslq_f32(mask, neg, value);
         }
 
+        template<int iter> SIMD_INLINE float32x4_t Erf(float32x4_t value)
+        {
+            float32x4_t _1 = vdupq_n_f32(1.0f);
+            float32x4_t x = vabsq_f32(value);
+            float32x4_t t = Div<iter>(_1, vmlaq_f32(_1, vdupq_n_f32(0.3275911f), x));
+            float32x4_t p = Detail::Poly5(t, 0.0f, 0.254829592f, -0.284496736f, 1.421413741f, -1.453152027f, 1.061405429f);
+            float32x4_t erf = vmlsq_f32(_1, p, Exponent(vnegq_f32(vmulq_f32(x, x))));
+            return vbslq_f32(vcltq_f32(value, vdupq_n_f32(0.0f)), vnegq_f32(erf), erf);
+        }
+
+        template<int iter> SIMD_INLINE float32x4_t Gelu(float32x4_t value)
+        {
+            float32x4_t erf = Erf<iter>(vmulq_f32(value, vdupq_n_f32(0.70710678f)));
+            return vmulq_f32(vmulq_f32(vdupq_n_f32(0.5f), value), vaddq_f32(vdupq_n_f32(1.0f), erf));
+        }
+
         SIMD_INLINE float32x4_t Logarithm(float32x4_t value)
         {
             return vmulq_f32(vdupq_n_f32(0.693147181f), Detail::Log2(value));
@@ -29,6 +29,7 @@
 
 #include <vector>
 #include <string>
+#include <map>
 #include <algorithm>
 
 namespace Simd
@@ -75,6 +76,8 @@ namespace Simd
             \param [in] height - initial height value. By default it is equal to 16.
         */
         Font(size_t height = 16)
+            : _cacheSize(0)
+            , _cacheTime(0)
         {
             LoadDefault();
             Resize(height);
@@ -99,6 +102,7 @@ namespace Simd
             _currentSize.x = height*_originalSize.x / _originalSize.y;
             _currentIndent.x = height*_originalIndent.x / _originalSize.y;
             _currentIndent.y = height*_originalIndent.y / _originalSize.y;
+            _cache.clear();
 
             size_t level = 0;
             for (; (height << (level + 1)) < (size_t)_originalSize.y; level++);
@@ -123,6 +127,24 @@ namespace Simd
             return true;
         }
 
+        /*!
+            Sets maximal number of cached texts.
+
+            By default Font::Draw renders alpha mask of the text at every call. If the cache is enabled then rendered alpha masks
+            of recently drawn texts are kept and reused. It accelerates drawing of repeated texts (for example labels of HUD).
+            The cache is cleared after change of the font height.
+
+            \note Drawing with enabled cache is not thread safe.
+
+            \param [in] size - a maximal number of cached texts. Zero value disables the cache (it is default value).
+        */
+        void SetCacheSize(size_t size)
+        {
+            _cacheSize = size;
+            while (_cache.size() > size)
+                EvictCached();
+        }
+
         /*!
             Gets height of the font.
 
@@ -174,6 +196,16 @@ namespace Simd
         {
             assert(sizeof(color) == canvas.PixelSize());
 
+            if (_cacheSize)
+            {
+                const Cached & cached = Render(text);
+                Point shift = position + _currentIndent;
+                Rect canvasRect = cached.rect.Shifted(shift).Intersection(Rect(canvas.Size()));
+                if (canvasRect.Area())
+                    Simd::AlphaFilling(canvas.Region(canvasRect).Ref(), color, cached.alpha.Region(canvasRect.Shifted(-shift - cached.rect.TopLeft())));
+                return true;
+            }
+
             View alpha;
             Rect canvasRect, alphaRect;
             CreateAlpha(text, Rect(canvas.Size()), position, alpha, canvasRect, alphaRect);
@@ -230,9 +262,47 @@ namespace Simd
         };
         typedef std::vector<Symbol> Symbols;
 
+        struct Cached
+        {
+            View alpha;
+            Rect rect;
+            size_t time;
+        };
+        typedef std::map<String, Cached> Cache;
+
         Symbols _originalSymbols, _currentSymbols;
         Point _originalSize, _currentSize, _originalIndent, _currentIndent;
         char _symbolMin, _symbolMax;
+        size_t _cacheSize;
+        mutable size_t _cacheTime;
+        mutable Cache _cache;
+
+        const Cached & Render(const String & text) const
+        {
+            Cache::iterator it = _cache.find(text);
+            if (it != _cache.end())
+            {
+                it->second.time = ++_cacheTime;
+                return it->second;
+            }
+            if (_cache.size() >= _cacheSize)
+                EvictCached();
+            Cached & cached = _cache[text];
+            Rect alphaRect;
+            CreateAlpha(text, Rect(Measure(text)), -_currentIndent, cached.alpha, cached.rect, alphaRect);
+            cached.time = ++_cacheTime;
+            return cached;
+        }
+
+        void EvictCached() const
+        {
+            Cache::iterator oldest = _cache.begin();
+            for (Cache::iterator it = _cache.begin(); it != _cache.end(); ++it)
+                if (it->second.time < oldest->second.time)
+                    oldest = it;
+            if (oldest != _cache.end())
+                _cache.erase(oldest);
+        }
 
         void CreateAlpha(const String & text, const Rect & canvas, const Point & shift, View & alpha, Rect & canvasRect, Rect & alphaRect) const
         {
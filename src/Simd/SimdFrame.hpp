@@ -67,6 +67,10 @@ namespace Simd
             Rgb24,
             /*! One plane 32-bit (4 8-bit channels) RGBA (Red, Green, Blue, Alpha) pixel format. */
             Rgba32,
+            /*! Two planes (16-bit full size Y plane, 32-bit interlived half size UV plane) P010 pixel format. 10-bit values are stored in most significant bits. */
+            P010,
+            /*! Three planes (16-bit full size Y plane, 16-bit half size U plane, 16-bit half size V plane) YUV420P10 (I010) pixel format. 10-bit values are stored in least significant bits. */
+            Yuv420p10,
         };
 
         const size_t width; /*!< \brief A width of the frame. */
@@ -543,6 +547,17 @@ namespace Simd
         case Rgba32:
             planes[0] = View<A>(width, height, stride0, View<A>::Rgba32, data0);
             break;
+        case P010:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Int32, data1);
+            break;
+        case Yuv420p10:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0] = View<A>(width, height, stride0, View<A>::Int16, data0);
+            planes[1] = View<A>(width / 2, height / 2, stride1, View<A>::Int16, data1);
+            planes[2] = View<A>(width / 2, height / 2, stride2, View<A>::Int16, data2);
+            break;
         default:
             assert(0);
         }
@@ -653,6 +668,17 @@ namespace Simd
         case Rgba32:
             planes[0].Recreate(width, height, View<A>::Rgba32);
             break;
+        case P010:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height / 2, View<A>::Int32);
+            break;
+        case Yuv420p10:
+            assert((width & 1) == 0 && (height & 1) == 0);
+            planes[0].Recreate(width, height, View<A>::Int16);
+            planes[1].Recreate(width / 2, height / 2, View<A>::Int16);
+            planes[2].Recreate(width / 2, height / 2, View<A>::Int16);
+            break;
         default:
             assert(0);
         }
@@ -678,7 +704,7 @@ namespace Simd
             right = std::min<ptrdiff_t>(std::max<ptrdiff_t>(right, 0), width);
             bottom = std::min<ptrdiff_t>(std::max<ptrdiff_t>(bottom, 0), height);
 
-            if (format == Nv12 || format == Yuv420p)
+            if (format == Nv12 || format == Yuv420p || format == P010 || format == Yuv420p10)
             {
                 left = left & ~1;
                 top = top & ~1;
@@ -695,10 +721,10 @@ namespace Simd
 
             frame.planes[0] = planes[0].Region(left, top, right, bottom);
 
-            if (format == Nv12 || format == Yuv420p)
+            if (format == Nv12 || format == Yuv420p || format == P010 || format == Yuv420p10)
                 frame.planes[1] = planes[1].Region(left / 2, top / 2, right / 2, bottom / 2);
 
-            if (format == Yuv420p)
+            if (format == Yuv420p || format == Yuv420p10)
                 frame.planes[2] = planes[2].Region(left / 2, top / 2, right / 2, bottom / 2);
 
             return frame;
@@ -770,6 +796,8 @@ namespace Simd
         case Gray8:   return 1;
         case Rgb24:   return 1;
         case Rgba32:  return 1;
+        case P010:    return 2;
+        case Yuv420p10: return 3;
         default: assert(0); return 0;
         }
     }
@@ -843,6 +871,35 @@ namespace Simd
         }
     }
 
+    namespace Detail
+    {
+        template <template<class> class A> SIMD_INLINE void Uint16ToGray(const View<A> & src, int shift, View<A> & dst)
+        {
+            assert(src.format == View<A>::Int16 && dst.format == View<A>::Gray8 && EqualSize(src, dst));
+
+            for (size_t row = 0; row < src.height; ++row)
+            {
+                const uint16_t * s = src.template Row<uint16_t>(row);
+                uint8_t * d = dst.template Row<uint8_t>(row);
+                for (size_t col = 0; col < src.width; ++col)
+                    d[col] = uint8_t(s[col] >> shift);
+            }
+        }
+
+        template <template<class> class A> SIMD_INLINE void SwapBlueRed(View<A> & view)
+        {
+            assert(view.format == View<A>::Bgr24 || view.format == View<A>::Bgra32 || view.format == View<A>::Rgb24 || view.format == View<A>::Rgba32);
+
+            size_t channels = view.PixelSize();
+            for (size_t row = 0; row < view.height; ++row)
+            {
+                uint8_t * p = view.template Row<uint8_t>(row);
+                for (size_t col = 0; col < view.width; ++col, p += channels)
+                    std::swap(p[0], p[2]);
+            }
+        }
+    }
+
     template <template<class> class A> SIMD_INLINE void Convert(const Frame<A> & src, Frame<A> & dst)
     {
         assert(EqualSize(src, dst) && src.format && dst.format && src.flipped == dst.flipped);
@@ -863,38 +920,20 @@ namespace Simd
                 DeinterleaveUv(src.planes[1], dst.planes[1], dst.planes[2]);
                 break;
             case Frame<A>::Bgra32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgra(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgra(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Bgr24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToBgr(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToBgr(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Gray8:
                 Copy(src.planes[0], dst.planes[0]);
                 break;
             case Frame<A>::Rgb24:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                Yuv420pToRgb(src.planes[0], u, v, dst.planes[0]);
+                Nv12ToRgb(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             case Frame<A>::Rgba32:
-            {
-                View<A> u(src.Size(), View<A>::Gray8), v(src.Size(), View<A>::Gray8);
-                DeinterleaveUv(src.planes[1], u, v);
-                View<A> bgr(src.Size(), View<A>::Bgr24);
-                Yuv420pToBgr(src.planes[0], u, v, bgr);
-                BgrToRgba(bgr, dst.planes[0]);
+                Nv12ToRgba(src.planes[0], src.planes[1], dst.planes[0]);
                 break;
-            }
             default:
                 assert(0);
             }
@@ -931,6 +970,68 @@ namespace Simd
             }
             break;
 
+        case Frame<A>::P010:
+            switch (dst.format)
+            {
+            case Frame<A>::Bgra32:
+                P010ToBgra(src.planes[0], src.planes[1], dst.planes[0]);
+                break;
+            case Frame<A>::Bgr24:
+                P010ToBgr(src.planes[0], src.planes[1], dst.planes[0]);
+                break;
+            case Frame<A>::Gray8:
+                Detail::Uint16ToGray(src.planes[0], 8, dst.planes[0]);
+                break;
+            case Frame<A>::Rgb24:
+            {
+                View<A> bgr(dst.width, dst.height, dst.planes[0].stride, View<A>::Bgr24, dst.planes[0].data);
+                P010ToBgr(src.planes[0], src.planes[1], bgr);
+                Detail::SwapBlueRed(bgr);
+                break;
+            }
+            case Frame<A>::Rgba32:
+            {
+                View<A> bgra(dst.width, dst.height, dst.planes[0].stride, View<A>::Bgra32, dst.planes[0].data);
+                P010ToBgra(src.planes[0], src.planes[1], bgra);
+                Detail::SwapBlueRed(bgra);
+                break;
+            }
+            default:
+                assert(0);
+            }
+            break;
+
+        case Frame<A>::Yuv420p10:
+            switch (dst.format)
+            {
+            case Frame<A>::Bgra32:
+                Yuv420p16ToBgra(src.planes[0], src.planes[1], src.planes[2], dst.planes[0]);
+                break;
+            case Frame<A>::Bgr24:
+                Yuv420p16ToBgr(src.planes[0], src.planes[1], src.planes[2], dst.planes[0]);
+                break;
+            case Frame<A>::Gray8:
+                Detail::Uint16ToGray(src.planes[0], 10 - 8, dst.planes[0]);
+                break;
+            case Frame<A>::Rgb24:
+            {
+                View<A> bgr(dst.width, dst.height, dst.planes[0].stride, View<A>::Bgr24, dst.planes[0].data);
+                Yuv420p16ToBgr(src.planes[0], src.planes[1], src.planes[2], bgr);
+                Detail::SwapBlueRed(bgr);
+                break;
+            }
+            case Frame<A>::Rgba32:
+            {
+                View<A> bgra(dst.width, dst.height, dst.planes[0].stride, View<A>::Bgra32, dst.planes[0].data);
+                Yuv420p16ToBgra(src.planes[0], src.planes[1], src.planes[2], bgra);
+                Detail::SwapBlueRed(bgra);
+                break;
+            }
+            default:
+                assert(0);
+            }
+            break;
+
         case Frame<A>::Bgra32:
             switch (dst.format)
             {
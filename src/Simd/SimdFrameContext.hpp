@@ -0,0 +1,312 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdFrameContext_hpp__
+#define __SimdFrameContext_hpp__
+
+#include "Simd/SimdFrame.hpp"
+#include "Simd/SimdPyramid.hpp"
+
+#include <vector>
+
+namespace Simd
+{
+    /*! @ingroup cpp_frame_context
+
+        \short FrameContext structure shares derived images of one input frame between several consumers.
+
+        The context keeps a reference to an input Simd::Frame and computes derived images lazily, at their first request:
+        gray image, levels of gray pyramids (for every ::SimdReduceType), 32-bit integral images and texture gradients
+        (see ::SimdTextureBoostedSaturatedGradient) of any level. Every image is computed only once per frame, so a motion detector,
+        an object detector and a shift detector which process the same frame do not repeat conversion and reducing of the image.
+        For Gray8, NV12 and YUV420P frames the gray image is a reference to Y plane of the input frame (no copy).
+
+        Buffers of derived images are kept between frames of the same size, so a context is intended to be reused for a video stream:
+        call FrameContext::Reset for every new frame. The structure is not thread-safe: derived images must be requested
+        from one thread (or be requested in advance before they are shared between threads).
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdFrameContext.hpp"
+
+        typedef Simd::FrameContext<Simd::Allocator> FrameContext;
+
+        void Process(const FrameContext::Frame & frame, FrameContext & context)
+        {
+            context.Reset(frame);
+            const FrameContext::View & gray = context.Gray();
+            const FrameContext::View & half = context.Level(1, SimdReduce2x2);
+            const FrameContext::View & sum = context.Integral(2);
+            const FrameContext::View & dx = context.TextureDx(3, 16, 4, SimdReduce4x4);
+            // pass gray, half, sum and dx to consumers...
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct FrameContext
+    {
+        typedef Simd::View<A> View; /*!< An image type definition. */
+        typedef Simd::Frame<A> Frame; /*!< A frame type definition. */
+        typedef Simd::Point<ptrdiff_t> Size; /*!< An image size type definition. */
+
+        /*!
+            Creates a new empty FrameContext structure.
+        */
+        FrameContext();
+
+        /*!
+            Creates a new FrameContext structure for given input frame.
+
+            \param [in] frame - an input frame. The context stores only reference to the frame, so the frame must exist until the context is used.
+        */
+        FrameContext(const Frame & frame);
+
+        /*!
+            Sets new input frame and invalidates all derived images. Buffers of derived images are reused if the frame size is not changed.
+
+            \param [in] frame - an input frame. The context stores only reference to the frame, so the frame must exist until the context is used.
+        */
+        void Reset(const Frame & frame);
+
+        /*!
+            Gets input frame.
+
+            \return a constant reference to the input frame.
+        */
+        const Frame & Input() const;
+
+        /*!
+            Gets size of the input frame.
+
+            \return a size of the input frame.
+        */
+        Size FrameSize() const;
+
+        /*!
+            Gets 8-bit gray image of the input frame. It is computed at the first call after FrameContext::Reset.
+
+            \return a constant reference to the gray image.
+        */
+        const View & Gray();
+
+        /*!
+            Gets given level of gray image pyramid. Level 0 is the gray image itself, every next level is reduced in two times
+            from the previous one (see Simd::ReduceGray). Missing levels are computed at the first call.
+
+            \param [in] level - an index of the level.
+            \param [in] reduceType - a type of function used for image reducing. By default it is equal to ::SimdReduce2x2.
+            \return a constant reference to the image of the level.
+        */
+        const View & Level(size_t level, ::SimdReduceType reduceType = ::SimdReduce2x2);
+
+        /*!
+            Gets 32-bit integral image (see ::SimdIntegral) of given level of gray image pyramid. Its size is greater than size of the level by 1.
+
+            \param [in] level - an index of the level. By default it is equal to 0.
+            \param [in] reduceType - a type of function used for image reducing. By default it is equal to ::SimdReduce2x2.
+            \return a constant reference to the integral image.
+        */
+        const View & Integral(size_t level = 0, ::SimdReduceType reduceType = ::SimdReduce2x2);
+
+        /*!
+            Gets saturated, boosted and shifted X-gradient (see ::SimdTextureBoostedSaturatedGradient) of given level of gray image pyramid.
+            The gradients are recomputed if saturation or boost differ from parameters of the previous call for this level.
+
+            \param [in] level - an index of the level.
+            \param [in] saturation - a saturation of gradient.
+            \param [in] boost - a boost coefficient.
+            \param [in] reduceType - a type of function used for image reducing. By default it is equal to ::SimdReduce2x2.
+            \return a constant reference to the X-gradient image.
+        */
+        const View & TextureDx(size_t level, uint8_t saturation, uint8_t boost, ::SimdReduceType reduceType = ::SimdReduce2x2);
+
+        /*!
+            Gets saturated, boosted and shifted Y-gradient (see ::SimdTextureBoostedSaturatedGradient) of given level of gray image pyramid.
+            The gradients are recomputed if saturation or boost differ from parameters of the previous call for this level.
+
+            \param [in] level - an index of the level.
+            \param [in] saturation - a saturation of gradient.
+            \param [in] boost - a boost coefficient.
+            \param [in] reduceType - a type of function used for image reducing. By default it is equal to ::SimdReduce2x2.
+            \return a constant reference to the Y-gradient image.
+        */
+        const View & TextureDy(size_t level, uint8_t saturation, uint8_t boost, ::SimdReduceType reduceType = ::SimdReduce2x2);
+
+    private:
+        static const size_t REDUCE_TYPE_COUNT = ::SimdReduce5x5 + 1;
+
+        struct Cache
+        {
+            View image, integral, dx, dy;
+            size_t imageFrame, integralFrame, gradientFrame;
+            uint8_t saturation, boost;
+
+            Cache() : imageFrame(0), integralFrame(0), gradientFrame(0), saturation(0), boost(0) {}
+        };
+        typedef std::vector<Cache> Caches;
+
+        Frame _input;
+        View _gray;
+        size_t _frame;
+        Caches _caches[REDUCE_TYPE_COUNT];
+
+        Cache & Get(size_t level, ::SimdReduceType reduceType);
+        void Gradient(size_t level, uint8_t saturation, uint8_t boost, ::SimdReduceType reduceType);
+
+        static void Recreate(View & view, const Size & size, typename View::Format format)
+        {
+            if (view.Size() != size || view.format != format)
+                view.Recreate(size, format);
+        }
+    };
+
+    //-------------------------------------------------------------------------
+
+    // struct FrameContext implementation:
+
+    template <template<class> class A>
+    SIMD_INLINE FrameContext<A>::FrameContext()
+        : _frame(1)
+    {
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE FrameContext<A>::FrameContext(const Frame & frame)
+        : _frame(1)
+    {
+        Reset(frame);
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void FrameContext<A>::Reset(const Frame & frame)
+    {
+        _input = frame;
+        _frame++;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE const Frame<A> & FrameContext<A>::Input() const
+    {
+        return _input;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE Point<ptrdiff_t> FrameContext<A>::FrameSize() const
+    {
+        return _input.Size();
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE const View<A> & FrameContext<A>::Gray()
+    {
+        return Get(0, ::SimdReduce2x2).image;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE const View<A> & FrameContext<A>::Level(size_t level, ::SimdReduceType reduceType)
+    {
+        return Get(level, reduceType).image;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE const View<A> & FrameContext<A>::Integral(size_t level, ::SimdReduceType reduceType)
+    {
+        Cache & cache = Get(level, reduceType);
+        if (cache.integralFrame != _frame)
+        {
+            Recreate(cache.integral, cache.image.Size() + Size(1, 1), View::Int32);
+            Simd::Integral(cache.image, cache.integral);
+            cache.integralFrame = _frame;
+        }
+        return cache.integral;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE const View<A> & FrameContext<A>::TextureDx(size_t level, uint8_t saturation, uint8_t boost, ::SimdReduceType reduceType)
+    {
+        Gradient(level, saturation, boost, reduceType);
+        return Get(level, reduceType).dx;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE const View<A> & FrameContext<A>::TextureDy(size_t level, uint8_t saturation, uint8_t boost, ::SimdReduceType reduceType)
+    {
+        Gradient(level, saturation, boost, reduceType);
+        return Get(level, reduceType).dy;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE typename FrameContext<A>::Cache & FrameContext<A>::Get(size_t level, ::SimdReduceType reduceType)
+    {
+        assert(_input.format != Frame::None && reduceType < REDUCE_TYPE_COUNT);
+
+        Caches & caches = _caches[reduceType];
+        if (caches.size() <= level)
+            caches.resize(level + 1);
+        Caches & grays = _caches[::SimdReduce2x2];
+        if (grays.empty())
+            grays.resize(1);
+        Cache & gray = grays[0];
+        if (gray.imageFrame != _frame)
+        {
+            if (_input.format == Frame::Gray8 || _input.format == Frame::Nv12 || _input.format == Frame::Yuv420p)
+                gray.image = _input.planes[0];
+            else
+            {
+                Recreate(_gray, _input.Size(), View::Gray8);
+                Simd::Convert(_input, Frame(_gray, _input.flipped).Ref());
+                gray.image = _gray;
+            }
+            gray.imageFrame = _frame;
+        }
+        for (size_t i = 1; i <= level; ++i)
+        {
+            const View & prev = i > 1 ? caches[i - 1].image : gray.image;
+            Cache & curr = caches[i];
+            if (curr.imageFrame != _frame)
+            {
+                Recreate(curr.image, Scale(prev.Size()), View::Gray8);
+                Simd::ReduceGray(prev, curr.image, reduceType);
+                curr.imageFrame = _frame;
+            }
+        }
+        return level ? caches[level] : gray;
+    }
+
+    template <template<class> class A>
+    SIMD_INLINE void FrameContext<A>::Gradient(size_t level, uint8_t saturation, uint8_t boost, ::SimdReduceType reduceType)
+    {
+        Cache & cache = Get(level, reduceType);
+        if (cache.gradientFrame != _frame || cache.saturation != saturation || cache.boost != boost)
+        {
+            Recreate(cache.dx, cache.image.Size(), View::Gray8);
+            Recreate(cache.dy, cache.image.Size(), View::Gray8);
+            Simd::TextureBoostedSaturatedGradient(cache.image, saturation, boost, cache.dx, cache.dy);
+            cache.gradientFrame = _frame;
+            cache.saturation = saturation;
+            cache.boost = boost;
+        }
+    }
+}
+
+#endif//__SimdFrameContext_hpp__
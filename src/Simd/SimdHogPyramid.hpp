@@ -0,0 +1,246 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdHogPyramid_hpp__
+#define __SimdHogPyramid_hpp__
+
+#include "Simd/SimdLib.hpp"
+#include "Simd/SimdPyramid.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <vector>
+#include <cmath>
+
+namespace Simd
+{
+    /*! @ingroup cpp_hog_pyramid
+
+        \short HogPyramid structure computes dense lite HOG features of image for all scales of sliding window search.
+
+        Levels of the pyramid have scales 2^(-k/levelsPerOctave). Images of octave levels (k is multiple of levelsPerOctave) are taken
+        from Simd::Pyramid built by reducing 2x2, images of intermediate levels are resized from the nearest greater octave image.
+        So every level image is estimated once and its gradients and cell histograms are computed once (see ::SimdHogLiteExtractFeatures)
+        and are shared by all sliding windows of this level. Levels are processed in parallel.
+
+        Features of every level are stored in aligned 32-bit float image (16 features per cell) which can be passed directly
+        to ::SimdHogLiteFilterFeatures.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdHogPyramid.hpp"
+
+        typedef Simd::HogPyramid<Simd::Allocator> HogPyramid;
+
+        void Detect(const HogPyramid::View & image, const float * filter, size_t filterWidth, size_t filterHeight, float threshold)
+        {
+            HogPyramid pyramid;
+            pyramid.Init(image.Size(), 8, 4, HogPyramid::Size(filterWidth + 2, filterHeight + 2) * 8);
+            pyramid.Compute(image);
+            pyramid.Filter(filter, filterWidth, filterHeight);
+            for (size_t i = 0; i < pyramid.LevelCount(); ++i)
+            {
+                const HogPyramid::Level & level = pyramid[i];
+                // look for values greater than threshold in level.response...
+            }
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct HogPyramid
+    {
+        typedef Simd::View<A> View; /*!< An image type definition. */
+        typedef Simd::Point<ptrdiff_t> Size; /*!< An image size type definition. */
+        typedef Simd::Pyramid<A> Pyramid; /*!< An image pyramid type definition. */
+
+        static const size_t FEATURE_SIZE = 16; /*!< A number of features per cell. */
+
+        /*!
+            \short The Level structure contains image and HOG features of one level of HogPyramid.
+        */
+        struct Level
+        {
+            double scale; /*!< A scale of the level relative to original image. */
+            size_t octave; /*!< An index of level of the image pyramid used as source for the level image. */
+            View image; /*!< A gray 8-bit image of the level. */
+            Size size; /*!< A size of features grid (in cells). */
+            View features; /*!< 32-bit float image with features. Its width is equal to size.x*FEATURE_SIZE and its height is equal to size.y. */
+            View response; /*!< 32-bit float image with result of filtration (see HogPyramid::Filter()). It is empty if the filter is bigger than the level. */
+        };
+
+        /*!
+            Creates a new empty HogPyramid structure.
+        */
+        HogPyramid()
+            : _cell(0)
+            , _threadNumber(std::max<size_t>(std::thread::hardware_concurrency(), 1))
+        {
+        }
+
+        /*!
+            Initializes HogPyramid for given image size.
+
+            \param [in] size - a size of input image.
+            \param [in] cell - a size of cell. It must be 4 or 8. By default it is equal to 8.
+            \param [in] levelsPerOctave - a number of levels per octave (image scale change in two times). By default it is equal to 4.
+            \param [in] minSize - a minimal size of level image. Normally it is equal to size of sliding window (in pixels).
+                        Its value is always restricted by cell*3 (minimal image size for features extraction).
+            \return the result of initialization.
+        */
+        bool Init(const Size & size, size_t cell = 8, size_t levelsPerOctave = 4, const Size & minSize = Size())
+        {
+            _levels.clear();
+            if ((cell != 4 && cell != 8) || levelsPerOctave < 1)
+                return false;
+            Size minimal(std::max<ptrdiff_t>(minSize.x, cell * 3), std::max<ptrdiff_t>(minSize.y, cell * 3));
+            if (size.x < minimal.x || size.y < minimal.y)
+                return false;
+
+            _cell = cell;
+            _size = size;
+            std::vector<double> scales;
+            for (size_t k = 0;; ++k)
+            {
+                double scale = ::pow(0.5, double(k) / double(levelsPerOctave));
+                if (ptrdiff_t(size.x * scale + 0.5) < minimal.x || ptrdiff_t(size.y * scale + 0.5) < minimal.y)
+                    break;
+                scales.push_back(scale);
+            }
+            _pyramid.Recreate(size, (scales.size() - 1) / levelsPerOctave + 1);
+
+            _levels.resize(scales.size());
+            for (size_t k = 0; k < _levels.size(); ++k)
+            {
+                Level & level = _levels[k];
+                level.scale = scales[k];
+                level.octave = k / levelsPerOctave;
+                if (k % levelsPerOctave == 0)
+                    level.image = _pyramid[level.octave];
+                else
+                    level.image.Recreate(ptrdiff_t(size.x * level.scale + 0.5), ptrdiff_t(size.y * level.scale + 0.5), View::Gray8);
+                level.size = Size(level.image.width / cell - 2, level.image.height / cell - 2);
+                level.features.Recreate(level.size.x * FEATURE_SIZE, level.size.y, View::Float);
+            }
+            return true;
+        }
+
+        /*!
+            Sets maximal number of threads used by HogPyramid. By default it is equal to number of hardware threads.
+
+            \param [in] threadNumber - a number of threads.
+        */
+        void SetThreadNumber(size_t threadNumber)
+        {
+            _threadNumber = std::max<size_t>(threadNumber, 1);
+        }
+
+        /*!
+            Computes images and HOG features for all levels of the pyramid.
+
+            \param [in] src - an input image. It must have the size given in HogPyramid::Init(). Its format is Gray8, Bgr24, Bgra32 or other format supported by Simd::Convert.
+            \return the result of the operation.
+        */
+        bool Compute(const View & src)
+        {
+            if (_levels.empty() || src.Size() != _size)
+                return false;
+
+            if (src.format == View::Gray8)
+                Simd::Copy(src, _pyramid[0]);
+            else
+                Simd::Convert(src, _pyramid[0]);
+            Simd::Build(_pyramid, ::SimdReduce2x2);
+
+            ParallelQueue(_levels.size(), _threadNumber, [this](size_t thread, size_t i)
+            {
+                Level & level = _levels[i];
+                if (level.image.data != _pyramid[level.octave].data)
+                    Simd::ResizeBilinear(_pyramid[level.octave], level.image);
+                Simd::HogLiteExtractFeatures(level.image, _cell, (float*)level.features.data, level.features.stride / sizeof(float));
+            });
+            return true;
+        }
+
+        /*!
+            Applies filter to HOG features of all levels of the pyramid (see ::SimdHogLiteFilterFeatures).
+            Results are stored in Level::response.
+
+            \param [in] filter - a pointer to the 32-bit float array with filter values. Its size must be equal to filterWidth*filterHeight*FEATURE_SIZE.
+            \param [in] filterWidth - a width of the filter (in cells).
+            \param [in] filterHeight - a height of the filter (in cells).
+        */
+        void Filter(const float * filter, size_t filterWidth, size_t filterHeight)
+        {
+            for (size_t i = 0; i < _levels.size(); ++i)
+            {
+                Level & level = _levels[i];
+                if (level.size.x >= (ptrdiff_t)filterWidth && level.size.y >= (ptrdiff_t)filterHeight)
+                {
+                    Size size(level.size.x - (ptrdiff_t)filterWidth + 1, level.size.y - (ptrdiff_t)filterHeight + 1);
+                    if (level.response.Size() != size)
+                        level.response.Recreate(size, View::Float);
+                }
+                else
+                    level.response.Clear();
+            }
+
+            ParallelQueue(_levels.size(), _threadNumber, [this, filter, filterWidth, filterHeight](size_t thread, size_t i)
+            {
+                Level & level = _levels[i];
+                if (level.response.data)
+                    ::SimdHogLiteFilterFeatures((float*)level.features.data, level.features.stride / sizeof(float), level.size.x, level.size.y,
+                        FEATURE_SIZE, filter, filterWidth, filterHeight, NULL, 0, (float*)level.response.data, level.response.stride / sizeof(float));
+            });
+        }
+
+        /*!
+            Gets number of levels in the pyramid.
+
+            \return number of levels.
+        */
+        size_t LevelCount() const
+        {
+            return _levels.size();
+        }
+
+        /*!
+            Gets level of the pyramid.
+
+            \param [in] index - an index of the level.
+            \return a constant reference to the level.
+        */
+        const Level & operator [] (size_t index) const
+        {
+            return _levels[index];
+        }
+
+    private:
+        typedef std::vector<Level> Levels;
+
+        size_t _cell, _threadNumber;
+        Size _size;
+        Pyramid _pyramid;
+        Levels _levels;
+    };
+}
+
+#endif//__SimdHogPyramid_hpp__
@@ -25,8 +25,12 @@
 #define __SimdImageMatcher_hpp__
 
 #include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
+#include <fstream>
+#include <cstring>
+#include <type_traits>
 
 namespace Simd
 {
@@ -58,6 +62,10 @@ namespace Simd
             }
         }
         \endverbatim
+
+        Hashes are stored in buckets as contiguous arrays of reduced images, so candidates are compared in batches
+        with help of ::SimdSquaredDifferenceSums8u. Large searches are split between several threads (see ImageMatcher::SetThreadNumber()).
+        Hashes can be removed from ImageMatcher (see ImageMatcher::Remove()) and the whole index can be saved to (loaded from) a file.
     */
     template <class Tag, template<class> class Allocator>
     struct ImageMatcher
@@ -126,6 +134,18 @@ namespace Simd
             Hash64x64, /*!< 32x32 reduced image size. */
         };
 
+        /*!
+            Creates a new empty ImageMatcher. Use ImageMatcher::Init() or ImageMatcher::Load() to initialize it.
+        */
+        ImageMatcher()
+            : _threshold(0.05)
+            , _type(Hash16x16)
+            , _number(0)
+            , _normalized(false)
+            , _threadNumber(std::max<size_t>(std::thread::hardware_concurrency(), 1))
+        {
+        }
+
         /*!
             Signalizes true if ImageMatcher is initialized.
 
@@ -160,6 +180,11 @@ namespace Simd
             static const size_t sizes[] = { 16, 32, 64 };
             size_t size = sizes[type];
 
+            _threshold = threshold;
+            _type = type;
+            _number = number;
+            _normalized = normalized;
+
             if (number >= 10000 && threshold < 0.10)
                 _matcher.reset(new Matcher_3D(threshold, size, number, normalized));
             else if (number > 1000 && !normalized)
@@ -218,6 +243,8 @@ namespace Simd
         /*!
             Finds all similar images earlier added to ImageMatcher for given image.
 
+            \note This function can be called from several threads at the same time, provided that no images are added or removed concurrently.
+
             \param [in] hash - a smart pointer to hash of the image.
             \param [out] results - a list of found similar images.
             \return true if similar images were found.
@@ -225,7 +252,7 @@ namespace Simd
         bool Find(const HashPtr & hash, Results & results)
         {
             results.clear();
-            _matcher->Find(hash, results);
+            _matcher->Find(hash, _threadNumber, results);
             return results.size() != 0;
         }
 
@@ -239,6 +266,19 @@ namespace Simd
             _matcher->Add(hash);
         }
 
+        /*!
+            Removes given image from ImageMatcher.
+
+            \note The order of images in results of following searches can be changed after removing.
+
+            \param [in] hash - a smart pointer to hash of the image which was added before.
+            \return true if the image was found and removed.
+        */
+        bool Remove(const HashPtr & hash)
+        {
+            return _matcher->Remove(hash);
+        }
+
         /*!
             Skips searching of the image in ImageMatcher.
 
@@ -249,7 +289,115 @@ namespace Simd
             hash->skip = true;
         }
 
+        /*!
+            Sets maximal number of threads used in ImageMatcher::Find(). By default it is equal to number of hardware threads.
+            Small searches are always performed in the calling thread.
+
+            \param [in] threadNumber - a number of threads.
+        */
+        void SetThreadNumber(size_t threadNumber)
+        {
+            _threadNumber = std::max<size_t>(threadNumber, 1);
+        }
+
+        /*!
+            Gets maximal number of threads used in ImageMatcher::Find().
+
+            \return a number of threads.
+        */
+        size_t ThreadNumber() const
+        {
+            return _threadNumber;
+        }
+
+        /*!
+            Saves ImageMatcher parameters and all added images to binary file.
+
+            \note Tag must be trivially copyable type.
+
+            \param [in] path - a path to output file.
+            \return the result of the operation.
+        */
+        bool Save(const std::string & path) const
+        {
+            static_assert(std::is_trivially_copyable<Tag>::value, "ImageMatcher::Save requires trivially copyable Tag!");
+            if (!_matcher)
+                return false;
+            std::ofstream ofs(path.c_str(), std::ofstream::binary);
+            if (!ofs.is_open())
+                return false;
+            uint32_t header[4] = { FILE_MAGIC, FILE_VERSION, uint32_t(_type), uint32_t(_normalized) };
+            uint64_t counts[4] = { uint64_t(_number), uint64_t(sizeof(Tag)), uint64_t(Square(_matcher->main) + Square(_matcher->fast)), uint64_t(_matcher->Size()) };
+            ofs.write((const char*)header, sizeof(header));
+            ofs.write((const char*)&_threshold, sizeof(_threshold));
+            ofs.write((const char*)counts, sizeof(counts));
+            _matcher->ForEach([&ofs](const Hash & hash)
+            {
+                uint8_t skip = hash.skip ? 1 : 0;
+                ofs.write((const char*)&hash.tag, sizeof(Tag));
+                ofs.write((const char*)&skip, 1);
+                ofs.write((const char*)hash.hash.data(), hash.hash.size());
+            });
+            return (bool)ofs;
+        }
+
+        /*!
+            Loads ImageMatcher parameters and images from binary file created by ImageMatcher::Save().
+            Previous content of ImageMatcher is discarded.
+
+            \note Tag must be trivially copyable type.
+
+            \param [in] path - a path to input file.
+            \return the result of the operation.
+        */
+        bool Load(const std::string & path)
+        {
+            static_assert(std::is_trivially_copyable<Tag>::value, "ImageMatcher::Load requires trivially copyable Tag!");
+            std::ifstream ifs(path.c_str(), std::ifstream::binary);
+            if (!ifs.is_open())
+                return false;
+            uint32_t header[4];
+            double threshold;
+            uint64_t counts[4];
+            ifs.read((char*)header, sizeof(header));
+            ifs.read((char*)&threshold, sizeof(threshold));
+            ifs.read((char*)counts, sizeof(counts));
+            if (!ifs || header[0] != FILE_MAGIC || header[1] != FILE_VERSION || header[2] > Hash64x64 || counts[1] != sizeof(Tag))
+                return false;
+            if (!Init(threshold, (HashType)header[2], (size_t)counts[0], header[3] != 0))
+                return false;
+            const size_t mainSize = Square(_matcher->main), fastSize = Square(_matcher->fast);
+            if (counts[2] != mainSize + fastSize)
+                return false;
+            for (uint64_t i = 0; i < counts[3]; ++i)
+            {
+                Tag tag;
+                uint8_t skip;
+                ifs.read((char*)&tag, sizeof(Tag));
+                ifs.read((char*)&skip, 1);
+                HashPtr hash(new Hash(tag, mainSize, fastSize));
+                hash->skip = skip != 0;
+                ifs.read((char*)hash->hash.data(), hash->hash.size());
+                if (!ifs)
+                {
+                    _matcher.reset();
+                    return false;
+                }
+                _matcher->Add(hash);
+            }
+            return true;
+        }
+
     private:
+        static const uint32_t FILE_MAGIC = 0x484D4953;
+        static const uint32_t FILE_VERSION = 1;
+
+        double _threshold;
+        HashType _type;
+        size_t _number;
+        bool _normalized;
+        size_t _threadNumber;
+
         struct Matcher
         {
             const size_t fast;
@@ -270,52 +418,133 @@ namespace Simd
             size_t Size() const { return _size; }
 
             virtual ~Matcher() {}
-            virtual void Add(const HashPtr & hash) = 0;
-            virtual void Find(const HashPtr & hash, Results & results) = 0;
 
-        protected:
-            typedef std::vector<HashPtr> Set;
-            typedef std::vector<Set> Sets;
-            Sets _sets;
-            size_t _fastSize, _mainSize, _size;
-            uint64_t _mainMax, _fastMax;
-            double _threshold;
-
-            void AddIn(size_t index, const HashPtr & hash)
+            void Add(const HashPtr & hash)
             {
-                _sets[index].push_back(hash);
+                Set & set = _sets[Index(hash)];
+                set.hashes.push_back(hash);
+                set.fast.insert(set.fast.end(), hash->fast, hash->fast + _fastSize);
                 _size++;
             }
 
-            void FindIn(size_t index, const HashPtr & hash, Results & results)
+            bool Remove(const HashPtr & hash)
             {
-                const Set & set = _sets[index];
-                for (size_t i = 0; i < set.size(); ++i)
+                Set & set = _sets[Index(hash)];
+                for (size_t i = 0, last = set.hashes.size() - 1; i < set.hashes.size(); ++i)
                 {
-                    double difference = 0;
-                    if (Compare(set[i], hash, difference))
-                        results.push_back(Result(set[i].get(), difference));
+                    if (set.hashes[i] == hash)
+                    {
+                        if (i != last)
+                        {
+                            set.hashes[i] = set.hashes[last];
+                            memcpy(set.fast.data() + i * _fastSize, set.fast.data() + last * _fastSize, _fastSize);
+                        }
+                        set.hashes.pop_back();
+                        set.fast.resize(last * _fastSize);
+                        _size--;
+                        return true;
+                    }
                 }
+                return false;
             }
 
-            bool Compare(const HashPtr & a, const HashPtr &  b, double & difference)
+            void Find(const HashPtr & hash, size_t threadNumber, Results & results)
             {
-                if (a->skip || b->skip)
-                    return false;
+                if (hash->skip)
+                    return;
 
-                uint64_t fastSum = 0;
-                ::SimdSquaredDifferenceSum(a->fast, _fastSize, b->fast, _fastSize, _fastSize, 1, &fastSum);
-                if (fastSum > _fastMax)
-                    return false;
+                Indexes indexes;
+                Candidates(hash, indexes);
 
-                uint64_t mainSum = 0;
-                ::SimdSquaredDifferenceSum(a->main, _mainSize, b->main, _mainSize, _mainSize, 1, &mainSum);
-                if (mainSum > _mainMax)
-                    return false;
+                Blocks blocks;
+                size_t total = 0;
+                for (size_t i = 0; i < indexes.size(); ++i)
+                {
+                    size_t index = indexes[i], size = _sets[index].hashes.size();
+                    for (size_t begin = 0; begin < size; begin += BLOCK_SIZE)
+                        blocks.push_back(Block(index, begin, std::min(begin + BLOCK_SIZE, size)));
+                    total += size;
+                }
+                if (total == 0)
+                    return;
+
+                threadNumber = std::min(threadNumber, (total + THREAD_SIZE_MIN - 1) / THREAD_SIZE_MIN);
+                std::vector<Buffer> buffers(threadNumber);
+                if (threadNumber <= 1)
+                    FindIn(hash, blocks, 0, blocks.size(), buffers[0], results);
+                else
+                {
+                    std::vector<Results> threadResults(threadNumber);
+                    Simd::Parallel(0, blocks.size(), [&](size_t thread, size_t begin, size_t end)
+                    {
+                        FindIn(hash, blocks, begin, end, buffers[thread], threadResults[thread]);
+                    }, threadNumber);
+                    for (size_t t = 0; t < threadNumber; ++t)
+                        for (size_t i = 0; i < threadResults[t].size(); ++i)
+                            results.push_back(threadResults[t][i]);
+                }
+            }
+
+            template<class Function> void ForEach(Function function) const
+            {
+                for (size_t i = 0; i < _sets.size(); ++i)
+                    for (size_t j = 0; j < _sets[i].hashes.size(); ++j)
+                        function(*_sets[i].hashes[j]);
+            }
+
+        protected:
+            struct Set
+            {
+                std::vector<HashPtr> hashes;
+                std::vector<uint8_t, Allocator<uint8_t> > fast;
+            };
+            typedef std::vector<Set> Sets;
+            Sets _sets;
+            size_t _fastSize, _mainSize, _size;
+            uint64_t _mainMax, _fastMax;
+            double _threshold;
+
+            typedef std::vector<size_t> Indexes;
 
-                difference = ::sqrt(double(mainSum) / _mainSize / UINT8_MAX / UINT8_MAX);
+            virtual size_t Index(const HashPtr & hash) = 0;
+            virtual void Candidates(const HashPtr & hash, Indexes & indexes) = 0;
 
-                return difference <= _threshold;
+        private:
+            static const size_t BLOCK_SIZE = 1024;
+            static const size_t THREAD_SIZE_MIN = 16 * 1024;
+
+            struct Block
+            {
+                size_t index, begin, end;
+                Block(size_t i, size_t b, size_t e) : index(i), begin(b), end(e) {}
+            };
+            typedef std::vector<Block> Blocks;
+            typedef std::vector<uint32_t> Buffer;
+
+            void FindIn(const HashPtr & hash, const Blocks & blocks, size_t begin, size_t end, Buffer & sums, Results & results) const
+            {
+                sums.resize(BLOCK_SIZE);
+                for (size_t b = begin; b < end; ++b)
+                {
+                    const Block & block = blocks[b];
+                    const Set & set = _sets[block.index];
+                    ::SimdSquaredDifferenceSums8u(hash->fast, set.fast.data() + block.begin * _fastSize, _fastSize, block.end - block.begin, sums.data());
+                    for (size_t i = block.begin; i < block.end; ++i)
+                    {
+                        if (sums[i - block.begin] > _fastMax)
+                            continue;
+                        const Hash * candidate = set.hashes[i].get();
+                        if (candidate->skip)
+                            continue;
+                        uint64_t mainSum = 0;
+                        ::SimdSquaredDifferenceSum(candidate->main, _mainSize, hash->main, _mainSize, _mainSize, 1, &mainSum);
+                        if (mainSum > _mainMax)
+                            continue;
+                        double difference = ::sqrt(double(mainSum) / _mainSize / UINT8_MAX / UINT8_MAX);
+                        if (difference <= _threshold)
+                            results.push_back(Result(candidate, difference));
+                    }
+                }
             }
         };
         typedef std::unique_ptr<Matcher> MatcherPtr;
@@ -327,17 +556,21 @@ namespace Simd
                 : Matcher(threshold, size)
             {
                 this->_sets.resize(1);
-                this->_sets[0].reserve(number);
+                this->_sets[0].hashes.reserve(number);
+                this->_sets[0].fast.reserve(number * this->_fastSize);
             }
 
-            virtual void Add(const HashPtr & hash)
+        protected:
+            typedef typename Matcher::Indexes Indexes;
+
+            virtual size_t Index(const HashPtr & hash)
             {
-                this->AddIn(0, hash);
+                return 0;
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+            virtual void Candidates(const HashPtr & hash, Indexes & indexes)
             {
-                this->FindIn(0, hash, results);
+                indexes.push_back(0);
             }
         };
 
@@ -351,28 +584,26 @@ namespace Simd
                 _half = (int)ceil(double(_range)*threshold);
             }
 
-            virtual void Add(const HashPtr & hash)
+        protected:
+            typedef typename Matcher::Indexes Indexes;
+
+            virtual size_t Index(const HashPtr & hash)
             {
-                this->AddIn(Get(hash), hash);
+                size_t sum = 0;
+                for (size_t i = 0; i < this->_fastSize; ++i)
+                    sum += hash->fast[i];
+                return sum >> 4;
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+            virtual void Candidates(const HashPtr & hash, Indexes & indexes)
             {
-                size_t index = Get(hash);
+                size_t index = Index(hash);
                 for (size_t i = std::max(index, _half) - _half, end = std::min(index + _half + 1, _range); i < end; ++i)
-                    this->FindIn(i, hash, results);
+                    indexes.push_back(i);
             }
 
         private:
             size_t _range, _half;
-
-            size_t Get(const HashPtr & hash)
-            {
-                size_t sum = 0;
-                for (size_t i = 0; i < this->_fastSize; ++i)
-                    sum += hash->fast[i];
-                return sum >> 4;
-            }
         };
 
         struct Matcher_3D : public Matcher
@@ -400,16 +631,19 @@ namespace Simd
                 _half = (int)ceil(double(_maxRange)*threshold);
             }
 
-            virtual void Add(const HashPtr & hash)
+        protected:
+            typedef typename Matcher::Indexes Indexes;
+
+            virtual size_t Index(const HashPtr & hash)
             {
-                Index i;
+                Index3D i;
                 Get(hash, i);
-                this->AddIn(i.x*_stride.x + i.y*_stride.y + i.z*_stride.z, hash);
+                return i.x*_stride.x + i.y*_stride.y + i.z*_stride.z;
             }
 
-            virtual void Find(const HashPtr & hash, Results & results)
+            virtual void Candidates(const HashPtr & hash, Indexes & indexes)
             {
-                Index i, lo, hi;
+                Index3D i, lo, hi;
                 Get(hash, i);
 
                 lo.x = std::max(0, i.x - _half)*_stride.x;
@@ -423,22 +657,22 @@ namespace Simd
                 for (int z = lo.z; z < hi.z; z += _stride.z)
                     for (int y = lo.y; y < hi.y; y += _stride.y)
                         for (int x = lo.x; x < hi.x; x += _stride.x)
-                            this->FindIn(x + y + z, hash, results);
+                            indexes.push_back(x + y + z);
             }
 
         private:
             int _maxRange, _half;
             bool _normalized;
 
-            struct Index
+            struct Index3D
             {
                 int x;
                 int y;
                 int z;
             };
-            Index _shift, _range, _stride;
+            Index3D _shift, _range, _stride;
 
-            void Get(const HashPtr & hash, Index & index)
+            void Get(const HashPtr & hash, Index3D & index)
             {
                 const uint8_t * p = hash->fast;
                 int s[2][2];
@@ -67,6 +67,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdImageLoad.h"
 #include "Simd/SimdImageSave.h"
 #include "Simd/SimdRecursiveBilateralFilter.h"
+#include "Simd/SimdParallelRows.h"
 #include "Simd/SimdResizer.h"
 #include "Simd/SimdSynetConvolution8i.h"
 #include "Simd/SimdSynetConvolution32f.h"
@@ -75,6 +76,8 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSynetMergedConvolution32f.h"
 #include "Simd/SimdSynetMergedConvolution8i.h"
 #include "Simd/SimdSynetPermute.h"
+#include "Simd/SimdSynetPooling32f.h"
+#include "Simd/SimdSynetSoftmax32f.h"
 #include "Simd/SimdSynetScale8i.h"
 #include "Simd/SimdWarpAffine.h"
 
@@ -195,6 +198,16 @@ SIMD_API void SimdSetThreadNumber(size_t threadNumber)
     Base::SetThreadNumber(threadNumber);
 }
 
+SIMD_API size_t SimdGetParallelThreshold()
+{
+    return Base::GetParallelThreshold();
+}
+
+SIMD_API void SimdSetParallelThreshold(size_t area)
+{
+    Base::SetParallelThreshold(area);
+}
+
 SIMD_API SimdBool SimdGetFastMode()
 {
 #ifdef SIMD_SSE41_ENABLE
@@ -466,10 +479,44 @@ SIMD_API void SimdAddFeatureDifference(const uint8_t * value, size_t valueStride
         Base::AddFeatureDifference(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
 }
 
+SIMD_API void SimdFeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+    const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+    uint8_t * difference, size_t differenceStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::FeatureDifferenceSum(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::FeatureDifferenceSum(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::FeatureDifferenceSum(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::A)
+        Neon::FeatureDifferenceSum(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+    else
+#endif
+        Base::FeatureDifferenceSum(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+}
+
 SIMD_API void SimdAlphaBlending(const uint8_t *src, size_t srcStride, size_t width, size_t height, size_t channelCount,
                    const uint8_t *alpha, size_t alphaStride, uint8_t *dst, size_t dstStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdAlphaBlending(src + begin * srcStride, srcStride, width, end - begin, channelCount, alpha + begin * alphaStride, alphaStride, dst + begin * dstStride, dstStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::AlphaBlending(src, srcStride, width, height, channelCount, alpha, alphaStride, dst, dstStride);
@@ -569,6 +616,22 @@ SIMD_API void SimdAlphaBlendingUniform(const uint8_t* src, size_t srcStride, siz
         Base::AlphaBlendingUniform(src, srcStride, width, height, channelCount, alpha, dst, dstStride);
 }
 
+SIMD_API void SimdAlphaComposite(const SimdAlphaLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height, size_t channelCount)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::AlphaComposite(layers, count, dst, dstStride, width, height, channelCount);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::AlphaComposite(layers, count, dst, dstStride, width, height, channelCount);
+    else
+#endif
+        Base::AlphaComposite(layers, count, dst, dstStride, width, height, channelCount);
+}
+
 SIMD_API void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel, size_t channelCount, const uint8_t * alpha, size_t alphaStride)
 {
     SIMD_EMPTY();
@@ -970,9 +1033,32 @@ SIMD_API void SimdBase64Encode(const uint8_t* src, size_t size, uint8_t* dst)
         Base::Base64Encode(src, size, dst);
 }
 
+SIMD_API void SimdBayer16ToBgr(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth,
+    const float* gains, SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::HA)
+        Avx2::Bayer16ToBgr(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, demosaic, bgr, bgrStride, bgrDepth);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::HA)
+        Sse41::Bayer16ToBgr(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, demosaic, bgr, bgrStride, bgrDepth);
+    else
+#endif
+        Base::Bayer16ToBgr(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, demosaic, bgr, bgrStride, bgrDepth);
+}
+
 SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRowsBayer(width, height, 3, bgr, bgrStride, [=](size_t row, size_t count, uint8_t * dst, size_t dstStride)
+        {
+            SimdBayerToBgr(bayer + row * bayerStride, width, count, bayerStride, bayerFormat, dst, dstStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::A + 2)
         Avx512bw::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
@@ -999,6 +1085,12 @@ SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height,
 SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRowsBayer(width, height, 4, bgra, bgraStride, [=](size_t row, size_t count, uint8_t * dst, size_t dstStride)
+        {
+            SimdBayerToBgra(bayer + row * bayerStride, width, count, bayerStride, bayerFormat, dst, dstStride, alpha);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx512bw::A + 2)
         Avx512bw::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
@@ -1418,6 +1510,12 @@ SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t
 SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *gray, size_t grayStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdBgrToGray(bgr + begin * bgrStride, width, end - begin, bgrStride, gray + begin * grayStride, grayStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::BgrToGray(bgr, width, height, bgrStride, gray, grayStride);
@@ -1458,6 +1556,22 @@ SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, siz
     Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
 }
 
+SIMD_API void SimdBgrToHsvRangeMask(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lo, const uint8_t * hi, uint8_t * mask, size_t maskStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToHsvRangeMask(bgr, width, height, bgrStride, lo, hi, mask, maskStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToHsvRangeMask(bgr, width, height, bgrStride, lo, hi, mask, maskStride);
+    else
+#endif
+        Base::BgrToHsvRangeMask(bgr, width, height, bgrStride, lo, hi, mask, maskStride);
+}
+
 SIMD_API void SimdBgrToRgb(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgb, size_t rgbStride)
 {
     SIMD_EMPTY();
@@ -1649,6 +1763,138 @@ SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride,
     Base::AveragingBinarizationV2(src, srcStride, width, height, neighborhood, shift, positive, negative, dst, dstStride);
 }
 
+SIMD_API void SimdBitMaskPack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BitMaskPack(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BitMaskPack(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::BitMaskPack(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdBitMaskUnpack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::BitMaskUnpack(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::BitMaskUnpack(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::BitMaskUnpack(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdBitMaskOperation(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+    size_t width, size_t height, SimdBitMaskOperationType type, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::BitMaskOperation(a, aStride, b, bStride, width, height, type, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::BitMaskOperation(a, aStride, b, bStride, width, height, type, dst, dstStride);
+    else
+#endif
+        Base::BitMaskOperation(a, aStride, b, bStride, width, height, type, dst, dstStride);
+}
+
+SIMD_API void SimdBitMaskNot(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::BitMaskNot(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::BitMaskNot(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
+        Base::BitMaskNot(src, srcStride, width, height, dst, dstStride);
+}
+
+SIMD_API void SimdBitMaskCount(const uint8_t * mask, size_t stride, size_t width, size_t height, uint64_t * count)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::BitMaskCount(mask, stride, width, height, count);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::BitMaskCount(mask, stride, width, height, count);
+    else
+#endif
+        Base::BitMaskCount(mask, stride, width, height, count);
+}
+
+SIMD_API void SimdBitMaskBoundingBox(const uint8_t * mask, size_t stride, size_t width, size_t height,
+    ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable)
+        Avx2::BitMaskBoundingBox(mask, stride, width, height, left, top, right, bottom);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable)
+        Sse41::BitMaskBoundingBox(mask, stride, width, height, left, top, right, bottom);
+    else
+#endif
+        Base::BitMaskBoundingBox(mask, stride, width, height, left, top, right, bottom);
+}
+
+SIMD_API void SimdBitMaskCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
+    const uint8_t * mask, size_t maskStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A && pixelSize <= 4)
+        Avx2::BitMaskCopy(src, srcStride, width, height, pixelSize, mask, maskStride, dst, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A && pixelSize <= 4)
+        Sse41::BitMaskCopy(src, srcStride, width, height, pixelSize, mask, maskStride, dst, dstStride);
+    else
+#endif
+        Base::BitMaskCopy(src, srcStride, width, height, pixelSize, mask, maskStride, dst, dstStride);
+}
+
+SIMD_API void SimdBitMaskFill(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize,
+    const uint8_t * mask, size_t maskStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A && pixelSize <= 4)
+        Avx2::BitMaskFill(dst, dstStride, width, height, pixel, pixelSize, mask, maskStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A && pixelSize <= 4)
+        Sse41::BitMaskFill(dst, dstStride, width, height, pixel, pixelSize, mask, maskStride);
+    else
+#endif
+        Base::BitMaskFill(dst, dstStride, width, height, pixel, pixelSize, mask, maskStride);
+}
+
 SIMD_API void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height,
                                    uint8_t value, SimdCompareType compareType, uint32_t * count)
 {
@@ -1843,7 +2089,13 @@ SIMD_API void SimdConditionalFill(const uint8_t * src, size_t srcStride, size_t
 SIMD_API void SimdCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
-    Base::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdCopy(src + begin * srcStride, srcStride, width, end - begin, pixelSize, dst + begin * dstStride, dstStride);
+        });
+    else
+        Base::Copy(src, srcStride, width, height, pixelSize, dst, dstStride);
 }
 
 SIMD_API void SimdCopyFrame(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
@@ -1975,6 +2227,9 @@ SIMD_API void SimdDetectionHaarDetect32fp(const void * hid, const uint8_t * mask
 {
     SIMD_EMPTY();
     size_t width = right - left;
+    if (Base::DetectionProfiling(hid))
+        Base::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DetectionHaarDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
@@ -2003,6 +2258,9 @@ SIMD_API void SimdDetectionHaarDetect32fi(const void * hid, const uint8_t * mask
 {
     SIMD_EMPTY();
     size_t width = right - left;
+    if (Base::DetectionProfiling(hid))
+        Base::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DetectionHaarDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
@@ -2031,6 +2289,9 @@ SIMD_API void SimdDetectionLbpDetect32fp(const void * hid, const uint8_t * mask,
 {
     SIMD_EMPTY();
     size_t width = right - left;
+    if (Base::DetectionProfiling(hid))
+        Base::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DetectionLbpDetect32fp(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
@@ -2059,6 +2320,9 @@ SIMD_API void SimdDetectionLbpDetect32fi(const void * hid, const uint8_t * mask,
 {
     SIMD_EMPTY();
     size_t width = right - left;
+    if (Base::DetectionProfiling(hid))
+        Base::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DetectionLbpDetect32fi(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
@@ -2087,6 +2351,9 @@ SIMD_API void SimdDetectionLbpDetect16ip(const void * hid, const uint8_t * mask,
 {
     SIMD_EMPTY();
     size_t width = right - left;
+    if (Base::DetectionProfiling(hid))
+        Base::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DetectionLbpDetect16ip(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
@@ -2115,6 +2382,9 @@ SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask,
 {
     SIMD_EMPTY();
     size_t width = right - left;
+    if (Base::DetectionProfiling(hid))
+        Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
@@ -2138,6 +2408,18 @@ SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask,
         Base::DetectionLbpDetect16ii(hid, mask, maskStride, left, top, right, bottom, dst, dstStride);
 }
 
+SIMD_API void SimdDetectionSetProfiling(void * hid, SimdBool enable)
+{
+    SIMD_EMPTY();
+    Base::DetectionSetProfiling(hid, enable);
+}
+
+SIMD_API void SimdDetectionGetProfiling(const void * hid, size_t * stageNumber, uint64_t * windows, uint64_t * passed)
+{
+    SIMD_EMPTY();
+    Base::DetectionGetProfiling(hid, stageNumber, windows, passed);
+}
+
 SIMD_API void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height,
                                  uint8_t * background, size_t backgroundStride)
 {
@@ -2831,6 +3113,38 @@ SIMD_API void SimdGrayToBgra(const uint8_t * gray, size_t width, size_t height,
         Base::GrayToBgra(gray, width, height, grayStride, bgra, bgraStride, alpha);
 }
 
+SIMD_API void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+    else
+#endif
+        Base::HslToBgr(hsl, width, height, hslStride, bgr, bgrStride);
+}
+
+SIMD_API void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+    else
+#endif
+        Base::HsvToBgr(hsv, width, height, hsvStride, bgr, bgrStride);
+}
+
 SIMD_API void SimdAbsSecondDerivativeHistogram(const uint8_t *src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram)
 {
     SIMD_EMPTY();
@@ -3320,6 +3634,9 @@ SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width,
                       SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
 {
     SIMD_EMPTY();
+    if (Base::IntegralParallelEnable(width, height, tilted))
+        Base::IntegralParallel(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, sumFormat, sqsumFormat);
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
@@ -4346,91 +4663,262 @@ SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, s
     simdNeuralConvolutionForward(src, srcWidth, srcHeight, srcDepth, weight, kernelX, kernelY, padX, padY, strideX, strideY, dilationX, dilationY, buffer, size, dst, dstWidth, dstHeight, dstDepth, add);
 }
 
-SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-               size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
+SIMD_API void SimdNv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 2, [=](size_t begin, size_t end)
+        {
+            SimdNv12ToBgr(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgr + begin * bgrStride, bgrStride, yuvType);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+        Avx512bw::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width*channelCount >= Avx2::A)
-        Avx2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width*channelCount >= Sse41::A)
-        Sse41::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width*channelCount >= Vmx::A)
-        Vmx::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width*channelCount >= Neon::A)
-        Neon::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
     else
 #endif
-        Base::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+        Base::Nv12ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
 }
 
-SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
-                                    size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type)
+SIMD_API void SimdNv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 2, [=](size_t begin, size_t end)
+        {
+            SimdNv12ToBgra(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+        Avx512bw::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::HA)
-        Avx2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::HA)
-        Sse41::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::HA)
-        Vmx::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
-    else
-#endif
-#ifdef SIMD_NEON_ENABLE
-    if (Neon::Enable && width >= Neon::HA)
-        Neon::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
     else
 #endif
-        Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+        Base::Nv12ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
 }
 
-SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
+SIMD_API void SimdNv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 2, [=](size_t begin, size_t end)
+        {
+            SimdNv12ToRgb(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, rgb + begin * rgbStride, rgbStride, yuvType);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
-        Avx512bw::VectorProduct(vertical, horizontal, dst, stride, width, height);
+        Avx512bw::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
     else
 #endif
 #ifdef SIMD_AVX2_ENABLE
-    if(Avx2::Enable && width >= Avx2::A)
-        Avx2::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
     else
 #endif
 #ifdef SIMD_SSE41_ENABLE
-    if(Sse41::Enable && width >= Sse41::A)
-        Sse41::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
     else
 #endif
-#ifdef SIMD_VMX_ENABLE
-    if(Vmx::Enable && width >= Vmx::A)
-        Vmx::VectorProduct(vertical, horizontal, dst, stride, width, height);
+        Base::Nv12ToRgb(y, yStride, uv, uvStride, width, height, rgb, rgbStride, yuvType);
+}
+
+SIMD_API void SimdNv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 2, [=](size_t begin, size_t end)
+        {
+            SimdNv12ToRgba(y + begin * yStride, yStride, uv + begin / 2 * uvStride, uvStride, width, end - begin, rgba + begin * rgbaStride, rgbaStride, alpha, yuvType);
+        });
+    else
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Nv12ToRgba(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Nv12ToRgba(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Nv12ToRgba(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+    else
+#endif
+        Base::Nv12ToRgba(y, yStride, uv, uvStride, width, height, rgba, rgbaStride, alpha, yuvType);
+}
+
+SIMD_API void SimdP010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::P010ToBgr(y, yStride, uv, uvStride, width, height, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdP010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::P010ToBgra(y, yStride, uv, uvStride, width, height, bgra, bgraStride, alpha, yuvType);
+}
+
+SIMD_API void SimdP010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, const float* lower, const float* upper, float* dst, SimdBool rgb, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && width >= Avx512bw::F)
+        Avx512bw::P010ToPlanar32f(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::F)
+        Avx2::P010ToPlanar32f(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::F)
+        Sse41::P010ToPlanar32f(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb, yuvType);
+    else
+#endif
+        Base::P010ToPlanar32f(y, yStride, uv, uvStride, width, height, lower, upper, dst, rgb, yuvType);
+}
+
+SIMD_API void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+               size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width*channelCount >= Avx2::A)
+        Avx2::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if(Sse41::Enable && width*channelCount >= Sse41::A)
+        Sse41::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width*channelCount >= Vmx::A)
+        Vmx::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width*channelCount >= Neon::A)
+        Neon::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+    else
+#endif
+        Base::OperationBinary8u(a, aStride, b, bStride, width, height, channelCount, dst, dstStride, type);
+}
+
+SIMD_API void SimdOperationBinary16i(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
+                                    size_t width, size_t height, uint8_t * dst, size_t dstStride, SimdOperationBinary16iType type)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::HA)
+        Avx2::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if(Sse41::Enable && width >= Sse41::HA)
+        Sse41::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::HA)
+        Vmx::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && width >= Neon::HA)
+        Neon::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+    else
+#endif
+        Base::OperationBinary16i(a, aStride, b, bStride, width, height, dst, dstStride, type);
+}
+
+SIMD_API void SimdVectorProduct(const uint8_t * vertical, const uint8_t * horizontal, uint8_t * dst, size_t stride, size_t width, size_t height)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if(Sse41::Enable && width >= Sse41::A)
+        Sse41::VectorProduct(vertical, horizontal, dst, stride, width, height);
+    else
+#endif
+#ifdef SIMD_VMX_ENABLE
+    if(Vmx::Enable && width >= Vmx::A)
+        Vmx::VectorProduct(vertical, horizontal, dst, stride, width, height);
     else
 #endif
 #ifdef SIMD_NEON_ENABLE
@@ -4579,6 +5067,33 @@ SIMD_API void SimdReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcH
         Base::ReduceGray4x4(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
 }
 
+SIMD_API void SimdReduceGray4x4Max(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable && srcWidth > Avx512bw::DA)
+        Avx512bw::ReduceGray4x4Max(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && srcWidth > Avx2::DA)
+        Avx2::ReduceGray4x4Max(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && srcWidth > Sse41::A)
+        Sse41::ReduceGray4x4Max(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && srcWidth > Neon::DA)
+        Neon::ReduceGray4x4Max(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+    else
+#endif
+        Base::ReduceGray4x4Max(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+}
+
 SIMD_API void SimdReduceGray5x5(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
                    uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation)
 {
@@ -4751,6 +5266,22 @@ SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t s
     ((Resizer*)resizer)->Run(src, srcStride, dst, dstStride);
 }
 
+SIMD_API void * SimdYuv420pResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method)
+{
+    SIMD_EMPTY();
+    typedef void*(*SimdYuv420pResizerInitPtr) (size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
+    const static SimdYuv420pResizerInitPtr simdYuv420pResizerInit = SIMD_FUNC3(ResizerYuv420pInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdYuv420pResizerInit(srcX, srcY, dstX, dstY, format, yuvType, method);
+}
+
+SIMD_API void SimdYuv420pResizerRun(const void * resizer, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride,
+    const uint8_t * v, size_t vStride, uint8_t * dst, size_t dstStride)
+{
+    SIMD_EMPTY();
+    ((Base::ResizerYuv420p*)resizer)->Run(y, yStride, u, uStride, v, vStride, dst, dstStride);
+}
+
 SIMD_API void SimdRgbToBgra(const uint8_t* rgb, size_t width, size_t height, size_t rgbStride, uint8_t* bgra, size_t bgraStride, uint8_t alpha)
 {
     SIMD_EMPTY();
@@ -5345,6 +5876,32 @@ SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t *a, size_t aStride, c
         Base::SquaredDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
 }
 
+SIMD_API void SimdSquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::SquaredDifferenceSums8u(a, b, size, count, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::A)
+        Avx2::SquaredDifferenceSums8u(a, b, size, count, sums);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && size >= Sse41::A)
+        Sse41::SquaredDifferenceSums8u(a, b, size, count, sums);
+    else
+#endif
+#ifdef SIMD_NEON_ENABLE
+    if (Neon::Enable && size >= Neon::A)
+        Neon::SquaredDifferenceSums8u(a, b, size, count, sums);
+    else
+#endif
+        Base::SquaredDifferenceSums8u(a, b, size, count, sums);
+}
+
 SIMD_API void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum)
 {
     SIMD_EMPTY();
@@ -6026,6 +6583,47 @@ SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src
 #endif
 }
 
+SIMD_API void SimdSynetDetectionDecode32f(const float* loc, const float* anchor, const float* variance, size_t count, float* box)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetDetectionDecode32fPtr) (const float* loc, const float* anchor, const float* variance, size_t count, float* box);
+    const static SimdSynetDetectionDecode32fPtr simdSynetDetectionDecode32f = SIMD_FUNC3(SynetDetectionDecode32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetDetectionDecode32f(loc, anchor, variance, count, box);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API size_t SimdSynetDetectionFilter32f(const float* score, size_t size, float threshold, uint32_t* index)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef size_t(*SimdSynetDetectionFilter32fPtr) (const float* score, size_t size, float threshold, uint32_t* index);
+    const static SimdSynetDetectionFilter32fPtr simdSynetDetectionFilter32f = SIMD_FUNC3(SynetDetectionFilter32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetDetectionFilter32f(score, size, threshold, index);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetDetectionNms32f(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef size_t(*SimdSynetDetectionNms32fPtr) (const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index);
+    const static SimdSynetDetectionNms32fPtr simdSynetDetectionNms32f = SIMD_FUNC3(SynetDetectionNms32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    return simdSynetDetectionNms32f(box, score, label, count, threshold, topK, index);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
 SIMD_API void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst)
 {
     SIMD_EMPTY();
@@ -6143,6 +6741,19 @@ SIMD_API void SimdSynetFusedLayerForward9(const float * src0, const float * src1
 #endif
 }
 
+SIMD_API void SimdSynetGelu32f(const float* src, size_t size, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetGelu32fPtr) (const float* src, size_t size, float* dst);
+    const static SimdSynetGelu32fPtr simdSynetGelu32f = SIMD_FUNC4(SynetGelu32f, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    simdSynetGelu32f(src, size, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetHardSigmoid32f(const float* src, size_t size, const float* scale, const float* shift, float* dst)
 {
     SIMD_EMPTY();
@@ -6421,6 +7032,36 @@ SIMD_API void SimdSynetNormalizeLayerForward(const float* src, size_t batch, siz
 #endif
 }
 
+SIMD_API void SimdSynetNormalizeLayerForwardV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+    const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetNormalizeLayerForwardV2Ptr) (const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+        const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+    const static SimdSynetNormalizeLayerForwardV2Ptr simdSynetNormalizeLayerForwardV2 = SIMD_FUNC3(SynetNormalizeLayerForwardV2, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetNormalizeLayerForwardV2(src, batch, channels, spatial, scale, shift, eps, format, activation, params, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
+SIMD_API void SimdSynetNormalizeLayerForwardV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+    const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void(*SimdSynetNormalizeLayerForwardV3Ptr) (const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+        const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+    const static SimdSynetNormalizeLayerForwardV3Ptr simdSynetNormalizeLayerForwardV3 = SIMD_FUNC3(SynetNormalizeLayerForwardV3, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC);
+
+    simdSynetNormalizeLayerForwardV3(src, batch, channels, spatial, group, scale, shift, eps, format, activation, params, buf, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void* SimdSynetPermuteInit(const size_t* shape, const size_t* order, size_t count, SimdTensorDataType type)
 {
     SIMD_EMPTY();
@@ -6503,6 +7144,43 @@ SIMD_API void SimdSynetPoolingMax8u(const uint8_t* src, size_t srcC, size_t srcH
 #endif
 }
 
+SIMD_API void* SimdSynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+    size_t strideY, size_t strideX, size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetPooling32fInitPtr) (size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+        size_t strideY, size_t strideX, size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format);
+    const static SimdSynetPooling32fInitPtr simdSynetPooling32fInit = SIMD_FUNC4(SynetPooling32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdSynetPooling32fInit(batch, channels, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dstH, dstW, method, excludePad, format);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetPooling32fInternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Base::SynetPooling32f*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetPooling32fForward(void* context, const float* src, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((Base::SynetPooling32f*)context)->Forward(src, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetPreluLayerForward(const float * src, const float * slope, size_t channels, size_t spatial, float * dst, SimdTensorFormatType format)
 {
     SIMD_EMPTY();
@@ -6696,6 +7374,41 @@ SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size
 #endif
 }
 
+SIMD_API void* SimdSynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    typedef void* (*SimdSynetSoftmax32fInitPtr) (size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+    const static SimdSynetSoftmax32fInitPtr simdSynetSoftmax32fInit = SIMD_FUNC4(SynetSoftmax32fInit, SIMD_AVX512BW_FUNC, SIMD_AVX2_FUNC, SIMD_SSE41_FUNC, SIMD_NEON_FUNC);
+
+    return simdSynetSoftmax32fInit(outer, count, inner, format);
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API size_t SimdSynetSoftmax32fInternalBufferSize(const void* context)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    return ((Base::SynetSoftmax32f*)context)->InternalBufferSize();
+#else
+    assert(0);
+    return 0;
+#endif
+}
+
+SIMD_API void SimdSynetSoftmax32fForward(void* context, const float* src, float* dst)
+{
+    SIMD_EMPTY();
+#if defined(SIMD_SYNET_ENABLE)
+    ((Base::SynetSoftmax32f*)context)->Forward(src, dst);
+#else
+    assert(0);
+#endif
+}
+
 SIMD_API void SimdSynetSoftplus32f(const float* src, size_t size, const float* beta, const float* threshold, float* dst)
 {
     SIMD_EMPTY();
@@ -6902,6 +7615,12 @@ SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStri
 SIMD_API void SimdTransformImage(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, SimdTransformType transform, uint8_t * dst, size_t dstStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdTransformImage(src + begin * srcStride, srcStride, width, end - begin, pixelSize, transform, dst + Base::ParallelRowsTransformOffset(transform, height, begin, end, pixelSize, dstStride), dstStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable && width >= Avx2::A)
         Avx512bw::TransformImage(src, srcStride, width, height, pixelSize, transform, dst, dstStride);
@@ -7308,10 +8027,58 @@ SIMD_API void SimdYuva444pToBgraV2(const uint8_t* y, size_t yStride, const uint8
         Base::Yuva444pToBgraV2(y, yStride, u, uStride, v, vStride, a, aStride, width, height, bgra, bgraStride, yuvType);
 }
 
+SIMD_API void SimdYuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, size_t bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+    else
+#endif
+        Base::Yuv420p16ToBgr(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgr, bgrStride, yuvType);
+}
+
+SIMD_API void SimdYuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, size_t bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
+{
+    SIMD_EMPTY();
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if (Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+    else
+#endif
+        Base::Yuv420p16ToBgra(y, yStride, u, uStride, v, vStride, width, height, bitDepth, bgra, bgraStride, alpha, yuvType);
+}
+
 SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 2, [=](size_t begin, size_t end)
+        {
+            SimdYuv420pToBgr(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -7344,6 +8111,12 @@ SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdYuv422pToBgr(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -7376,6 +8149,12 @@ SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t
                                size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdYuv444pToBgr(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgr + begin * bgrStride, bgrStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -7408,6 +8187,12 @@ SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 2, [=](size_t begin, size_t end)
+        {
+            SimdYuv420pToBgra(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -7440,6 +8225,12 @@ SIMD_API void SimdYuv420pToBgraV2(const uint8_t* y, size_t yStride, const uint8_
     size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 2, [=](size_t begin, size_t end)
+        {
+            SimdYuv420pToBgraV2(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv420pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
@@ -7467,6 +8258,12 @@ SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t
                                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdYuv422pToBgra(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -7499,6 +8296,12 @@ SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdYuv444pToBgra(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -7531,6 +8334,12 @@ SIMD_API void SimdYuv444pToBgraV2(const uint8_t* y, size_t yStride, const uint8_
     size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdYuv444pToBgraV2(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, bgra + begin * bgraStride, bgraStride, alpha, yuvType);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv444pToBgraV2(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha, yuvType);
@@ -7636,6 +8445,12 @@ SIMD_API void SimdYuv420pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 2, [=](size_t begin, size_t end)
+        {
+            SimdYuv420pToRgb(y + begin * yStride, yStride, u + begin / 2 * uStride, uStride, v + begin / 2 * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv420pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
@@ -7663,6 +8478,12 @@ SIMD_API void SimdYuv422pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdYuv422pToRgb(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv422pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
@@ -7690,6 +8511,12 @@ SIMD_API void SimdYuv444pToRgb(const uint8_t* y, size_t yStride, const uint8_t*
     size_t width, size_t height, uint8_t* rgb, size_t rgbStride)
 {
     SIMD_EMPTY();
+    if (Base::ParallelRowsEnable(width, height))
+        Base::ParallelRows(height, 1, [=](size_t begin, size_t end)
+        {
+            SimdYuv444pToRgb(y + begin * yStride, yStride, u + begin * uStride, uStride, v + begin * vStride, vStride, width, end - begin, rgb + begin * rgbStride, rgbStride);
+        });
+    else
 #ifdef SIMD_AVX512BW_ENABLE
     if (Avx512bw::Enable)
         Avx512bw::Yuv444pToRgb(y, yStride, u, uStride, v, vStride, width, height, rgb, rgbStride);
@@ -211,6 +211,14 @@ typedef enum
         \endverbatim
     */
     SimdConvolutionActivationSwish,
+    /*!
+        GELU (https://arxiv.org/abs/1606.08415) activation function.
+        It has no parameters.
+        \verbatim
+        dst[i] = src[i] * (1 + erf(src[i]/sqrt(2))) / 2;
+        \endverbatim
+    */
+    SimdConvolutionActivationGelu,
 } SimdConvolutionActivationType;
 
 /*! @ingroup c_types
@@ -297,6 +305,21 @@ typedef enum
     SimdOperationBinary8uSaturatedAddition,
 } SimdOperationBinary8uType;
 
+/*! @ingroup c_types
+    Describes types of binary operation between two bit-packed 1-bit masks performed by function ::SimdBitMaskOperation.
+*/
+typedef enum
+{
+    /*! Computes the bitwise AND between two masks (intersection). */
+    SimdBitMaskOperationAnd,
+    /*! Computes the bitwise OR between two masks (union). */
+    SimdBitMaskOperationOr,
+    /*! Computes the bitwise XOR between two masks (symmetric difference). */
+    SimdBitMaskOperationXor,
+    /*! Computes the bitwise AND between first mask and inverted second mask (difference). */
+    SimdBitMaskOperationAndNot,
+} SimdBitMaskOperationType;
+
 /*! @ingroup c_types
     Describes types of binary operation between two images performed by function ::SimdOperationBinary16i.
     Images must have ::SimdPixelFormatInt16 pixel format (signed 16-bit integer for every point).
@@ -358,6 +381,83 @@ typedef enum
     SimdPixelFormatArgb32,
 } SimdPixelFormatType;
 
+/*! @ingroup bayer_conversion
+    Describes demosaicing algorithm used in function ::SimdBayer16ToBgr.
+*/
+typedef enum
+{
+    SimdBayerDemosaicBilinear, /*!< Bilinear interpolation of missing color components (3x3 neighborhood). */
+    SimdBayerDemosaicMalvar, /*!< Gradient-corrected linear interpolation (Malvar-He-Cutler, 5x5 neighborhood). It gives much better quality on edges. */
+} SimdBayerDemosaicType;
+
+/*! @ingroup drawing
+    Describes type of layer blending in function ::SimdAlphaComposite.
+*/
+typedef enum
+{
+    /*! dst[x, y, c] = (src[x, y, c]*alpha[x, y] + dst[x, y, c]*(255 - alpha[x, y]))/255 (see ::SimdAlphaBlending).
+        If the alpha mask is NULL then uniform alpha value is used (see ::SimdAlphaBlendingUniform). */
+    SimdAlphaLayerBlend,
+    /*! dst[x, y, c] = (color[c]*alpha[x, y] + dst[x, y, c]*(255 - alpha[x, y]))/255 (see ::SimdAlphaFilling).
+        If the alpha mask is NULL then uniform alpha value is used. */
+    SimdAlphaLayerFill,
+    /*! dst[x, y, c] = src[x, y, c] + dst[x, y, c]*(255 - src[x, y, 3])/255. Source is premultiplied 32-bit BGRA (RGBA) image (see ::SimdAlphaPremultiply).
+        For 4-channel output image its alpha channel is also blended ("over" operation). */
+    SimdAlphaLayerPremultiplied,
+} SimdAlphaLayerType;
+
+/*! @ingroup drawing
+    \brief Describes one layer of function ::SimdAlphaComposite.
+*/
+typedef struct SimdAlphaLayer
+{
+    /*!
+        A type of layer blending.
+    */
+    SimdAlphaLayerType type;
+    /*!
+        A pointer to top left pixel of the layer image. Its channel count must be equal to channel count of output image (4 for ::SimdAlphaLayerPremultiplied).
+        It is ignored for ::SimdAlphaLayerFill.
+    */
+    const uint8_t* src;
+    /*!
+        A row size of the layer image.
+    */
+    size_t srcStride;
+    /*!
+        A pointer to top left pixel of 8-bit alpha mask of the layer. It can be NULL (uniform alpha value is used). It is ignored for ::SimdAlphaLayerPremultiplied.
+    */
+    const uint8_t* alpha;
+    /*!
+        A row size of the alpha mask.
+    */
+    size_t alphaStride;
+    /*!
+        A uniform alpha value. It is used if the alpha mask is NULL.
+    */
+    uint8_t value;
+    /*!
+        A fill color for ::SimdAlphaLayerFill (channel count is equal to channel count of output image).
+    */
+    uint8_t color[4];
+    /*!
+        A position of left column of the layer in output image. It can be negative (the layer is clipped).
+    */
+    ptrdiff_t left;
+    /*!
+        A position of top row of the layer in output image. It can be negative (the layer is clipped).
+    */
+    ptrdiff_t top;
+    /*!
+        A width of the layer.
+    */
+    size_t width;
+    /*!
+        A height of the layer.
+    */
+    size_t height;
+} SimdAlphaLayer;
+
 /*! @ingroup recursive_bilateral_filter
     Describes Recursive Bilateral Filter flags. This type used in function ::SimdRecursiveBilateralFilterInit.
 */
@@ -456,6 +556,15 @@ typedef enum
     SimdSynetEltwiseOperationMin, /*!< Minimum. */
 } SimdSynetEltwiseOperationType;
 
+/*! @ingroup synet_types
+    Describes pooling method used in function ::SimdSynetPooling32fInit.
+*/
+typedef enum
+{
+    SimdSynetPoolingMethodMax, /*!< Max pooling. */
+    SimdSynetPoolingMethodAverage, /*!< Average pooling. */
+} SimdSynetPoolingMethodType;
+
 /*! @ingroup synet_types
     Describes operation type used in function ::SimdSynetUnaryOperation32fLayerForward.
 */
@@ -813,6 +922,31 @@ extern "C"
     */
     SIMD_API void SimdSetThreadNumber(size_t threadNumber);
 
+    /*! @ingroup thread
+
+        \fn size_t SimdGetParallelThreshold();
+
+        \short Gets minimal image area at which some whole-image functions distribute rows between threads.
+
+        \return current threshold (in pixels). Zero value means that this mode is disabled.
+    */
+    SIMD_API size_t SimdGetParallelThreshold();
+
+    /*! @ingroup thread
+
+        \fn void SimdSetParallelThreshold(size_t area);
+
+        \short Sets minimal image area at which some whole-image functions distribute rows between threads.
+
+        This mode is disabled by default. If it is enabled, number of threads (see ::SimdSetThreadNumber) is greater than 1 and
+        image area (width*height) is not less than the threshold, then functions ::SimdAlphaBlending, ::SimdAlphaComposite, ::SimdBayer16ToBgr, ::SimdBayerToBgr, ::SimdBayerToBgra,
+        ::SimdBgrToGray, ::SimdCopy, ::SimdTransformImage, NV12 and YUV420P/YUV422P/YUV444P to BGR/BGRA/RGB conversions process
+        horizontal stripes of image in parallel. The result is identical to single-threaded one.
+
+        \param [in] area - a minimal image area (in pixels). Zero value disables this mode.
+    */
+    SIMD_API void SimdSetParallelThreshold(size_t area);
+
     /*! @ingroup cpu_flags
 
         \fn void SimdEmpty();
@@ -1051,6 +1185,46 @@ extern "C"
         const uint8_t * lo, size_t loStride, const uint8_t * hi, size_t hiStride,
         uint16_t weight, uint8_t * difference, size_t differenceStride);
 
+    /*! @ingroup difference_estimation
+
+        \fn void SimdFeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride, const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride, uint8_t * difference, size_t differenceStride);
+
+        \short Estimates total weighted difference of several features in one pass.
+
+        All images must have the same width, height and format (8-bit gray). All feature images (value, lo and hi) must have the same row size.
+
+        For every point:
+        \verbatim
+        sum = 0;
+        for(k = 0; k < count; ++k)
+        {
+            excess = max(lo[k][i] - value[k][i], 0) + max(value[k][i] - hi[k][i], 0);
+            sum = min(sum + ((weight[k] * excess*excess) >> 16), 255);
+        }
+        difference[i] = mask ? sum & mask[i] : sum;
+        \endverbatim
+
+        This function is equivalent to zero filling of difference image, successive calling of ::SimdAddFeatureDifference for every feature
+        and masking of the result with using of ::SimdOperationBinary8u (::SimdOperationBinary8uAnd), but reads and writes difference image only once.
+        It is used for difference estimation in algorithm of motion detection.
+
+        \param [in] value - an array of pointers to pixels data of current feature values.
+        \param [in] lo - an array of pointers to pixels data of feature lower bounds of dynamic background.
+        \param [in] hi - an array of pointers to pixels data of feature upper bounds of dynamic background.
+        \param [in] stride - a row size of feature images.
+        \param [in] weight - an array of feature weights (unsigned 16-bit value).
+        \param [in] count - a number of features.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] mask - a pointer to pixels data of mask image. Can be NULL.
+        \param [in] maskStride - a row size of mask image.
+        \param [out] difference - a pointer to pixels data of image with total difference.
+        \param [in] differenceStride - a row size of difference image.
+    */
+    SIMD_API void SimdFeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+        const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+        uint8_t * difference, size_t differenceStride);
+
     /*! @ingroup drawing
 
         \fn void SimdAlphaBlending(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, const uint8_t * alpha, size_t alphaStride, uint8_t * dst, size_t dstStride);
@@ -1068,6 +1242,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::AlphaBlending(const View<A>& src, const View<A>& alpha, View<A>& dst).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] src - a pointer to pixels data of foreground image.
         \param [in] srcStride - a row size of the foreground image.
         \param [in] width - an image width.
@@ -1172,6 +1348,31 @@ extern "C"
     */
     SIMD_API void SimdAlphaBlendingUniform(const uint8_t* src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t alpha, uint8_t* dst, size_t dstStride);
 
+    /*! @ingroup drawing
+
+        \fn void SimdAlphaComposite(const SimdAlphaLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height, size_t channelCount);
+
+        \short Composites several layers onto the image in one pass.
+
+        Layers are blended in the given order (see ::SimdAlphaLayerType), every layer is clipped by the image borders.
+        The image is processed by horizontal bands of cache size: all layers which cover a band are blended into it
+        while the band stays in the cache, bands which are not covered by any layer are not touched. The result is the same
+        as the result of sequential calls of ::SimdAlphaBlending, ::SimdAlphaBlendingUniform and ::SimdAlphaFilling for every layer.
+
+        \note This function has a C++ wrapper Simd::AlphaComposite(const SimdAlphaLayer* layers, size_t count, View<A>& dst).
+
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
+        \param [in] layers - a pointer to array with descriptions of layers.
+        \param [in] count - a number of layers.
+        \param [in, out] dst - a pointer to pixels data of background image.
+        \param [in] dstStride - a row size of the background image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] channelCount - a channel count of the image (1 <= channelCount <= 4).
+    */
+    SIMD_API void SimdAlphaComposite(const SimdAlphaLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height, size_t channelCount);
+
     /*! @ingroup drawing
 
         \fn void SimdAlphaFilling(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * channel, size_t channelCount, const uint8_t * alpha, size_t alphaStride);
@@ -1576,6 +1777,34 @@ extern "C"
     */
     SIMD_API void SimdBase64Encode(const uint8_t* src, size_t size, uint8_t* dst);
 
+    /*! @ingroup bayer_conversion
+
+        \fn void SimdBayer16ToBgr(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth, const float* gains, SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth);
+
+        \short Converts 16-bit Bayer image (raw sensor data with 8-16 significant bits) to 24-bit BGR or 48-bit BGR image.
+
+        White balance gains are applied to raw values before demosaicing. Missing color components are interpolated with bilinear
+        or gradient-corrected (Malvar-He-Cutler) filter. Image borders are processed with reflection (101) of the rows and the columns.
+        All images must have the same width and height. The width and the height must be even and not less than 4.
+
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
+        \param [in] bayer - a pointer to pixels data of input 16-bit Bayer image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bayerStride - a row size of the bayer image (in bytes).
+        \param [in] bayerFormat - a format of the input bayer image. It can be ::SimdPixelFormatBayerGrbg, ::SimdPixelFormatBayerGbrg, ::SimdPixelFormatBayerRggb or ::SimdPixelFormatBayerBggr.
+        \param [in] bitDepth - a number of significant bits of input values. It must be in range [8, 16].
+        \param [in] gains - a pointer to array with white balance gains for blue, green and red channels. Gains are restricted by range [0, 8).
+            It can be NULL (no white balance).
+        \param [in] demosaic - a demosaicing algorithm (see ::SimdBayerDemosaicType).
+        \param [out] bgr - a pointer to pixels data of output BGR image.
+        \param [in] bgrStride - a row size of the bgr image (in bytes).
+        \param [in] bgrDepth - a bit depth of output channels. It can be 8 (24-bit BGR image) or 16 (48-bit BGR image which keeps bit depth of input image).
+    */
+    SIMD_API void SimdBayer16ToBgr(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth,
+        const float* gains, SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth);
+
     /*! @ingroup bayer_conversion
 
         \fn void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride);
@@ -1586,6 +1815,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BayerToBgr(const View<A>& bayer, View<A>& bgr).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1606,6 +1837,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BayerToBgra(const View<A>& bayer, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] bayer - a pointer to pixels data of input 8-bit Bayer image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1935,6 +2168,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::BgrToGray(const View<A>& bgr, View<A>& gray).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
         \param [in] width - an image width.
         \param [in] height - an image height.
@@ -1982,6 +2217,36 @@ extern "C"
     */
     SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
 
+    /*! @ingroup bgr_conversion
+
+        \fn void SimdBgrToHsvRangeMask(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lo, const uint8_t * hi, uint8_t * mask, size_t maskStride);
+
+        \short Converts 24-bit BGR image to HSV color space and thresholds it by HSV range in one pass.
+
+        All images must have the same width and height. The intermediate HSV image is not stored.
+        HSV values are the same as ones produced by ::SimdBgrToHsv.
+
+        For every point:
+        \verbatim
+        hsv = BgrToHsv(bgr[x, y]);
+        hue = lo[0] <= hi[0] ? (lo[0] <= hsv[0] && hsv[0] <= hi[0]) : (lo[0] <= hsv[0] || hsv[0] <= hi[0]);
+        mask[x, y] = hue && lo[1] <= hsv[1] && hsv[1] <= hi[1] && lo[2] <= hsv[2] && hsv[2] <= hi[2] ? 255 : 0;
+        \endverbatim
+        If lo[0] is greater than hi[0] then the hue range wraps around (it is useful for red colors).
+
+        \note This function has a C++ wrapper Simd::BgrToHsvRangeMask(const View<A>& bgr, const uint8_t * lo, const uint8_t * hi, View<A>& mask).
+
+        \param [in] bgr - a pointer to pixels data of input 24-bit BGR image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] lo - a pointer to lower bounds of HSV range (3 values: hue, saturation, value).
+        \param [in] hi - a pointer to upper bounds of HSV range (3 values: hue, saturation, value).
+        \param [out] mask - a pointer to pixels data of output 8-bit gray mask.
+        \param [in] maskStride - a row size of the mask image.
+    */
+    SIMD_API void SimdBgrToHsvRangeMask(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lo, const uint8_t * hi, uint8_t * mask, size_t maskStride);
+
     /*! @ingroup bgr_conversion
 
         \fn void SimdBgrToRgb(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * rgb, size_t rgbStride);
@@ -2190,6 +2455,188 @@ extern "C"
     SIMD_API void SimdAveragingBinarizationV2(const uint8_t* src, size_t srcStride, size_t width, size_t height,
         size_t neighborhood, int32_t shift, uint8_t positive, uint8_t negative, uint8_t* dst, size_t dstStride);
 
+    /*! @ingroup bit_mask
+
+        \fn void SimdBitMaskPack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Packs 8-bit gray mask to bit-packed 1-bit mask.
+
+        Every row of the bit-packed mask consists of (width + 7) / 8 bytes. Point x of the row is stored in bit (x & 7) of byte (x >> 3).
+        Unused bits of the last byte in every row are set to zero.
+
+        For every point:
+        \verbatim
+        dst[x >> 3, y] |= src[x, y] != 0 ? 1 << (x & 7) : 0;
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::BitMaskPack(const View<A>& src, BitMask<A>& dst).
+
+        \param [in] src - a pointer to pixels data of input 8-bit gray mask.
+        \param [in] srcStride - a row size of the input mask (in bytes).
+        \param [in] width - a width of the masks (in points).
+        \param [in] height - a height of the masks.
+        \param [out] dst - a pointer to data of output bit-packed mask.
+        \param [in] dstStride - a row size of the output bit-packed mask (in bytes).
+    */
+    SIMD_API void SimdBitMaskPack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup bit_mask
+
+        \fn void SimdBitMaskUnpack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Unpacks bit-packed 1-bit mask to 8-bit gray mask.
+
+        For every point:
+        \verbatim
+        dst[x, y] = src[x >> 3, y] & (1 << (x & 7)) ? 255 : 0;
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::BitMaskUnpack(const BitMask<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to data of input bit-packed mask.
+        \param [in] srcStride - a row size of the input bit-packed mask (in bytes).
+        \param [in] width - a width of the masks (in points).
+        \param [in] height - a height of the masks.
+        \param [out] dst - a pointer to pixels data of output 8-bit gray mask.
+        \param [in] dstStride - a row size of the output mask (in bytes).
+    */
+    SIMD_API void SimdBitMaskUnpack(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup bit_mask
+
+        \fn void SimdBitMaskOperation(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, SimdBitMaskOperationType type, uint8_t * dst, size_t dstStride);
+
+        \short Performs given binary operation between two bit-packed 1-bit masks.
+
+        All masks must have the same width and height. The output mask can be the same as one of the input masks.
+
+        \note This function has a C++ wrapper Simd::BitMaskOperation(const BitMask<A>& a, const BitMask<A>& b, SimdBitMaskOperationType type, BitMask<A>& dst).
+
+        \param [in] a - a pointer to data of the first input bit-packed mask.
+        \param [in] aStride - a row size of the first input mask (in bytes).
+        \param [in] b - a pointer to data of the second input bit-packed mask.
+        \param [in] bStride - a row size of the second input mask (in bytes).
+        \param [in] width - a width of the masks (in points).
+        \param [in] height - a height of the masks.
+        \param [in] type - a type of operation (see ::SimdBitMaskOperationType).
+        \param [out] dst - a pointer to data of the output bit-packed mask.
+        \param [in] dstStride - a row size of the output mask (in bytes).
+    */
+    SIMD_API void SimdBitMaskOperation(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, 
+        size_t width, size_t height, SimdBitMaskOperationType type, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup bit_mask
+
+        \fn void SimdBitMaskNot(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+        \short Inverts bit-packed 1-bit mask.
+
+        Unused bits of the last byte in every row of the output mask are set to zero. The output mask can be the same as the input mask.
+
+        \note This function has a C++ wrapper Simd::BitMaskNot(const BitMask<A>& src, BitMask<A>& dst).
+
+        \param [in] src - a pointer to data of the input bit-packed mask.
+        \param [in] srcStride - a row size of the input mask (in bytes).
+        \param [in] width - a width of the masks (in points).
+        \param [in] height - a height of the masks.
+        \param [out] dst - a pointer to data of the output bit-packed mask.
+        \param [in] dstStride - a row size of the output mask (in bytes).
+    */
+    SIMD_API void SimdBitMaskNot(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup bit_mask
+
+        \fn void SimdBitMaskCount(const uint8_t * mask, size_t stride, size_t width, size_t height, uint64_t * count);
+
+        \short Calculates number of set points (area) of bit-packed 1-bit mask.
+
+        \note This function has a C++ wrapper Simd::BitMaskCount(const BitMask<A>& mask).
+
+        \param [in] mask - a pointer to data of the bit-packed mask.
+        \param [in] stride - a row size of the mask (in bytes).
+        \param [in] width - a width of the mask (in points).
+        \param [in] height - a height of the mask.
+        \param [out] count - a pointer to result number of set points.
+    */
+    SIMD_API void SimdBitMaskCount(const uint8_t * mask, size_t stride, size_t width, size_t height, uint64_t * count);
+
+    /*! @ingroup bit_mask
+
+        \fn void SimdBitMaskBoundingBox(const uint8_t * mask, size_t stride, size_t width, size_t height, ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
+
+        \short Finds bounding box of set points of bit-packed 1-bit mask.
+
+        The bounding box is [left, right) x [top, bottom). If the mask has no set points then all sides are set to zero.
+
+        \note This function has a C++ wrapper Simd::BitMaskBoundingBox(const BitMask<A>& mask).
+
+        \param [in] mask - a pointer to data of the bit-packed mask.
+        \param [in] stride - a row size of the mask (in bytes).
+        \param [in] width - a width of the mask (in points).
+        \param [in] height - a height of the mask.
+        \param [out] left - a pointer to left side of the bounding box.
+        \param [out] top - a pointer to top side of the bounding box.
+        \param [out] right - a pointer to right side of the bounding box.
+        \param [out] bottom - a pointer to bottom side of the bounding box.
+    */
+    SIMD_API void SimdBitMaskBoundingBox(const uint8_t * mask, size_t stride, size_t width, size_t height, 
+        ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
+
+    /*! @ingroup bit_mask
+
+        \fn void SimdBitMaskCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, const uint8_t * mask, size_t maskStride, uint8_t * dst, size_t dstStride);
+
+        \short Copies pixels of image selected by bit-packed 1-bit mask.
+
+        All images must have the same width, height and pixel size.
+
+        For every point:
+        \verbatim
+        if(mask[x >> 3, y] & (1 << (x & 7)))
+            dst[x, y] = src[x, y];
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::BitMaskCopy(const View<A>& src, const BitMask<A>& mask, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the input image.
+        \param [in] srcStride - a row size of the input image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] pixelSize - a size of the image pixel (in bytes).
+        \param [in] mask - a pointer to data of the bit-packed mask.
+        \param [in] maskStride - a row size of the mask (in bytes).
+        \param [in, out] dst - a pointer to pixels data of the output image.
+        \param [in] dstStride - a row size of the output image (in bytes).
+    */
+    SIMD_API void SimdBitMaskCopy(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize, 
+        const uint8_t * mask, size_t maskStride, uint8_t * dst, size_t dstStride);
+
+    /*! @ingroup bit_mask
+
+        \fn void SimdBitMaskFill(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize, const uint8_t * mask, size_t maskStride);
+
+        \short Fills pixels of image selected by bit-packed 1-bit mask by given value.
+
+        For every point:
+        \verbatim
+        if(mask[x >> 3, y] & (1 << (x & 7)))
+            dst[x, y] = pixel;
+        \endverbatim
+
+        \note This function has a C++ wrapper Simd::BitMaskFill(View<A>& dst, const BitMask<A>& mask, const Pixel& pixel).
+
+        \param [in, out] dst - a pointer to pixels data of the image.
+        \param [in] dstStride - a row size of the image (in bytes).
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] pixel - a pointer to pixel value.
+        \param [in] pixelSize - a size of the image pixel (in bytes).
+        \param [in] mask - a pointer to data of the bit-packed mask.
+        \param [in] maskStride - a row size of the mask (in bytes).
+    */
+    SIMD_API void SimdBitMaskFill(uint8_t * dst, size_t dstStride, size_t width, size_t height, const uint8_t * pixel, size_t pixelSize, 
+        const uint8_t * mask, size_t maskStride);
+
     /*! @ingroup conditional
 
         \fn void SimdConditionalCount8u(const uint8_t * src, size_t stride, size_t width, size_t height, uint8_t value, SimdCompareType compareType, uint32_t * count);
@@ -2376,6 +2823,8 @@ extern "C"
 
         \note This function has a C++ wrapper Simd::Copy(const View<A> & src, View<B> & dst).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] src - a pointer to pixels data of source image.
         \param [in] srcStride - a row size of the src image.
         \param [in] width - an image width.
@@ -2728,6 +3177,39 @@ extern "C"
     SIMD_API void SimdDetectionLbpDetect16ii(const void * hid, const uint8_t * mask, size_t maskStride,
         ptrdiff_t left, ptrdiff_t top, ptrdiff_t right, ptrdiff_t bottom, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup object_detection
+
+        \fn void SimdDetectionSetProfiling(void * hid, SimdBool enable);
+
+        \short Enables or disables collection of cascade stage statistics for hidden classifier cascade.
+
+        When profiling is enabled, functions ::SimdDetectionHaarDetect32fp, ::SimdDetectionHaarDetect32fi, ::SimdDetectionLbpDetect32fp,
+        ::SimdDetectionLbpDetect32fi, ::SimdDetectionLbpDetect16ip and ::SimdDetectionLbpDetect16ii count scanned windows and
+        the stage at which every window was rejected. In this mode they use scalar implementation, so profiling must be disabled
+        for performance measurements. Every call of this function resets accumulated statistics.
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in, out] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [in] enable - a flag to enable profiling.
+    */
+    SIMD_API void SimdDetectionSetProfiling(void * hid, SimdBool enable);
+
+    /*! @ingroup object_detection
+
+        \fn void SimdDetectionGetProfiling(const void * hid, size_t * stageNumber, uint64_t * windows, uint64_t * passed);
+
+        \short Gets cascade stage statistics accumulated since last call of function ::SimdDetectionSetProfiling.
+
+        \note This function is used for implementation of Simd::Detection.
+
+        \param [in] hid - a pointer to hidden cascade which was received with using of function ::SimdDetectionInit.
+        \param [out] stageNumber - a pointer to number of stages in the cascade. Can be NULL.
+        \param [out] windows - a pointer to total number of scanned windows. Can be NULL.
+        \param [out] passed - a pointer to array with number of windows which passed every stage. Its size must be equal to stage number. Can be NULL.
+    */
+    SIMD_API void SimdDetectionGetProfiling(const void * hid, size_t * stageNumber, uint64_t * windows, uint64_t * passed);
+
     /*! @ingroup edge_background
 
         \fn void SimdEdgeBackgroundGrowRangeSlow(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * background, size_t backgroundStride);
@@ -3480,6 +3962,44 @@ extern "C"
     SIMD_API void SimdGrayToBgra(const uint8_t *gray, size_t width, size_t height, size_t grayStride,
         uint8_t *bgra, size_t bgraStride, uint8_t alpha);
 
+    /*! @ingroup other_conversion
+
+        \fn void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts 24-bit HSL(Hue, Saturation, Lightness) image to 24-bit BGR image.
+
+        It is inverse conversion to ::SimdBgrToHsl. All images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::HslToBgr(const View<A>& hsl, View<A>& bgr).
+
+        \param [in] hsl - a pointer to pixels data of input 24-bit HSL image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] hslStride - a row size of the hsl image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdHslToBgr(const uint8_t * hsl, size_t width, size_t height, size_t hslStride, uint8_t * bgr, size_t bgrStride);
+
+    /*! @ingroup other_conversion
+
+        \fn void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
+
+        \short Converts 24-bit HSV(Hue, Saturation, Value) image to 24-bit BGR image.
+
+        It is inverse conversion to ::SimdBgrToHsv. All images must have the same width and height.
+
+        \note This function has a C++ wrapper Simd::HsvToBgr(const View<A>& hsv, View<A>& bgr).
+
+        \param [in] hsv - a pointer to pixels data of input 24-bit HSV image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] hsvStride - a row size of the hsv image.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+    */
+    SIMD_API void SimdHsvToBgr(const uint8_t * hsv, size_t width, size_t height, size_t hsvStride, uint8_t * bgr, size_t bgrStride);
+
     /*! @ingroup histogram
 
         \fn void SimdAbsSecondDerivativeHistogram(const uint8_t * src, size_t width, size_t height, size_t stride, size_t step, size_t indent, uint32_t * histogram);
@@ -4076,18 +4596,23 @@ extern "C"
         \n Simd::Integral(const View<A>& src, View<A>& sum, View<A>& sqsum),
         \n Simd::Integral(const View<A>& src, View<A>& sum, View<A>& sqsum, View<A>& tilted).
 
+        \note This function supports multithreading (See functions ::SimdGetThreadNumber and ::SimdSetThreadNumber).
+            Large images (at least 1 megapixel) without tilted integral are processed in two passes: rows of the image are
+            prefix-summed independently, then the column carries are propagated in parallel vertical strips.
+
         \param [in] src - a pointer to pixels data of input 8-bit gray image.
         \param [in] srcStride - a row size of src image.
         \param [in] width - an image width.
         \param [in] height - an image height.
         \param [out] sum - a pointer to pixels data of 32-bit integer sum image.
         \param [in] sumStride - a row size of sum image (in bytes).
-        \param [out] sqsum - a pointer to pixels data of 32-bit integer or 64-bit float point square sum image. It can be NULL.
+        \param [out] sqsum - a pointer to pixels data of 32-bit integer, 64-bit integer, 32-bit float or 64-bit float point square sum image. It can be NULL.
+            64-bit integer and float formats help to avoid overflow for large images.
         \param [in] sqsumStride - a row size of sqsum image (in bytes).
         \param [out] tilted - a pointer to pixels data of 32-bit integer tilted sum image. It can be NULL.
         \param [in] tiltedStride - a row size of tilted image (in bytes).
         \param [in] sumFormat - a format of sum image and tilted image. It can be equal to ::SimdPixelFormatInt32.
-        \param [in] sqsumFormat - a format of sqsum image. It can be equal to ::SimdPixelFormatInt32 or ::SimdPixelFormatDouble.
+        \param [in] sqsumFormat - a format of sqsum image. It can be equal to ::SimdPixelFormatInt32, ::SimdPixelFormatInt64, ::SimdPixelFormatFloat or ::SimdPixelFormatDouble.
     */
     SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
         uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
@@ -5136,20 +5661,208 @@ extern "C"
     */
     SIMD_API void SimdNeuralConvolutionForward(const float * src, size_t srcWidth, size_t srcHeight, size_t srcDepth, const float * weight, size_t kernelX, size_t kernelY, size_t padX, size_t padY, size_t strideX, size_t strideY, size_t dilationX, size_t dilationY, void * buffer, size_t * size, float * dst, size_t dstWidth, size_t dstHeight, size_t dstDepth, int add);
 
-    /*! @ingroup operation
+    /*! @ingroup nv12_conversion
 
-        \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+        \fn void SimdNv12ToBgr(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride, SimdYuvType yuvType);
 
-        \short Performs given operation between two images.
+        \short Converts NV12 image to 24-bit BGR image.
 
-        All images must have the same width, height and format (8-bit gray, 16-bit UV (UV plane of NV12 pixel format), 24-bit BGR or 32-bit BGRA).
+        NV12 image consists of 8-bit Y plane and 16-bit interleaved UV plane of half size.
+        Interleaved UV values are read directly without intermediate deinterleaving.
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height.
 
-        \note This function has a C++ wrappers: Simd::OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type).
+        \note This function has a C++ wrappers: Simd::Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
 
-        \param [in] a - a pointer to pixels data of the first input image.
-        \param [in] aStride - a row size of the first image.
-        \param [in] b - a pointer to pixels data of the second input image.
-        \param [in] bStride - a row size of the second image.
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the Y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the UV image.
+        \param [in] width - an image width. Width must be even number.
+        \param [in] height - an image height. Height must be even number.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup nv12_conversion
+
+        \fn void SimdNv12ToBgra(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        NV12 image consists of 8-bit Y plane and 16-bit interleaved UV plane of half size.
+        Interleaved UV values are read directly without intermediate deinterleaving.
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the Y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the UV image.
+        \param [in] width - an image width. Width must be even number.
+        \param [in] height - an image height. Height must be even number.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup nv12_conversion
+
+        \fn void SimdNv12ToRgb(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgb, size_t rgbStride, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        NV12 image consists of 8-bit Y plane and 16-bit interleaved UV plane of half size.
+        Interleaved UV values are read directly without intermediate deinterleaving.
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601).
+
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the Y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the UV image.
+        \param [in] width - an image width. Width must be even number.
+        \param [in] height - an image height. Height must be even number.
+        \param [out] rgb - a pointer to pixels data of output 24-bit RGB image.
+        \param [in] rgbStride - a row size of the rgb image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgb(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgb, size_t rgbStride, SimdYuvType yuvType);
+
+    /*! @ingroup nv12_conversion
+
+        \fn void SimdNv12ToRgba(const uint8_t * y, size_t yStride, const uint8_t * uv, size_t uvStride, size_t width, size_t height, uint8_t * rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts NV12 image to 32-bit RGBA image.
+
+        NV12 image consists of 8-bit Y plane and 16-bit interleaved UV plane of half size.
+        Interleaved UV values are read directly without intermediate deinterleaving.
+        The input Y and output RGBA images must have the same width and height.
+        The input UV image must have half width and half height.
+
+        \note This function has a C++ wrappers: Simd::Nv12ToRgba(const View<A>& y, const View<A>& uv, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the Y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the UV image.
+        \param [in] width - an image width. Width must be even number.
+        \param [in] height - an image height. Height must be even number.
+        \param [out] rgba - a pointer to pixels data of output 32-bit RGBA image.
+        \param [in] rgbaStride - a row size of the rgba image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdNv12ToRgba(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* rgba, size_t rgbaStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup nv12_conversion
+
+        \fn void SimdP010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts P010 image to 24-bit BGR image.
+
+        P010 is 10-bit analogue of NV12: it consists of 16-bit Y plane and 16-bit interleaved UV plane (half size relative to Y plane),
+        where 10-bit values are stored in most significant bits of every 16-bit word.
+        The input Y and output BGR images must have the same width and height. The width and the height must be even.
+        10-bit values are scaled to 8-bit output range in the fixed-point conversion itself (internal precision is 10 bits).
+
+        \note This function has a C++ wrappers: Simd::P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToBgr(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup nv12_conversion
+
+        \fn void SimdP010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts P010 image to 32-bit BGRA image.
+
+        P010 is 10-bit analogue of NV12: it consists of 16-bit Y plane and 16-bit interleaved UV plane (half size relative to Y plane),
+        where 10-bit values are stored in most significant bits of every 16-bit word.
+        The input Y and output BGRA images must have the same width and height. The width and the height must be even.
+        10-bit values are scaled to 8-bit output range in the fixed-point conversion itself (internal precision is 10 bits).
+
+        \note This function has a C++ wrappers: Simd::P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToBgra(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+    /*! @ingroup nv12_conversion
+
+        \fn void SimdP010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, const float* lower, const float* upper, float* dst, SimdBool rgb, SimdYuvType yuvType);
+
+        \short Converts P010 image to 32-bit float planar (NCHW) BGR or RGB image.
+
+        It is intended for preparation of neural network input: the output values of every channel are linearly mapped from range [0..255] to range [lower[c]..upper[c]].
+        The output consists of 3 planes with size width*height each (without padding).
+        The width and the height must be even.
+
+        \note This function has a C++ wrappers: Simd::P010ToPlanar32f(const View<A>& y, const View<A>& uv, const float* lower, const float* upper, float* dst, bool rgb = false, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] uv - a pointer to pixels data of input 16-bit image with interleaved UV color planes.
+        \param [in] uvStride - a row size of the uv image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] lower - a pointer to the array with lower bound of output values of every channel (in output channel order). Its size must be 3.
+        \param [in] upper - a pointer to the array with upper bound of output values of every channel (in output channel order). Its size must be 3.
+        \param [out] dst - a pointer to the output 32-bit float planar image. Its size must be 3*width*height.
+        \param [in] rgb - a flag of RGB channel order of output image. Otherwise BGR order is used.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdP010ToPlanar32f(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+        const float* lower, const float* upper, float* dst, SimdBool rgb, SimdYuvType yuvType);
+
+    /*! @ingroup operation
+
+        \fn void SimdOperationBinary8u(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride, SimdOperationBinary8uType type);
+
+        \short Performs given operation between two images.
+
+        All images must have the same width, height and format (8-bit gray, 16-bit UV (UV plane of NV12 pixel format), 24-bit BGR or 32-bit BGRA).
+
+        \note This function has a C++ wrappers: Simd::OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type).
+
+        \param [in] a - a pointer to pixels data of the first input image.
+        \param [in] aStride - a row size of the first image.
+        \param [in] b - a pointer to pixels data of the second input image.
+        \param [in] bStride - a row size of the second image.
         \param [in] width - an image width.
         \param [in] height - an image height.
         \param [in] channelCount - a channel count.
@@ -5365,6 +6078,36 @@ extern "C"
     SIMD_API void SimdReduceGray4x4(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
         uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn void SimdReduceGray4x4Max(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
+        \short Performs reducing and Gaussian blurring (in two time) a 8-bit gray image with using window 4x4 and stores maximum of the result and output image.
+
+        For input and output image must be performed: dstWidth = (srcWidth + 1)/2,  dstHeight = (srcHeight + 1)/2.
+
+        For every point:
+        \verbatim
+        dst[x, y] = max(dst[x, y], ReduceGray4x4(src)[x, y]);
+        \endverbatim
+
+        It is equivalent to calling of ::SimdReduceGray4x4 with temporary buffer and ::SimdOperationBinary8u (::SimdOperationBinary8uMaximum).
+        This function is used for difference propagation in algorithm of motion detection.
+
+        \note This function has a C++ wrappers: Simd::ReduceGray4x4Max(const View<A>& src, View<A>& dst).
+
+        \param [in] src - a pointer to pixels data of the original input image.
+        \param [in] srcWidth - a width of the input image.
+        \param [in] srcHeight - a height of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in, out] dst - a pointer to pixels data of the reduced output image.
+        \param [in] dstWidth - a width of the output image.
+        \param [in] dstHeight - a height of the output image.
+        \param [in] dstStride - a row size of the output image.
+    */
+    SIMD_API void SimdReduceGray4x4Max(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
     /*! @ingroup resizing
 
         \fn void SimdReduceGray5x5(const uint8_t * src, size_t srcWidth, size_t srcHeight, size_t srcStride, uint8_t * dst, size_t dstWidth, size_t dstHeight, size_t dstStride, int compensation);
@@ -5533,6 +6276,62 @@ extern "C"
     */
     SIMD_API void SimdResizerRun(const void * resizer, const uint8_t * src, size_t srcStride, uint8_t * dst, size_t dstStride);
 
+    /*! @ingroup resizing
+
+        \fn void * SimdYuv420pResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
+
+        \short Creates context of combined YUV420P (or NV12) to BGR conversion and resizing.
+
+        Y and UV planes are resized directly to the output grid (UV planes to the half size of output image) and then are converted 
+        to output format. So full size BGR image is never created: it essentially reduces memory traffic and latency when output image 
+        is smaller than input one (for example in preparation of neural network input from camera frames).
+        Output ::SimdPixelFormatGray8 image is the resized Y plane.
+
+        An using example (NV12 frame to 640x360 BGR image):
+        \verbatim
+        void * resizer = SimdYuv420pResizerInit(srcX, srcY, 640, 360, SimdPixelFormatBgr24, SimdYuvBt601, SimdResizeMethodArea);
+        if (resizer)
+        {
+             SimdYuv420pResizerRun(resizer, y, yStride, uv, uvStride, NULL, 0, bgr, bgrStride);
+             SimdRelease(resizer);
+        }
+        \endverbatim
+
+        \param [in] srcX - a width of the input image. It must be even.
+        \param [in] srcY - a height of the input image. It must be even.
+        \param [in] dstX - a width of the output image. It must be even.
+        \param [in] dstY - a height of the output image. It must be even.
+        \param [in] format - a pixel format of output image. It can be ::SimdPixelFormatGray8, ::SimdPixelFormatBgr24, ::SimdPixelFormatBgra32, 
+                     ::SimdPixelFormatRgb24 and ::SimdPixelFormatRgba32.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+        \param [in] method - a method used in order to resize image. It must be supported for 8-bit channels (::SimdResizeMethodBilinear 
+                     and ::SimdResizeMethodArea are recommended).
+        \return a pointer to resize context. On error it returns NULL. 
+                This pointer is used in functions ::SimdYuv420pResizerRun. 
+                It must be released with using of function ::SimdRelease.
+    */
+    SIMD_API void * SimdYuv420pResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
+
+    /*! @ingroup resizing
+
+        \fn void SimdYuv420pResizerRun(const void * resizer, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, uint8_t * dst, size_t dstStride);
+
+        \short Performs combined YUV420P (or NV12) to BGR conversion and resizing.
+
+        \param [in] resizer - a resize context. It must be created by function ::SimdYuv420pResizerInit and released by function ::SimdRelease.
+        \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 8-bit image with U color plane (half size relative to Y plane). 
+                     If v is NULL it points to pixels data of 16-bit image with interleaved UV planes (NV12 format).
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 8-bit image with V color plane (half size relative to Y plane). Can be NULL for NV12 input.
+        \param [in] vStride - a row size of the v image.
+        \param [out] dst - a pointer to pixels data of the resized output image.
+        \param [in] dstStride - a row size (in bytes) of the output image.
+    */
+    SIMD_API void SimdYuv420pResizerRun(const void * resizer, const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, 
+        const uint8_t * v, size_t vStride, uint8_t * dst, size_t dstStride);
+
     /*! @ingroup rgb_conversion
 
         \fn void SimdRgbToBgra(const uint8_t * rgb, size_t width, size_t height, size_t rgbStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
@@ -6002,6 +6801,32 @@ extern "C"
     SIMD_API void SimdSquaredDifferenceSumMasked(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride,
         const uint8_t * mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum);
 
+    /*! @ingroup correlation
+
+        \fn void SimdSquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums);
+
+        \short Calculates sums of squared differences between one 8-bit unsigned integer array and a set of arrays.
+
+        The compared arrays are stored contiguously one after another. It is used for fast batched brute-force search.
+
+        For every compared array:
+        \verbatim
+        for(i = 0; i < count; ++i)
+        {
+            sums[i] = 0;
+            for(j = 0; j < size; ++j)
+                sums[i] += (a[j] - b[i*size + j])*(a[j] - b[i*size + j]);
+        }
+        \endverbatim
+
+        \param [in] a - a pointer to the query array.
+        \param [in] b - a pointer to the set of compared arrays. Its total size is equal to size*count.
+        \param [in] size - a size of every array. It must be not greater than 65536.
+        \param [in] count - a number of compared arrays.
+        \param [out] sums - a pointer to output array with sums of squared differences. Its size must be equal to count.
+    */
+    SIMD_API void SimdSquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums);
+
     /*! @ingroup correlation
 
         \fn void SimdSquaredDifferenceSum32f(const float * a, const float * b, size_t size, float * sum);
@@ -6732,6 +7557,71 @@ extern "C"
     */
     SIMD_API void SimdSynetDeconvolution32fForward(void * context, const float * src, float * buf, float * dst);
 
+    /*! @ingroup synet_detection
+
+        \fn void SimdSynetDetectionDecode32f(const float* loc, const float* anchor, const float* variance, size_t count, float* box);
+
+        \short Decodes bounding boxes of DetectionOutputLayer (SSD-like CENTER_SIZE coding with variance).
+
+        For every box:
+        \verbatim
+        aw = anchor[2] - anchor[0], ah = anchor[3] - anchor[1];
+        cx = variance[0]*loc[0]*aw + (anchor[0] + anchor[2])/2;
+        cy = variance[1]*loc[1]*ah + (anchor[1] + anchor[3])/2;
+        w = exp(variance[2]*loc[2])*aw;
+        h = exp(variance[3]*loc[3])*ah;
+        box = {cx - w/2, cy - h/2, cx + w/2, cy + h/2};
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] loc - a pointer to 32-bit float array with encoded box offsets (dx, dy, dw, dh). The size of the array must be equal to 4*count.
+        \param [in] anchor - a pointer to 32-bit float array with anchor (prior) boxes (xmin, ymin, xmax, ymax). The size of the array must be equal to 4*count.
+        \param [in] variance - a pointer to 32-bit float array with 4 encoding variances.
+        \param [in] count - a number of boxes.
+        \param [out] box - a pointer to output 32-bit float array with decoded boxes (xmin, ymin, xmax, ymax). The size of the array must be equal to 4*count. It can be the same as loc.
+    */
+    SIMD_API void SimdSynetDetectionDecode32f(const float* loc, const float* anchor, const float* variance, size_t count, float* box);
+
+    /*! @ingroup synet_detection
+
+        \fn size_t SimdSynetDetectionFilter32f(const float* score, size_t size, float threshold, uint32_t* index);
+
+        \short Collects indices of confidence scores which are greater than given threshold.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] score - a pointer to 32-bit float array with confidence scores.
+        \param [in] size - a size of score array.
+        \param [in] threshold - a confidence threshold.
+        \param [out] index - a pointer to output array with indices of selected scores (in ascending order). Its size must be at least equal to size.
+        \return number of selected scores.
+    */
+    SIMD_API size_t SimdSynetDetectionFilter32f(const float* score, size_t size, float threshold, uint32_t* index);
+
+    /*! @ingroup synet_detection
+
+        \fn size_t SimdSynetDetectionNms32f(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index);
+
+        \short Performs class-aware non-maximum suppression of bounding boxes.
+
+        Boxes are processed in order of descending score. A box is dropped if its IoU (intersection over union) with an already 
+        kept box of the same class is greater than threshold. Boxes of different classes do not suppress each other, 
+        so candidates of all classes can be processed in one call.
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] box - a pointer to 32-bit float array with boxes (xmin, ymin, xmax, ymax). The size of the array must be equal to 4*count.
+        \param [in] score - a pointer to 32-bit float array with box scores. The size of the array must be equal to count.
+        \param [in] label - a pointer to 32-bit integer array with box class labels. The size of the array must be equal to count. Can be NULL (class-agnostic suppression).
+        \param [in] count - a number of input boxes.
+        \param [in] threshold - an IoU threshold.
+        \param [in] topK - a maximal number of output boxes. If it is equal to 0 then the number of output boxes is not restricted.
+        \param [out] index - a pointer to output array with indices of kept boxes (in order of descending score). Its size must be at least equal to min(count, topK).
+        \return number of kept boxes.
+    */
+    SIMD_API size_t SimdSynetDetectionNms32f(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index);
+
     /*! @ingroup synet_other
 
         \fn void SimdSynetEltwiseLayerForward(float const * const * src, const float * weight, size_t count, size_t size, SimdSynetEltwiseOperationType type, float * dst);
@@ -7023,6 +7913,28 @@ extern "C"
     */
     SIMD_API void SimdSynetFusedLayerForward9(const float * src0, const float * src1, const float * scale, const float * bias, size_t channels0, size_t channels1, size_t spatial, float * dst0, float * dst1, SimdTensorFormatType format);
 
+    /*! @ingroup synet_activation
+
+        \fn void SimdSynetGelu32f(const float * src, size_t size, float * dst);
+
+        \short Calculates GELU activation function (https://arxiv.org/abs/1606.08415) for 32-bit float array.
+
+        Input and output arrays must have the same size.
+
+        Algorithm's details:
+        \verbatim
+        for(i = 0; i < size; ++i)
+            dst[i] = src[i] * (1 + erf(src[i]/sqrt(2))) / 2;
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float array.
+        \param [in] size - a size of input and output arrays.
+        \param [out] dst - a pointer to the output 32-bit float array.
+    */
+    SIMD_API void SimdSynetGelu32f(const float * src, size_t size, float * dst);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetHardSigmoid32f(const float * src, size_t size, const float * scale, const float * shift, float * dst);
@@ -7426,6 +8338,91 @@ extern "C"
     SIMD_API void SimdSynetNormalizeLayerForward(const float* src, size_t batch, size_t channels, size_t spatial,
         const float* scale, const float* eps, SimdBool acrossSpatial, SimdTensorFormatType format, float* buf, float* dst);
 
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetNormalizeLayerForwardV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+        \short Performs forward propagation of LayerNorm layer (normalization across channels with following activation).
+
+        Algorithm's details (NHWC format):
+        \verbatim
+        for(b = 0; b < batch; ++b)
+            for(s = 0; s < spatial; ++s)
+            {
+                mean = 0;
+                for(c = 0; c < channels; ++c)
+                    mean += src[b, s, c] / channels;
+                var = 0;
+                for(c = 0; c < channels; ++c)
+                    var += Square(src[b, s, c] - mean) / channels;
+                for(c = 0; c < channels; ++c)
+                    dst[b, s, c] = Activation((src[b, s, c] - mean) / Sqrt(var + eps) * scale[c] + shift[c]);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float tensor.
+        \param [in] batch - a batch size of input and output tensor.
+        \param [in] channels - a number of channels in input and output tensor.
+        \param [in] spatial - a spatial size (height*width) of input and output tensor.
+        \param [in] scale - an array with scale parameters. The size of the array is equal to channels.
+        \param [in] shift - an array with shift parameters. The size of the array is equal to channels.
+        \param [in] eps - a pointer to epsilon parameter. It is used to prevent division by zero.
+        \param [in] format - a format of input and output tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] activation - an activation function type applied to the output (see ::SimdConvolutionActivationType).
+        \param [in] params - a pointer to parameters of the activation function (the same as in ::SimdConvolutionParameters). Can be NULL for activations without parameters.
+        \param [out] buf - a pointer to external temporary buffer. The size of the buffer must be equal to 2*spatial. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to the output 32-bit float tensor.
+    */
+    SIMD_API void SimdSynetNormalizeLayerForwardV2(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+        const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetNormalizeLayerForwardV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift, const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+        \short Performs forward propagation of GroupNorm layer (normalization across groups of channels and spatial dimensions with following activation).
+
+        Algorithm's details (NCHW format):
+        \verbatim
+        size = channels / group;
+        for(b = 0; b < batch; ++b)
+            for(g = 0; g < group; ++g)
+            {
+                mean = 0;
+                for(c = g*size; c < (g + 1)*size; ++c)
+                    for(s = 0; s < spatial; ++s)
+                        mean += src[b, c, s] / (size * spatial);
+                var = 0;
+                for(c = g*size; c < (g + 1)*size; ++c)
+                    for(s = 0; s < spatial; ++s)
+                        var += Square(src[b, c, s] - mean) / (size * spatial);
+                for(c = g*size; c < (g + 1)*size; ++c)
+                    for(s = 0; s < spatial; ++s)
+                        dst[b, c, s] = Activation((src[b, c, s] - mean) / Sqrt(var + eps) * scale[c] + shift[c]);
+            }
+        \endverbatim
+
+        \note This function is used in <a href="http://github.com/ermig1979/Synet">Synet Framework</a>.
+
+        \param [in] src - a pointer to the input 32-bit float tensor.
+        \param [in] batch - a batch size of input and output tensor.
+        \param [in] channels - a number of channels in input and output tensor.
+        \param [in] spatial - a spatial size (height*width) of input and output tensor.
+        \param [in] group - a number of channel groups. The number of channels must be divisible by it.
+        \param [in] scale - an array with scale parameters. The size of the array is equal to channels.
+        \param [in] shift - an array with shift parameters. The size of the array is equal to channels.
+        \param [in] eps - a pointer to epsilon parameter. It is used to prevent division by zero.
+        \param [in] format - a format of input and output tensor. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc.
+        \param [in] activation - an activation function type applied to the output (see ::SimdConvolutionActivationType).
+        \param [in] params - a pointer to parameters of the activation function (the same as in ::SimdConvolutionParameters). Can be NULL for activations without parameters.
+        \param [out] buf - a pointer to external temporary buffer. The size of the buffer must be equal to 2*channels. Can be NULL (it causes usage of internal buffer).
+        \param [out] dst - a pointer to the output 32-bit float tensor.
+    */
+    SIMD_API void SimdSynetNormalizeLayerForwardV3(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+        const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
     /*! @ingroup synet_permute
 
         \fn void* SimdSynetPermuteInit(const size_t * shape, const size_t* order, size_t count, SimdTensorDataType type);
@@ -7548,6 +8545,60 @@ extern "C"
     SIMD_API void SimdSynetPoolingMax8u(const uint8_t* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
         size_t strideY, size_t strideX, size_t padY, size_t padX, uint8_t* dst, size_t dstH, size_t dstW, SimdTensorFormatType format);
 
+    /*! @ingroup synet_pooling
+
+        \fn void* SimdSynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format);
+
+        \short Initilizes multithreaded pooling algorithm (32-bit float).
+
+        In contrast to ::SimdSynetPoolingMax32f and ::SimdSynetPoolingAverage it processes whole batch and supports blocked formats
+        (::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c). The work is distributed between threads 
+        (see ::SimdSetThreadNumber) over batch, channel blocks and output rows. Global pooling with small batch is split by input rows.
+
+        \param [in] batch - a batch size.
+        \param [in] channels - a number of input and output channels.
+        \param [in] srcH - an input height.
+        \param [in] srcW - an input width.
+        \param [in] kernelY - a height of the pooling kernel.
+        \param [in] kernelX - a width of the pooling kernel.
+        \param [in] strideY - a y-stride of the pooling.
+        \param [in] strideX - a x-stride of the pooling.
+        \param [in] padY - a pad to the top of the input image.
+        \param [in] padX - a pad to the left of the input image.
+        \param [in] dstH - an output height.
+        \param [in] dstW - an output width.
+        \param [in] method - a pooling method (see ::SimdSynetPoolingMethodType).
+        \param [in] excludePad - a flag of exclude pad from average value calculation.
+        \param [in] format - a format of (input/output) image tensor.
+        \return a pointer to pooling context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetPooling32fInternalBufferSize, and ::SimdSynetPooling32fForward.
+    */
+    SIMD_API void* SimdSynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, 
+        size_t strideY, size_t strideX, size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format);
+
+    /*! @ingroup synet_pooling
+
+        \fn size_t SimdSynetPooling32fInternalBufferSize(const void* context);
+
+        \short Gets size of internal buffer used inside pooling algorithm.
+
+        \param [in] context - a pointer to pooling context. It must be created by function ::SimdSynetPooling32fInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside pooling algorithm.
+    */
+    SIMD_API size_t SimdSynetPooling32fInternalBufferSize(const void* context);
+
+    /*! @ingroup synet_pooling
+
+        \fn void SimdSynetPooling32fForward(void* context, const float* src, float* dst);
+
+        \short Performs forward propagation of pooling algorithm.
+
+        \param [in] context - a pointer to pooling context. It must be created by function ::SimdSynetPooling32fInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to the input 32-bit float tensor. The size of the tensor must be equal to batch*channels*srcH*srcW (channels are aligned to block size for blocked formats).
+        \param [out] dst - a pointer to the output 32-bit float tensor. The size of the tensor must be equal to batch*channels*dstH*dstW (channels are aligned to block size for blocked formats).
+    */
+    SIMD_API void SimdSynetPooling32fForward(void* context, const float* src, float* dst);
+
 
     /*! @ingroup synet_activation
 
@@ -7831,6 +8882,55 @@ extern "C"
     */
     SIMD_API void SimdSynetSoftmaxLayerForward(const float * src, size_t outer, size_t count, size_t inner, float * dst);
 
+    /*! @ingroup synet_other
+
+        \fn void* SimdSynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+
+        \short Initilizes multithreaded softmax algorithm (32-bit float).
+
+        The work is distributed between threads (see ::SimdSetThreadNumber) over outer dimension. 
+        If outer size is less than number of threads then inner dimension is also split into tiles.
+
+        Layout of input and output tensors depends on the format:
+            - ::SimdTensorFormatNchw - [outer, count, inner];
+            - ::SimdTensorFormatNhwc - [outer, inner, count];
+            - ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c, ::SimdTensorFormatNchw16c - [outer, (count + block - 1) / block, inner, block], 
+                where block is equal to 4, 8 or 16. Padding channels of output tensor are set to zero.
+
+        \param [in] outer - an outer size of input and output tensors (batch size for image tensors).
+        \param [in] count - a size of softmax dimmension (number of channels for image tensors).
+        \param [in] inner - an inner size of input and output tensors (height * width for image tensors).
+        \param [in] format - a format of input and output tensors. It can be ::SimdTensorFormatNchw, ::SimdTensorFormatNhwc, 
+            ::SimdTensorFormatNchw4c, ::SimdTensorFormatNchw8c or ::SimdTensorFormatNchw16c.
+        \return a pointer to softmax context. On error it returns NULL. It must be released with using of function ::SimdRelease.
+            This pointer is used in functions ::SimdSynetSoftmax32fInternalBufferSize, and ::SimdSynetSoftmax32fForward.
+    */
+    SIMD_API void* SimdSynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+
+    /*! @ingroup synet_other
+
+        \fn size_t SimdSynetSoftmax32fInternalBufferSize(const void* context);
+
+        \short Gets size of internal buffer used inside softmax algorithm.
+
+        \param [in] context - a pointer to softmax context. It must be created by function ::SimdSynetSoftmax32fInit and released by function ::SimdRelease.
+        \return size of internal buffer used inside softmax algorithm.
+    */
+    SIMD_API size_t SimdSynetSoftmax32fInternalBufferSize(const void* context);
+
+    /*! @ingroup synet_other
+
+        \fn void SimdSynetSoftmax32fForward(void* context, const float* src, float* dst);
+
+        \short Performs forward propagation of softmax algorithm.
+
+        \param [in] context - a pointer to softmax context. It must be created by function ::SimdSynetSoftmax32fInit and released by function ::SimdRelease.
+        \param [in] src - a pointer to the input 32-bit float tensor. The size of the tensor must be equal to outer*count*inner 
+            (count is aligned up to block size for blocked formats).
+        \param [out] dst - a pointer to the output 32-bit float tensor. Its size is equal to size of the input tensor.
+    */
+    SIMD_API void SimdSynetSoftmax32fForward(void* context, const float* src, float* dst);
+
     /*! @ingroup synet_activation
 
         \fn void SimdSynetSoftplus32f(const float* src, size_t size, const float * beta, const float * threshold, float * dst);
@@ -8068,6 +9168,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::TransformImage(const View<A> & src, ::SimdTransformType transform, View<A> & dst).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] src - a pointer to pixels data of input image.
         \param [in] srcStride - a row size of input image.
         \param [in] width - an input image width. 
@@ -8625,6 +9727,65 @@ extern "C"
     SIMD_API void SimdYuva444pToBgraV2(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
         const uint8_t* a, size_t aStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, SimdYuvType yuvType);
 
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, size_t bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+        \short Converts high bit depth YUV420P image (for example I010) to 24-bit BGR image.
+
+        All input planes contain 16-bit values where bitDepth-bit samples are stored in least significant bits.
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        Samples are reduced to 10 bits and then are scaled to 8-bit output range in the fixed-point conversion itself.
+
+        \note This function has a C++ wrappers: Simd::Yuv420p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, size_t bitDepth = 10, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [10..16].
+        \param [out] bgr - a pointer to pixels data of output 24-bit BGR image.
+        \param [in] bgrStride - a row size of the bgr image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p16ToBgr(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, size_t bitDepth, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+
+    /*! @ingroup yuv_conversion
+
+        \fn void SimdYuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, size_t bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+        \short Converts high bit depth YUV420P image (for example I010) to 32-bit BGRA image.
+
+        All input planes contain 16-bit values where bitDepth-bit samples are stored in least significant bits.
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+        Samples are reduced to 10 bits and then are scaled to 8-bit output range in the fixed-point conversion itself.
+
+        \note This function has a C++ wrappers: Simd::Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, size_t bitDepth = 10, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601).
+
+        \param [in] y - a pointer to pixels data of input 16-bit image with Y color plane.
+        \param [in] yStride - a row size of the y image.
+        \param [in] u - a pointer to pixels data of input 16-bit image with U color plane.
+        \param [in] uStride - a row size of the u image.
+        \param [in] v - a pointer to pixels data of input 16-bit image with V color plane.
+        \param [in] vStride - a row size of the v image.
+        \param [in] width - an image width.
+        \param [in] height - an image height.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [10..16].
+        \param [out] bgra - a pointer to pixels data of output 32-bit BGRA image.
+        \param [in] bgraStride - a row size of the bgra image.
+        \param [in] alpha - a value of alpha channel.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType).
+    */
+    SIMD_API void SimdYuv420p16ToBgra(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+        size_t width, size_t height, size_t bitDepth, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
     /*! @ingroup yuv_conversion
 
         \fn void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride, size_t width, size_t height, uint8_t * bgr, size_t bgrStride);
@@ -8636,6 +9797,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8661,6 +9824,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv422pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8685,6 +9850,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv444pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr);
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8710,6 +9877,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv420pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8734,6 +9903,8 @@ extern "C"
         The input Y and output BGRA images must have the same width and height.
         The input U and V images must have the same width and height (half size relative to Y component).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8761,6 +9932,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv422pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8786,6 +9959,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv444pToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, uint8_t alpha).
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8809,6 +9984,8 @@ extern "C"
 
         The input Y, U, V and output BGRA images must have the same width and height.
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8933,6 +10110,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv420pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb);
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8958,6 +10137,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv422pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb);
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
@@ -8982,6 +10163,8 @@ extern "C"
 
         \note This function has a C++ wrappers: Simd::Yuv444pToRgb(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& rgb);
 
+        \note This function supports multithreading for large images (See functions ::SimdSetThreadNumber and ::SimdSetParallelThreshold).
+
         \param [in] y - a pointer to pixels data of input 8-bit image with Y color plane.
         \param [in] yStride - a row size of the y image.
         \param [in] u - a pointer to pixels data of input 8-bit image with U color plane.
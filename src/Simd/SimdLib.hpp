@@ -28,6 +28,7 @@
 #include "Simd/SimdView.hpp"
 #include "Simd/SimdPixel.hpp"
 #include "Simd/SimdPyramid.hpp"
+#include "Simd/SimdBitMask.hpp"
 
 #ifndef __SimdLib_hpp__
 #define __SimdLib_hpp__
@@ -365,6 +366,27 @@ namespace Simd
         SimdAlphaBlendingUniform(src.data, src.stride, src.width, src.height, src.ChannelCount(), alpha, dst.data, dst.stride);
     }
 
+    /*! @ingroup drawing
+
+        \fn void AlphaComposite(const SimdAlphaLayer* layers, size_t count, View<A>& dst)
+
+        \short Composites several layers onto the image in one pass.
+
+        Layers are blended in the given order and are clipped by the image borders (see ::SimdAlphaLayer).
+
+        \note This function is a C++ wrapper for function ::SimdAlphaComposite.
+
+        \param [in] layers - a pointer to array with descriptions of layers.
+        \param [in] count - a number of layers.
+        \param [in, out] dst - a background image.
+    */
+    template<template<class> class A> SIMD_INLINE void AlphaComposite(const SimdAlphaLayer* layers, size_t count, View<A>& dst)
+    {
+        assert(dst.ChannelSize() == 1 && dst.ChannelCount() <= 4);
+
+        SimdAlphaComposite(layers, count, dst.data, dst.stride, dst.width, dst.height, dst.ChannelCount());
+    }
+
     /*! @ingroup drawing
 
         \fn void AlphaFilling(View<A> & dst, const Pixel & pixel, const View<A> & alpha)
@@ -1142,6 +1164,28 @@ namespace Simd
         SimdBgrToHsv(bgr.data, bgr.width, bgr.height, bgr.stride, hsv.data, hsv.stride);
     }
 
+    /*! @ingroup bgr_conversion
+
+        \fn void BgrToHsvRangeMask(const View<A>& bgr, const uint8_t * lo, const uint8_t * hi, View<A>& mask)
+
+        \short Converts 24-bit BGR image to HSV color space and thresholds it by HSV range in one pass.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBgrToHsvRangeMask.
+
+        \param [in] bgr - an input 24-bit BGR image.
+        \param [in] lo - a pointer to lower bounds of HSV range (3 values: hue, saturation, value).
+        \param [in] hi - a pointer to upper bounds of HSV range (3 values: hue, saturation, value).
+        \param [out] mask - an output 8-bit gray mask.
+    */
+    template<template<class> class A> SIMD_INLINE void BgrToHsvRangeMask(const View<A>& bgr, const uint8_t * lo, const uint8_t * hi, View<A>& mask)
+    {
+        assert(EqualSize(bgr, mask) && bgr.format == View<A>::Bgr24 && mask.format == View<A>::Gray8);
+
+        SimdBgrToHsvRangeMask(bgr.data, bgr.width, bgr.height, bgr.stride, lo, hi, mask.data, mask.stride);
+    }
+
     /*! @ingroup bgr_conversion
 
         \fn void BgrToRgb(const View<A> & bgr, View<A> & rgb)
@@ -2176,6 +2220,46 @@ namespace Simd
         SimdGrayToBgra(gray.data, gray.width, gray.height, gray.stride, rgba.data, rgba.stride, alpha);
     }
 
+    /*! @ingroup other_conversion
+
+        \fn void HslToBgr(const View<A>& hsl, View<A>& bgr)
+
+        \short Converts 24-bit HSL(Hue, Saturation, Lightness) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdHslToBgr.
+
+        \param [in] hsl - an input 24-bit HSL image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void HslToBgr(const View<A>& hsl, View<A>& bgr)
+    {
+        assert(EqualSize(hsl, bgr) && hsl.format == View<A>::Hsl24 && bgr.format == View<A>::Bgr24);
+
+        SimdHslToBgr(hsl.data, hsl.width, hsl.height, hsl.stride, bgr.data, bgr.stride);
+    }
+
+    /*! @ingroup other_conversion
+
+        \fn void HsvToBgr(const View<A>& hsv, View<A>& bgr)
+
+        \short Converts 24-bit HSV(Hue, Saturation, Value) image to 24-bit BGR image.
+
+        All images must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdHsvToBgr.
+
+        \param [in] hsv - an input 24-bit HSV image.
+        \param [out] bgr - an output 24-bit BGR image.
+    */
+    template<template<class> class A> SIMD_INLINE void HsvToBgr(const View<A>& hsv, View<A>& bgr)
+    {
+        assert(EqualSize(hsv, bgr) && hsv.format == View<A>::Hsv24 && bgr.format == View<A>::Bgr24);
+
+        SimdHsvToBgr(hsv.data, hsv.width, hsv.height, hsv.stride, bgr.data, bgr.stride);
+    }
+
     /*! @ingroup histogram
 
         \fn void AbsSecondDerivativeHistogram(const View<A>& src, size_t step, size_t indent, uint32_t * histogram)
@@ -2515,12 +2599,12 @@ namespace Simd
 
         \param [in] src - an input 8-bit gray image.
         \param [out] sum - a 32-bit integer sum image.
-        \param [out] sqsum - a 32-bit integer or 64-bit float point square sum image.
+        \param [out] sqsum - a 32-bit integer, 64-bit integer, 32-bit float or 64-bit float point square sum image.
     */
     template<template<class> class A> SIMD_INLINE void Integral(const View<A>& src, View<A>& sum, View<A>& sqsum)
     {
         assert(src.width + 1 == sum.width && src.height + 1 == sum.height && EqualSize(sum, sqsum));
-        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Double));
+        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Int64 || sqsum.format == View<A>::Float || sqsum.format == View<A>::Double));
 
         SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, NULL, 0,
             (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
@@ -2539,13 +2623,13 @@ namespace Simd
 
         \param [in] src - an input 8-bit gray image.
         \param [out] sum - a 32-bit integer sum image.
-        \param [out] sqsum - a 32-bit integer or 64-bit float point square sum image.
+        \param [out] sqsum - a 32-bit integer, 64-bit integer, 32-bit float or 64-bit float point square sum image.
         \param [out] tilted - a 32-bit integer tilted sum image.
     */
     template<template<class> class A> SIMD_INLINE void Integral(const View<A>& src, View<A>& sum, View<A>& sqsum, View<A>& tilted)
     {
         assert(src.width + 1 == sum.width && src.height + 1 == sum.height && EqualSize(sum, sqsum) && Compatible(sum, tilted));
-        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Double));
+        assert(src.format == View<A>::Gray8 && sum.format == View<A>::Int32 && (sqsum.format == View<A>::Int32 || sqsum.format == View<A>::Int64 || sqsum.format == View<A>::Float || sqsum.format == View<A>::Double));
 
         SimdIntegral(src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, tilted.data, tilted.stride,
             (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
@@ -2986,6 +3070,179 @@ namespace Simd
         SimdNeuralConvert(src.data, src.stride, src.width, src.height, dst, stride, inversion ? 1 : 0);
     }
 
+    /*! @ingroup nv12_conversion
+
+        \fn void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgr.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgr));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgr.format == View<A>::Bgr24);
+
+        SimdNv12ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup nv12_conversion
+
+        \fn void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToBgra.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. By default it is equal to 0xFF.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgra));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && bgra.format == View<A>::Bgra32);
+
+        SimdNv12ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup nv12_conversion
+
+        \fn void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 24-bit RGB image.
+
+        The input Y and output RGB images must have the same width and height.
+        The input UV image must have half width and half height.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgb.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgb - an output 24-bit RGB image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgb(const View<A>& y, const View<A>& uv, View<A>& rgb, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, rgb));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && rgb.format == View<A>::Rgb24);
+
+        SimdNv12ToRgb(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgb.data, rgb.stride, yuvType);
+    }
+
+    /*! @ingroup nv12_conversion
+
+        \fn void Nv12ToRgba(const View<A>& y, const View<A>& uv, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts NV12 image to 32-bit RGBA image.
+
+        The input Y and output RGBA images must have the same width and height.
+        The input UV image must have half width and half height.
+
+        \note This function is a C++ wrapper for function ::SimdNv12ToRgba.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes.
+        \param [out] rgba - an output 32-bit RGBA image.
+        \param [in] alpha - a value of alpha channel. By default it is equal to 0xFF.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Nv12ToRgba(const View<A>& y, const View<A>& uv, View<A>& rgba, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, rgba));
+        assert(y.format == View<A>::Gray8 && uv.format == View<A>::Uv16 && rgba.format == View<A>::Rgba32);
+
+        SimdNv12ToRgba(y.data, y.stride, uv.data, uv.stride, y.width, y.height, rgba.data, rgba.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup nv12_conversion
+
+        \fn void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010 image to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input UV image must have half width and half height. Every its pixel contains interleaved 16-bit U and V values.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgr.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit UV color planes.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgr(const View<A>& y, const View<A>& uv, View<A>& bgr, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgr));
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgr.format == View<A>::Bgr24);
+
+        SimdP010ToBgr(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup nv12_conversion
+
+        \fn void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010 image to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input UV image must have half width and half height. Every its pixel contains interleaved 16-bit U and V values.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit UV color planes.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] alpha - a value of alpha channel. By default it is equal to 0xFF.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToBgra(const View<A>& y, const View<A>& uv, View<A>& bgra, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && EqualSize(y, bgra));
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32 && bgra.format == View<A>::Bgra32);
+
+        SimdP010ToBgra(y.data, y.stride, uv.data, uv.stride, y.width, y.height, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
+    /*! @ingroup nv12_conversion
+
+        \fn void P010ToPlanar32f(const View<A>& y, const View<A>& uv, const float* lower, const float* upper, float* dst, bool rgb = false, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts P010 image to 32-bit float planar (NCHW) BGR or RGB image.
+
+        The input UV image must have half width and half height. Every its pixel contains interleaved 16-bit U and V values.
+
+        \note This function is a C++ wrapper for function ::SimdP010ToPlanar32f.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] uv - an input 32-bit image with interleaved 16-bit UV color planes.
+        \param [in] lower - a pointer to the array with lower bound of output values of every channel. Its size must be 3.
+        \param [in] upper - a pointer to the array with upper bound of output values of every channel. Its size must be 3.
+        \param [out] dst - a pointer to the output 32-bit float planar image. Its size must be 3*y.width*y.height.
+        \param [in] rgb - a flag of RGB channel order of output image. By default it is false (BGR order).
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void P010ToPlanar32f(const View<A>& y, const View<A>& uv, const float* lower, const float* upper, float* dst, bool rgb = false, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height);
+        assert(y.format == View<A>::Int16 && uv.format == View<A>::Int32);
+
+        SimdP010ToPlanar32f(y.data, y.stride, uv.data, uv.stride, y.width, y.height, lower, upper, dst, rgb ? SimdTrue : SimdFalse, yuvType);
+    }
+
     /*! @ingroup operation
 
         \fn void OperationBinary8u(const View<A>& a, const View<A>& b, View<A>& dst, SimdOperationBinary8uType type)
@@ -3164,6 +3421,26 @@ namespace Simd
         SimdReduceGray4x4(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride);
     }
 
+    /*! @ingroup resizing
+
+        \fn void ReduceGray4x4Max(const View<A>& src, View<A>& dst)
+
+        \short Performs reducing (in 2 times) and Gaussian blurring a 8-bit gray image with using window 4x4 and stores maximum of the result and output image.
+
+        For input and output image must be performed: dst.width = (src.width + 1)/2,  dst.height = (src.height + 1)/2.
+
+        \note This function is a C++ wrapper for function ::SimdReduceGray4x4Max.
+
+        \param [in] src - an original input image.
+        \param [in, out] dst - a reduced output image.
+    */
+    template<template<class> class A> SIMD_INLINE void ReduceGray4x4Max(const View<A>& src, View<A>& dst)
+    {
+        assert(src.format == View<A>::Gray8 && dst.format == View<A>::Gray8 && Scale(src.Size()) == dst.Size());
+
+        SimdReduceGray4x4Max(src.data, src.width, src.height, src.stride, dst.data, dst.width, dst.height, dst.stride);
+    }
+
     /*! @ingroup resizing
 
         \fn void ReduceGray5x5(const View<A>& src, View<A>& dst, bool compensation = true)
@@ -3423,6 +3700,65 @@ namespace Simd
         }
     }
 
+    /*! @ingroup resizing
+
+        \fn void ResizeNv12(const View<A>& y, const View<A>& uv, View<A>& dst, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Performs combined NV12 to BGR (BGRA, RGB, RGBA or Gray) conversion and resizing.
+
+        \note This function is a C++ wrapper for functions ::SimdYuv420pResizerInit and ::SimdYuv420pResizerRun.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] uv - an input 16-bit image with interleaved UV color planes. It must have half width and half height relative to Y plane.
+        \param [out] dst - a resized output image. Its format can be Gray8, Bgr24, Bgra32, Rgb24 or Rgba32. Its width and height must be even.
+        \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void ResizeNv12(const View<A>& y, const View<A>& uv, View<A>& dst, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * uv.width && y.height == 2 * uv.height && y.format == View<A>::Gray8 && uv.format == View<A>::Uv16);
+
+        void* resizer = SimdYuv420pResizerInit(y.width, y.height, dst.width, dst.height, (SimdPixelFormatType)dst.format, yuvType, method);
+        if (resizer)
+        {
+            SimdYuv420pResizerRun(resizer, y.data, y.stride, uv.data, uv.stride, NULL, 0, dst.data, dst.stride);
+            SimdRelease(resizer);
+        }
+        else
+            assert(0);
+    }
+
+    /*! @ingroup resizing
+
+        \fn void ResizeYuv420p(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& dst, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Performs combined YUV420P to BGR (BGRA, RGB, RGBA or Gray) conversion and resizing.
+
+        \note This function is a C++ wrapper for functions ::SimdYuv420pResizerInit and ::SimdYuv420pResizerRun.
+
+        \param [in] y - an input 8-bit image with Y color plane.
+        \param [in] u - an input 8-bit image with U color plane. It must have half width and half height relative to Y plane.
+        \param [in] v - an input 8-bit image with V color plane. It must have half width and half height relative to Y plane.
+        \param [out] dst - a resized output image. Its format can be Gray8, Bgr24, Bgra32, Rgb24 or Rgba32. Its width and height must be even.
+        \param [in] method - a resizing method. By default it is equal to ::SimdResizeMethodBilinear.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void ResizeYuv420p(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& dst, ::SimdResizeMethodType method = ::SimdResizeMethodBilinear, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(y.format == View<A>::Gray8);
+
+        void* resizer = SimdYuv420pResizerInit(y.width, y.height, dst.width, dst.height, (SimdPixelFormatType)dst.format, yuvType, method);
+        if (resizer)
+        {
+            SimdYuv420pResizerRun(resizer, y.data, y.stride, u.data, u.stride, v.data, v.stride, dst.data, dst.stride);
+            SimdRelease(resizer);
+        }
+        else
+            assert(0);
+    }
+
     /*! @ingroup rgb_conversion
 
         \fn void RgbToBgr(const View<A> & rgb, View<A> & bgr)
@@ -4641,6 +4977,61 @@ namespace Simd
         SimdYuva420pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, a.data, a.stride, y.width, y.height, bgra.data, bgra.stride);
     }
 
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, size_t bitDepth = 10, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts high bit depth YUV420P image (for example I010) to 24-bit BGR image.
+
+        The input Y and output BGR images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToBgr.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] bgr - an output 24-bit BGR image.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [10..16]. By default it is equal to 10.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr, size_t bitDepth = 10, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(EqualSize(y, bgr) && y.format == View<A>::Int16 && bgr.format == View<A>::Bgr24);
+
+        SimdYuv420p16ToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, bgr.data, bgr.stride, yuvType);
+    }
+
+    /*! @ingroup yuv_conversion
+
+        \fn void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, size_t bitDepth = 10, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+
+        \short Converts high bit depth YUV420P image (for example I010) to 32-bit BGRA image.
+
+        The input Y and output BGRA images must have the same width and height.
+        The input U and V images must have the same width and height (half size relative to Y component).
+
+        \note This function is a C++ wrapper for function ::SimdYuv420p16ToBgra.
+
+        \param [in] y - an input 16-bit image with Y color plane.
+        \param [in] u - an input 16-bit image with U color plane.
+        \param [in] v - an input 16-bit image with V color plane.
+        \param [out] bgra - an output 32-bit BGRA image.
+        \param [in] bitDepth - a bit depth of input samples. It must be in range [10..16]. By default it is equal to 10.
+        \param [in] alpha - a value of alpha channel. By default it is equal to 0xFF.
+        \param [in] yuvType - a type of input YUV image (see descriprion of ::SimdYuvType). By default is equal to ::SimdYuvBt601.
+    */
+    template<template<class> class A> SIMD_INLINE void Yuv420p16ToBgra(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgra, size_t bitDepth = 10, uint8_t alpha = 0xFF, SimdYuvType yuvType = SimdYuvBt601)
+    {
+        assert(y.width == 2 * u.width && y.height == 2 * u.height && y.format == u.format);
+        assert(y.width == 2 * v.width && y.height == 2 * v.height && y.format == v.format);
+        assert(EqualSize(y, bgra) && y.format == View<A>::Int16 && bgra.format == View<A>::Bgra32);
+
+        SimdYuv420p16ToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, bgra.data, bgra.stride, alpha, yuvType);
+    }
+
     /*! @ingroup yuv_conversion
 
         \fn void Yuv420pToBgr(const View<A>& y, const View<A>& u, const View<A>& v, View<A>& bgr)
@@ -5161,6 +5552,166 @@ namespace Simd
         for (size_t level = 1; level < pyramid.Size(); ++level)
             Simd::ReduceGray(pyramid.At(level - 1), pyramid.At(level), reduceType, compensation);
     }
+
+    /*! @ingroup cpp_bit_mask_functions
+
+        \fn void BitMaskPack(const View<A>& src, BitMask<A>& dst)
+
+        \short Packs 8-bit gray mask into bit-packed 1-bit mask.
+
+        All images must have the same width and height. Input image must has 8-bit gray format.
+
+        \note This function is a C++ wrapper for function ::SimdBitMaskPack.
+
+        \param [in] src - an input 8-bit gray mask. Every nonzero point is treated as set.
+        \param [out] dst - an output bit-packed mask.
+    */
+    template<template<class> class A> SIMD_INLINE void BitMaskPack(const View<A>& src, BitMask<A>& dst)
+    {
+        assert(src.format == View<A>::Gray8 && src.Size() == dst.Size());
+
+        SimdBitMaskPack(src.data, src.stride, src.width, src.height, dst.bits.data, dst.bits.stride);
+    }
+
+    /*! @ingroup cpp_bit_mask_functions
+
+        \fn void BitMaskUnpack(const BitMask<A>& src, View<A>& dst)
+
+        \short Unpacks bit-packed 1-bit mask into 8-bit gray mask (0 or 255).
+
+        All images must have the same width and height. Output image must has 8-bit gray format.
+
+        \note This function is a C++ wrapper for function ::SimdBitMaskUnpack.
+
+        \param [in] src - an input bit-packed mask.
+        \param [out] dst - an output 8-bit gray mask.
+    */
+    template<template<class> class A> SIMD_INLINE void BitMaskUnpack(const BitMask<A>& src, View<A>& dst)
+    {
+        assert(dst.format == View<A>::Gray8 && src.Size() == dst.Size());
+
+        SimdBitMaskUnpack(src.bits.data, src.bits.stride, src.width, src.height, dst.data, dst.stride);
+    }
+
+    /*! @ingroup cpp_bit_mask_functions
+
+        \fn void BitMaskOperation(const BitMask<A>& a, const BitMask<A>& b, SimdBitMaskOperationType type, BitMask<A>& dst)
+
+        \short Performs given logical operation for two bit-packed masks.
+
+        All masks must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBitMaskOperation.
+
+        \param [in] a - a first input mask.
+        \param [in] b - a second input mask.
+        \param [in] type - a type of logical operation (see ::SimdBitMaskOperationType).
+        \param [out] dst - an output mask.
+    */
+    template<template<class> class A> SIMD_INLINE void BitMaskOperation(const BitMask<A>& a, const BitMask<A>& b, SimdBitMaskOperationType type, BitMask<A>& dst)
+    {
+        assert(a.Size() == b.Size() && a.Size() == dst.Size());
+
+        SimdBitMaskOperation(a.bits.data, a.bits.stride, b.bits.data, b.bits.stride, a.width, a.height, type, dst.bits.data, dst.bits.stride);
+    }
+
+    /*! @ingroup cpp_bit_mask_functions
+
+        \fn void BitMaskNot(const BitMask<A>& src, BitMask<A>& dst)
+
+        \short Inverts bit-packed mask.
+
+        All masks must have the same width and height.
+
+        \note This function is a C++ wrapper for function ::SimdBitMaskNot.
+
+        \param [in] src - an input mask.
+        \param [out] dst - an output inverted mask.
+    */
+    template<template<class> class A> SIMD_INLINE void BitMaskNot(const BitMask<A>& src, BitMask<A>& dst)
+    {
+        assert(src.Size() == dst.Size());
+
+        SimdBitMaskNot(src.bits.data, src.bits.stride, src.width, src.height, dst.bits.data, dst.bits.stride);
+    }
+
+    /*! @ingroup cpp_bit_mask_functions
+
+        \fn uint64_t BitMaskCount(const BitMask<A>& mask)
+
+        \short Gets number of set points (area) of bit-packed mask.
+
+        \note This function is a C++ wrapper for function ::SimdBitMaskCount.
+
+        \param [in] mask - an input mask.
+        \return - number of set points.
+    */
+    template<template<class> class A> SIMD_INLINE uint64_t BitMaskCount(const BitMask<A>& mask)
+    {
+        uint64_t count = 0;
+        SimdBitMaskCount(mask.bits.data, mask.bits.stride, mask.width, mask.height, &count);
+        return count;
+    }
+
+    /*! @ingroup cpp_bit_mask_functions
+
+        \fn Rectangle<ptrdiff_t> BitMaskBoundingBox(const BitMask<A>& mask)
+
+        \short Gets bounding box of set points of bit-packed mask.
+
+        \note This function is a C++ wrapper for function ::SimdBitMaskBoundingBox.
+
+        \param [in] mask - an input mask.
+        \return - a bounding box. It is empty if there are no set points.
+    */
+    template<template<class> class A> SIMD_INLINE Rectangle<ptrdiff_t> BitMaskBoundingBox(const BitMask<A>& mask)
+    {
+        Rectangle<ptrdiff_t> box;
+        SimdBitMaskBoundingBox(mask.bits.data, mask.bits.stride, mask.width, mask.height, &box.left, &box.top, &box.right, &box.bottom);
+        return box;
+    }
+
+    /*! @ingroup cpp_bit_mask_functions
+
+        \fn void BitMaskCopy(const View<A>& src, const BitMask<A>& mask, View<A>& dst)
+
+        \short Copies pixels of image which are set in bit-packed mask.
+
+        All images and mask must have the same width and height. Input and output images must have the same format.
+
+        \note This function is a C++ wrapper for function ::SimdBitMaskCopy.
+
+        \param [in] src - an input image.
+        \param [in] mask - a bit-packed mask.
+        \param [in, out] dst - an output image.
+    */
+    template<template<class> class A> SIMD_INLINE void BitMaskCopy(const View<A>& src, const BitMask<A>& mask, View<A>& dst)
+    {
+        assert(Compatible(src, dst) && src.Size() == mask.Size());
+
+        SimdBitMaskCopy(src.data, src.stride, src.width, src.height, src.PixelSize(), mask.bits.data, mask.bits.stride, dst.data, dst.stride);
+    }
+
+    /*! @ingroup cpp_bit_mask_functions
+
+        \fn void BitMaskFill(View<A>& dst, const BitMask<A>& mask, const Pixel& pixel)
+
+        \short Fills pixels of image which are set in bit-packed mask by given value.
+
+        Image and mask must have the same width and height. Size of pixel type must be equal to pixel size of the image.
+
+        \note This function is a C++ wrapper for function ::SimdBitMaskFill.
+
+        \param [in, out] dst - an image to fill.
+        \param [in] mask - a bit-packed mask.
+        \param [in] pixel - a pixel value.
+    */
+    template<template<class> class A, class Pixel> SIMD_INLINE void BitMaskFill(View<A>& dst, const BitMask<A>& mask, const Pixel& pixel)
+    {
+        assert(dst.PixelSize() == sizeof(Pixel) && dst.Size() == mask.Size());
+
+        SimdBitMaskFill(dst.data, dst.stride, dst.width, dst.height, (uint8_t*)&pixel, sizeof(Pixel), mask.bits.data, mask.bits.stride);
+    }
 }
 
 #endif
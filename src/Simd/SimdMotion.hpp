@@ -27,12 +27,16 @@
 #include "Simd/SimdPoint.hpp"
 #include "Simd/SimdRectangle.hpp"
 #include "Simd/SimdFrame.hpp"
+#include "Simd/SimdFrameContext.hpp"
 #include "Simd/SimdDrawing.hpp"
 #include "Simd/SimdFont.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
 #include <stack>
 #include <sstream>
+#include <memory>
+#include <thread>
 
 #ifndef SIMD_CHECK_PERFORMANCE
 #define SIMD_CHECK_PERFORMANCE()
@@ -211,6 +215,7 @@ namespace Simd
         typedef std::vector<FPoint> FPoints; /*!< \brief Vector of ONVIF 2D-points. */
         typedef Simd::View<Simd::Allocator> View; /*!< \brief Image type. */
         typedef Simd::Frame<Simd::Allocator> Frame; /*!< \brief Frame type. */
+        typedef Simd::FrameContext<Simd::Allocator> FrameContext; /*!< \brief Frame context type (shared derived images of input frame). */
 
         /*! @ingroup cpp_motion
 
@@ -640,16 +645,46 @@ namespace Simd
             {
                 SIMD_CHECK_PERFORMANCE();
 
-                if (output && output->Size() != input.Size())
+                if (!StartFrame(input, metadata, output))
                     return false;
 
-                if (!Calibrate(input.Size()))
-                    return false;
+                EstimateTextures();
 
-                _scene.metadata = &metadata;
-                _scene.metadata->events.clear();
+                EstimateDifference();
+
+                PerformSegmentation();
+
+                VerifyStability();
+
+                TrackObjects();
+
+                ClassifyObjects();
+
+                UpdateBackground();
 
-                SetFrame(input, output);
+                SetMetadata();
+
+                DebugAnnotation();
+
+                return true;
+            }
+
+            /*!
+                Processes next frame with using of frame context which can be shared with other detectors (see Simd::FrameContext).
+                The detector takes reduced gray image of the frame from the context, so it is not computed twice.
+                The result is the same as the result of Detector::NextFrame(const Frame &, Metadata &, Frame *).
+
+                \param [in, out] context - a context of current input frame (see Simd::FrameContext::Reset).
+                \param [out] metadata - a metadata (sets of detected objects and generated events). It is a result of processing of current frame.
+                \param [out] output - a pointer to output frame with debug annotation. Can be NULL.
+                \return a result of the operation.
+            */
+            bool NextFrame(FrameContext & context, Metadata & metadata, Frame * output = NULL)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                if (!StartFrame(context.Input(), metadata, output, &context))
+                    return false;
 
                 EstimateTextures();
 
@@ -673,6 +708,8 @@ namespace Simd
             }
 
         private:
+            friend class MultiDetector;
+
             Simd::Motion::Model _model;
 
             struct Options : public Simd::Motion::Options
@@ -800,6 +837,7 @@ namespace Simd
                     FeatureGray,
                     FeatureDx,
                     FeatureDy,
+                    FeatureSize
                 };
 
                 Feature gray;
@@ -944,7 +982,6 @@ namespace Simd
                 Metadata * metadata;
 
                 Font font;
-                Pyramid buffer;
                 Detector::Model model;
 
                 Texture texture;
@@ -965,7 +1002,6 @@ namespace Simd
                 {
                     scaled.Recreate(model.originalFrameSize, model.scaleLevel + 1);
                     font.Resize(model.originalFrameSize.y / 32);
-                    buffer.Recreate(model.frameSize, model.levelCount);
 
                     texture.Create(model.frameSize, model.levelCount, options);
                     difference.Recreate(model.frameSize, model.levelCount);
@@ -980,14 +1016,66 @@ namespace Simd
             };
             Scene _scene;
 
-            void SetFrame(const Frame & input, Frame * output)
+            bool StartFrame(const Frame & input, Metadata & metadata, Frame * output, FrameContext * context = NULL)
+            {
+                if (output && output->Size() != input.Size())
+                    return false;
+
+                if (!Calibrate(input.Size()))
+                    return false;
+
+                _scene.metadata = &metadata;
+                _scene.metadata->events.clear();
+
+                SetFrame(input, output, context);
+
+                return true;
+            }
+
+            enum Stage
+            {
+                StageEstimateTextures,
+                StageEstimateDifference,
+                StagePerformSegmentation,
+                StageVerifyStability,
+                StageTrackObjects,
+                StageClassifyObjects,
+                StageUpdateBackground,
+                StageSetMetadata,
+                StageDebugAnnotation,
+                StageSize
+            };
+
+            void RunStage(Stage stage)
+            {
+                switch (stage)
+                {
+                case StageEstimateTextures: EstimateTextures(); break;
+                case StageEstimateDifference: EstimateDifference(); break;
+                case StagePerformSegmentation: PerformSegmentation(); break;
+                case StageVerifyStability: VerifyStability(); break;
+                case StageTrackObjects: TrackObjects(); break;
+                case StageClassifyObjects: ClassifyObjects(); break;
+                case StageUpdateBackground: UpdateBackground(); break;
+                case StageSetMetadata: SetMetadata(); break;
+                case StageDebugAnnotation: DebugAnnotation(); break;
+                default: break;
+                }
+            }
+
+            void SetFrame(const Frame & input, Frame * output, FrameContext * context)
             {
                 SIMD_CHECK_PERFORMANCE();
 
                 _scene.input = input;
                 _scene.output = output;
-                Simd::Convert(input, Frame(_scene.scaled[0]).Ref());
-                Simd::Build(_scene.scaled, SimdReduce2x2);
+                if (context)
+                    Simd::Copy(context->Level(_scene.scaled.Size() - 1, SimdReduce2x2), _scene.scaled.Top());
+                else
+                {
+                    Simd::Convert(input, Frame(_scene.scaled[0]).Ref());
+                    Simd::Build(_scene.scaled, SimdReduce2x2);
+                }
             }
 
             bool Calibrate(const Size & frameSize)
@@ -1127,25 +1215,32 @@ namespace Simd
 
                 const Texture & texture = _scene.texture;
                 Pyramid & difference = _scene.difference;
-                Pyramid & buffer = _scene.buffer;
+                bool propagate = _options.DifferencePropagateForward;
+                bool roi = _options.DifferenceRoiMaskEnable;
+                const size_t count = texture.features.size();
+                const uint8_t * value[Texture::FeatureSize], * lo[Texture::FeatureSize], * hi[Texture::FeatureSize];
+                uint16_t weight[Texture::FeatureSize];
                 for (size_t i = 0; i < difference.Size(); ++i)
                 {
-                    Simd::Fill(difference[i], 0);
-                    for (size_t j = 0; j < texture.features.size(); ++j)
+                    size_t stride = difference[i].stride;
+                    for (size_t j = 0; j < count; ++j)
                     {
                         const Texture::Feature & feature = *texture.features[j];
-                        Simd::AddFeatureDifference(feature.value[i], feature.lo.value[i], feature.hi.value[i], feature.weight, difference[i]);
+                        value[j] = feature.value[i].data;
+                        lo[j] = feature.lo.value[i].data;
+                        hi[j] = feature.hi.value[i].data;
+                        weight[j] = feature.weight;
+                        stride = feature.value[i].stride;
+                        assert(feature.lo.value[i].stride == stride && feature.hi.value[i].stride == stride);
                     }
+                    // The ROI mask is applied to every level in the same pass unless forward propagation needs unmasked lower levels.
+                    const View * mask = roi && !propagate ? &_scene.model.roiMask[i] : NULL;
+                    ::SimdFeatureDifferenceSum(value, lo, hi, stride, weight, count, difference[i].width, difference[i].height,
+                        mask ? mask->data : NULL, mask ? mask->stride : 0, difference[i].data, difference[i].stride);
+                    if (propagate && i)
+                        Simd::ReduceGray4x4Max(difference[i - 1], difference[i]);
                 }
-                if (_options.DifferencePropagateForward)
-                {
-                    for (size_t i = 1; i < difference.Size(); ++i)
-                    {
-                        Simd::ReduceGray4x4(difference[i - 1], buffer[i]);
-                        Simd::OperationBinary8u(difference[i], buffer[i], difference[i], SimdOperationBinary8uMaximum);
-                    }
-                }
-                if (_options.DifferenceRoiMaskEnable)
+                if (roi && propagate)
                 {
                     for (size_t i = 0; i < difference.Size(); ++i)
                         Simd::OperationBinary8u(difference[i], _scene.model.roiMask[i], difference[i], SimdOperationBinary8uAnd);
@@ -1729,6 +1824,145 @@ namespace Simd
                 }
             }
         };
+
+        /*! @ingroup cpp_motion
+
+            \short Class MultiDetector.
+
+            Performs motion detection for several independent video streams.
+            Every stage of the algorithm is executed for all streams in parallel, while state of every stream is kept separately.
+            It is useful for processing of many low-resolution streams, where single stream can't load all CPU cores.
+        */
+        class MultiDetector
+        {
+        public:
+
+            /*!
+                Creates a new MultiDetector.
+
+                \param [in] streamNumber - a number of processed video streams.
+                \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+            */
+            MultiDetector(size_t streamNumber = 0, ptrdiff_t threadNumber = -1)
+            {
+                SetStreamNumber(streamNumber);
+                SetThreadNumber(threadNumber);
+            }
+
+            /*!
+                Sets number of processed video streams. Detectors of existing streams keep their state.
+
+                \param [in] streamNumber - a number of processed video streams.
+            */
+            void SetStreamNumber(size_t streamNumber)
+            {
+                size_t old = _detectors.size();
+                _detectors.resize(streamNumber);
+                for (size_t i = old; i < streamNumber; ++i)
+                    _detectors[i].reset(new Detector());
+                _started.resize(streamNumber);
+            }
+
+            /*!
+                Gets number of processed video streams.
+
+                \return a number of processed video streams.
+            */
+            size_t StreamNumber() const
+            {
+                return _detectors.size();
+            }
+
+            /*!
+                Sets number of work threads.
+
+                \param [in] threadNumber - a number of work threads. Use value -1 to auto choose of thread number.
+            */
+            void SetThreadNumber(ptrdiff_t threadNumber)
+            {
+                ptrdiff_t threadNumberMax = std::max<ptrdiff_t>(std::thread::hardware_concurrency(), 1);
+                _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
+            }
+
+            /*!
+                Gets motion detector of given stream.
+
+                \param [in] stream - an index of the stream.
+                \return a reference to motion detector of the stream.
+            */
+            Detector & operator[](size_t stream)
+            {
+                return *_detectors[stream];
+            }
+
+            /*!
+                Sets options of motion detector for all streams.
+
+                \param [in] options - options of motion detector.
+                \return a result of the operation.
+            */
+            bool SetOptions(const Simd::Motion::Options & options)
+            {
+                for (size_t i = 0; i < _detectors.size(); ++i)
+                    if (!_detectors[i]->SetOptions(options))
+                        return false;
+                return true;
+            }
+
+            /*!
+                Processes next frames of all streams. You have to successively process all frames of the streams with using of this function.
+
+                \param [in] inputs - an array with current input frames. Its size must be equal to number of streams.
+                \param [out] metadatas - an array with metadata of every stream. Its size must be equal to number of streams.
+                \param [out] outputs - an array with pointers to output frames with debug annotation. Can be NULL. Its items also can be NULL.
+                \return a result of the operation. It is false if at least one of frames was not processed.
+            */
+            bool NextFrames(const Frame * inputs, Metadata * metadatas, Frame * const * outputs = NULL)
+            {
+                SIMD_CHECK_PERFORMANCE();
+
+                size_t count = _detectors.size();
+                ParallelQueue(count, _threadNumber, [&](size_t thread, size_t i)
+                {
+                    _started[i] = _detectors[i]->StartFrame(inputs[i], metadatas[i], outputs ? outputs[i] : NULL);
+                });
+
+                for (int stage = 0; stage < Detector::StageSize; ++stage)
+                {
+                    ParallelQueue(count, _threadNumber, [&](size_t thread, size_t i)
+                    {
+                        if (_started[i])
+                            _detectors[i]->RunStage((Detector::Stage)stage);
+                    });
+                }
+
+                for (size_t i = 0; i < count; ++i)
+                    if (!_started[i])
+                        return false;
+                return true;
+            }
+
+            /*!
+                Processes next frames of all streams. You have to successively process all frames of the streams with using of this function.
+
+                \param [in] inputs - a vector with current input frames. Its size must be equal to number of streams.
+                \param [out] metadatas - a vector with metadata of every stream. It is resized to number of streams.
+                \return a result of the operation. It is false if at least one of frames was not processed.
+            */
+            bool NextFrames(const std::vector<Frame> & inputs, std::vector<Metadata> & metadatas)
+            {
+                if (inputs.size() != _detectors.size())
+                    return false;
+                metadatas.resize(inputs.size());
+                return NextFrames(inputs.data(), metadatas.data());
+            }
+
+        private:
+            typedef std::shared_ptr<Detector> DetectorPtr;
+            std::vector<DetectorPtr> _detectors;
+            std::vector<char> _started;
+            size_t _threadNumber;
+        };
     }
 }
 
@@ -104,6 +104,61 @@ namespace Simd
             else
                 AddFeatureDifference<false>(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
         }
+
+        template <bool align> SIMD_INLINE void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi,
+            size_t offset, const uint16_t * weight, size_t count, const uint8_t * mask, uint8_t * difference)
+        {
+            uint8x16_t sum = K8_00;
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint8x16_t _value = Load<align>(value[i] + offset);
+                const uint8x16_t _lo = Load<align>(lo[i] + offset);
+                const uint8x16_t _hi = Load<align>(hi[i] + offset);
+                const uint8x16_t featureDifference = FeatureDifference(_value, _lo, _hi);
+                sum = vqaddq_u8(sum, ShiftedWeightedSquare(featureDifference, vdup_n_u16(weight[i])));
+            }
+            if (mask)
+                sum = vandq_u8(sum, Load<align>(mask));
+            Store<align>(difference, sum);
+        }
+
+        template <bool align> void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+            uint8_t * difference, size_t differenceStride)
+        {
+            assert(width >= A);
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0, offset = 0; row < height; ++row, offset += stride)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    FeatureDifferenceSum<align>(value, lo, hi, offset + col, weight, count, mask ? mask + col : NULL, difference + col);
+                if (alignedWidth != width)
+                    FeatureDifferenceSum<false>(value, lo, hi, offset + width - A, weight, count, mask ? mask + width - A : NULL, difference + width - A);
+                if (mask)
+                    mask += maskStride;
+                difference += differenceStride;
+            }
+        }
+
+        bool FeatureDifferenceSumAligned(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            size_t count, const uint8_t * mask, size_t maskStride, uint8_t * difference, size_t differenceStride)
+        {
+            bool aligned = Aligned(stride) && Aligned(difference) && Aligned(differenceStride) && (mask == NULL || (Aligned(mask) && Aligned(maskStride)));
+            for (size_t i = 0; i < count && aligned; ++i)
+                aligned = Aligned(value[i]) && Aligned(lo[i]) && Aligned(hi[i]);
+            return aligned;
+        }
+
+        void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+            uint8_t * difference, size_t differenceStride)
+        {
+            if (FeatureDifferenceSumAligned(value, lo, hi, stride, count, mask, maskStride, difference, differenceStride))
+                FeatureDifferenceSum<true>(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+            else
+                FeatureDifferenceSum<false>(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
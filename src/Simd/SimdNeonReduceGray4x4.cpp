@@ -98,7 +98,21 @@ namespace Simd
                 Load<align>(buffer.src2 + offset), Load<align>(buffer.src3 + offset))));
         }
 
-        template <bool even> void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        template <bool max> SIMD_INLINE void StoreReduced(uint8_t * dst, uint8x8_t value)
+        {
+            if (max)
+                value = vmax_u8(value, vld1_u8(dst));
+            vst1_u8(dst, value);
+        }
+
+        template <bool max> SIMD_INLINE void StoreReduced(uint8_t * dst, uint8x8_t value, uint8x8_t previous)
+        {
+            if (max)
+                value = vmax_u8(value, previous);
+            vst1_u8(dst, value);
+        }
+
+        template <bool even, bool max> void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
         {
             assert((srcWidth + 1) / 2 == dstWidth && (srcHeight + 1) / 2 == dstHeight && srcWidth > A);
@@ -143,11 +157,13 @@ namespace Simd
                 Store<false>(buffer.src2 + dstWidth - HA, ReduceColTail<even>(src2 + srcTail));
                 Store<false>(buffer.src3 + dstWidth - HA, ReduceColTail<even>(src3 + srcTail));
 
+                // The tail overlaps the body: it is merged with the values of dst saved before the body was stored.
+                uint8x8_t tail = vld1_u8(dst + dstWidth - HA);
                 for (size_t col = 0; col < alignedDstWidth; col += HA)
-                    vst1_u8(dst + col, ReduceRow<true>(buffer, col));
+                    StoreReduced<max>(dst + col, ReduceRow<true>(buffer, col));
 
                 if (alignedDstWidth != dstWidth)
-                    vst1_u8(dst + dstWidth - HA, ReduceRow<false>(buffer, dstWidth - HA));
+                    StoreReduced<max>(dst + dstWidth - HA, ReduceRow<false>(buffer, dstWidth - HA), tail);
 
                 Swap(buffer.src0, buffer.src2);
                 Swap(buffer.src1, buffer.src3);
@@ -158,9 +174,18 @@ namespace Simd
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
         {
             if (Aligned(srcWidth, 2))
-                ReduceGray4x4<true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ReduceGray4x4<true, false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+            else
+                ReduceGray4x4<false, false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        }
+
+        void ReduceGray4x4Max(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            if (Aligned(srcWidth, 2))
+                ReduceGray4x4<true, true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
             else
-                ReduceGray4x4<false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ReduceGray4x4<false, true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
         }
     }
 #endif// SIMD_NEON_ENABLE
@@ -144,6 +144,51 @@ namespace Simd
                 SquaredDifferenceSumMasked<false>(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
         }
 
+        //-----------------------------------------------------------------------------------------
+
+        void SquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums)
+        {
+            assert(size >= A && size <= 0x10000);
+
+            size_t sizeA = AlignLo(size, A), count4 = AlignLo(count, 4), i = 0;
+            uint8x16_t tailMask = ShiftLeft(K8_FF, A - size + sizeA);
+            for (; i < count4; i += 4, b += 4 * size)
+            {
+                const uint8_t * b0 = b, * b1 = b0 + size, * b2 = b1 + size, * b3 = b2 + size;
+                uint32x4_t s0 = K32_00000000, s1 = K32_00000000, s2 = K32_00000000, s3 = K32_00000000;
+                for (size_t j = 0; j < sizeA; j += A)
+                {
+                    uint8x16_t _a = Load<false>(a + j);
+                    s0 = vaddq_u32(s0, SquaredDifferenceSum(_a, Load<false>(b0 + j)));
+                    s1 = vaddq_u32(s1, SquaredDifferenceSum(_a, Load<false>(b1 + j)));
+                    s2 = vaddq_u32(s2, SquaredDifferenceSum(_a, Load<false>(b2 + j)));
+                    s3 = vaddq_u32(s3, SquaredDifferenceSum(_a, Load<false>(b3 + j)));
+                }
+                if (sizeA < size)
+                {
+                    size_t j = size - A;
+                    uint8x16_t _a = Load<false>(a + j);
+                    s0 = vaddq_u32(s0, SquaredDifferenceSumMasked(_a, Load<false>(b0 + j), tailMask));
+                    s1 = vaddq_u32(s1, SquaredDifferenceSumMasked(_a, Load<false>(b1 + j), tailMask));
+                    s2 = vaddq_u32(s2, SquaredDifferenceSumMasked(_a, Load<false>(b2 + j), tailMask));
+                    s3 = vaddq_u32(s3, SquaredDifferenceSumMasked(_a, Load<false>(b3 + j), tailMask));
+                }
+                sums[i + 0] = ExtractSum32u(s0);
+                sums[i + 1] = ExtractSum32u(s1);
+                sums[i + 2] = ExtractSum32u(s2);
+                sums[i + 3] = ExtractSum32u(s3);
+            }
+            for (; i < count; i += 1, b += size)
+            {
+                uint32x4_t s0 = K32_00000000;
+                for (size_t j = 0; j < sizeA; j += A)
+                    s0 = vaddq_u32(s0, SquaredDifferenceSum(Load<false>(a + j), Load<false>(b + j)));
+                if (sizeA < size)
+                    s0 = vaddq_u32(s0, SquaredDifferenceSumMasked(Load<false>(a + size - A), Load<false>(b + size - A), tailMask));
+                sums[i] = ExtractSum32u(s0);
+            }
+        }
+
         template <bool align> SIMD_INLINE void SquaredDifferenceSum32f(const float * a, const float * b, size_t offset, float32x4_t & sum)
         {
             float32x4_t _a = Load<align>(a + offset);
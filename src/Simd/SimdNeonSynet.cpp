@@ -29,6 +29,7 @@
 #include "Simd/SimdExtract.h"
 #include "Simd/SimdPow.h"
 #include "Simd/SimdExp.h"
+#include "Simd/SimdSynetSoftmax32f.h"
 
 namespace Simd
 {
@@ -1124,6 +1125,21 @@ namespace Simd
             else
                 SynetUnaryOperation32fLayerForward<false>(src, size, type, dst);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetSoftmax32f::SynetSoftmax32f(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+            : Base::SynetSoftmax32f(outer, count, inner, format)
+        {
+            _softmax = Neon::SynetSoftmaxLayerForward;
+        }
+
+        void* SynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+        {
+            if (outer == 0 || count == 0 || inner == 0 || Base::SynetSoftmax32fBlock(count, format) == 0)
+                return NULL;
+            return new SynetSoftmax32f(outer, count, inner, format);
+        }
     }
 #endif// SIMD_NEON_ENABLE
 }
@@ -69,6 +69,39 @@ namespace Simd
 
         //-------------------------------------------------------------------------
 
+        template<bool align> SIMD_INLINE void SynetGelu32f(const float* src, float* dst, size_t offset)
+        {
+            Store<align>(dst + offset, Gelu<1>(Load<align>(src + offset)));
+        }
+
+        template<bool align> void SynetGelu32f(const float* src, size_t size, float* dst)
+        {
+            size_t sizeF = AlignLo(size, F);
+            size_t sizeQF = AlignLo(size, QF);
+            size_t i = 0;
+            for (; i < sizeQF; i += QF)
+            {
+                SynetGelu32f<align>(src, dst, i + 0 * F);
+                SynetGelu32f<align>(src, dst, i + 1 * F);
+                SynetGelu32f<align>(src, dst, i + 2 * F);
+                SynetGelu32f<align>(src, dst, i + 3 * F);
+            }
+            for (; i < sizeF; i += F)
+                SynetGelu32f<align>(src, dst, i);
+            for (; i < size; ++i)
+                dst[i] = Base::SynetGelu32f(src[i]);
+        }
+
+        void SynetGelu32f(const float* src, size_t size, float* dst)
+        {
+            if (Aligned(src) && Aligned(dst))
+                SynetGelu32f<true>(src, size, dst);
+            else
+                SynetGelu32f<false>(src, size, dst);
+        }
+
+        //-------------------------------------------------------------------------
+
         template<bool align> SIMD_INLINE void SynetHardSigmoid32f(const float* src, float32x4_t scale, float32x4_t shift, float* dst, size_t offset)
         {
             float32x4_t _src = Load<align>(src + offset);
@@ -720,6 +720,7 @@ namespace Simd
             case SimdConvolutionActivationMish: Set<SimdConvolutionActivationMish>(p, convolution); break;
             case SimdConvolutionActivationHardSigmoid: Set<SimdConvolutionActivationHardSigmoid>(p, convolution); break;
             case SimdConvolutionActivationSwish: Set<SimdConvolutionActivationSwish>(p, convolution); break;
+            case SimdConvolutionActivationGelu: Set<SimdConvolutionActivationGelu>(p, convolution); break;
             default: assert(0);
             }
             return true;
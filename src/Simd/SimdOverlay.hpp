@@ -0,0 +1,235 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdOverlay_hpp__
+#define __SimdOverlay_hpp__
+
+#include "Simd/SimdFont.hpp"
+
+#include <vector>
+
+namespace Simd
+{
+    /*! @ingroup cpp_drawing
+
+        \short The Overlay class draws a batch of lines, rectangles and texts at the image in one pass.
+
+        Primitives are accumulated by Add* methods and are drawn by method Overlay::Draw. The image is processed by horizontal bands
+        of cache size: all primitives which cover a band are drawn into it while the band stays in the cache, bands which are not covered
+        by any primitive are not touched. The result is the same as the result of sequential calls of Simd::DrawLine, Simd::DrawRectangle,
+        Simd::DrawFilledRectangle and Simd::Font::Draw in order of addition.
+
+        Using example:
+        \code
+        #include "Simd/SimdOverlay.hpp"
+
+        int main()
+        {
+            typedef Simd::Pixel::Bgra32 Color;
+            typedef Simd::Overlay<Color> Overlay;
+
+            Simd::Font font(16);
+            font.SetCacheSize(64);
+
+            Overlay::View image(1920, 1080, Overlay::View::Bgra32);
+            Simd::FillPixel(image, Color(128, 128, 0));
+
+            Overlay overlay;
+            overlay.AddFilledRectangle(Overlay::Rect(10, 10, 200, 40), Color(0, 0, 0));
+            overlay.AddText(font, "Camera 1", Overlay::Point(14, 14), Color(255, 255, 255));
+            overlay.AddRectangle(Overlay::Rect(300, 200, 500, 400), Color(0, 255, 0), 2);
+            overlay.Draw(image);
+
+            image.Save("overlay.ppm");
+
+            return 0;
+        }
+        \endcode
+    */
+    template<class Color> class Overlay
+    {
+    public:
+        typedef Simd::Font Font; /*!< Font type definition. */
+        typedef Font::String String; /*!< String type definition. */
+        typedef Font::Point Point; /*!< Point type definition. */
+        typedef Font::View View; /*!< Image type definition. */
+        typedef Simd::Rectangle<ptrdiff_t> Rect; /*!< Rectangle type definition. */
+
+        /*!
+            Removes all added primitives.
+        */
+        void Clear()
+        {
+            _items.clear();
+        }
+
+        /*!
+            Gets number of added primitives.
+
+            \return number of added primitives.
+        */
+        size_t Size() const
+        {
+            return _items.size();
+        }
+
+        /*!
+            Adds a line (see Simd::DrawLine).
+
+            \param [in] p1 - the first point of the line.
+            \param [in] p2 - the second point of the line.
+            \param [in] color - a color of the line.
+            \param [in] width - a width of the line. By default it is equal to 1.
+        */
+        void AddLine(const Point & p1, const Point & p2, const Color & color, size_t width = 1)
+        {
+            Rect bound(std::min(p1.x, p2.x), std::min(p1.y, p2.y), std::max(p1.x, p2.x), std::max(p1.y, p2.y));
+            Add(LineType, bound, p1, p2, color, width);
+        }
+
+        /*!
+            Adds a rectangle frame (see Simd::DrawRectangle).
+
+            \param [in] rect - a rectangle.
+            \param [in] color - a color of the rectangle frame.
+            \param [in] width - a width of the rectangle frame. By default it is equal to 1.
+        */
+        void AddRectangle(const Rect & rect, const Color & color, size_t width = 1)
+        {
+            Rect bound(std::min(rect.left, rect.right), std::min(rect.top, rect.bottom), std::max(rect.left, rect.right), std::max(rect.top, rect.bottom));
+            Add(RectangleType, bound, rect.TopLeft(), rect.BottomRight(), color, width);
+        }
+
+        /*!
+            Adds a filled rectangle (see Simd::DrawFilledRectangle).
+
+            \param [in] rect - a rectangle to fill.
+            \param [in] color - a color of the filled rectangle.
+        */
+        void AddFilledRectangle(const Rect & rect, const Color & color)
+        {
+            Add(FilledRectangleType, rect, rect.TopLeft(), rect.BottomRight(), color, 0);
+        }
+
+        /*!
+            Adds a text (see Simd::Font::Draw).
+
+            \note The font must not be changed or destroyed until drawing of the overlay.
+
+            \param [in] font - a font to draw the text.
+            \param [in] text - a text to draw.
+            \param [in] position - a start position to draw text.
+            \param [in] color - a color of the text.
+        */
+        void AddText(const Font & font, const String & text, const Point & position, const Color & color)
+        {
+            Add(TextType, Rect(position, position + font.Measure(text)), position, position, color, 0);
+            _items.back().font = &font;
+            _items.back().text = text;
+        }
+
+        /*!
+            Draws all added primitives at the image.
+
+            \param [in, out] canvas - a canvas (image where we draw primitives).
+        */
+        void Draw(View & canvas) const
+        {
+            assert(canvas.PixelSize() == sizeof(Color));
+
+            if (_items.empty() || canvas.Area() == 0)
+                return;
+            ptrdiff_t band = std::max<ptrdiff_t>(SimdCpuInfo(SimdCpuInfoCacheL2) / 2 / (canvas.width * sizeof(Color)), 1);
+            for (ptrdiff_t top = 0; top < (ptrdiff_t)canvas.height; top += band)
+            {
+                Rect rows(0, top, canvas.width, std::min<ptrdiff_t>(top + band, canvas.height));
+                View region = canvas.Region(rows);
+                for (size_t i = 0; i < _items.size(); ++i)
+                {
+                    const Item & item = _items[i];
+                    if (item.bound.Intersection(rows).Empty())
+                        continue;
+                    switch (item.type)
+                    {
+                    case LineType:
+                        Detail::DrawLine(canvas, item.p1.x, item.p1.y, item.p2.x, item.p2.y, item.color, item.width, rows.top, rows.bottom);
+                        break;
+                    case RectangleType:
+                        Detail::DrawLine(canvas, item.p1.x, item.p1.y, item.p2.x, item.p1.y, item.color, item.width, rows.top, rows.bottom);
+                        Detail::DrawLine(canvas, item.p2.x, item.p1.y, item.p2.x, item.p2.y, item.color, item.width, rows.top, rows.bottom);
+                        Detail::DrawLine(canvas, item.p2.x, item.p2.y, item.p1.x, item.p2.y, item.color, item.width, rows.top, rows.bottom);
+                        Detail::DrawLine(canvas, item.p1.x, item.p2.y, item.p1.x, item.p1.y, item.color, item.width, rows.top, rows.bottom);
+                        break;
+                    case FilledRectangleType:
+                        DrawFilledRectangle(canvas, item.bound.Intersection(rows), item.color);
+                        break;
+                    case TextType:
+                        item.font->Draw(region, item.text, item.p1 - Point(0, rows.top), item.color);
+                        break;
+                    default:
+                        assert(0);
+                    }
+                }
+            }
+        }
+
+    private:
+        enum Type
+        {
+            LineType,
+            RectangleType,
+            FilledRectangleType,
+            TextType
+        };
+
+        struct Item
+        {
+            Type type;
+            Rect bound;
+            Point p1, p2;
+            Color color;
+            size_t width;
+            const Font * font;
+            String text;
+        };
+        typedef std::vector<Item> Items;
+
+        Items _items;
+
+        void Add(Type type, const Rect & bound, const Point & p1, const Point & p2, const Color & color, size_t width)
+        {
+            ptrdiff_t border = width + 1;
+            _items.push_back(Item());
+            Item & item = _items.back();
+            item.type = type;
+            item.bound = width ? Rect(bound.left - border, bound.top - border, bound.right + border, bound.bottom + border) : bound;
+            item.p1 = p1;
+            item.p2 = p2;
+            item.color = color;
+            item.width = width;
+            item.font = NULL;
+        }
+    };
+}
+
+#endif//__SimdOverlay_hpp__
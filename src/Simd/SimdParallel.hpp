@@ -26,6 +26,7 @@
 
 #include <vector>
 #include <thread>
+#include <atomic>
 #ifndef SIMD_FUTURE_DISABLE
 #include <future>
 #endif
@@ -61,6 +62,17 @@ namespace Simd
         }
 #endif
     }
+
+    template<class Function> inline void ParallelQueue(size_t count, size_t threadNumber, const Function & function)
+    {
+        threadNumber = std::max<size_t>(std::min<size_t>(threadNumber, count), 1);
+        std::atomic<size_t> next(0);
+        Parallel(0, threadNumber, [&](size_t thread, size_t begin, size_t end)
+        {
+            for (size_t i = next++; i < count; i = next++)
+                function(thread, i);
+        }, threadNumber);
+    }
 }
 
 #endif//__SimdParallel_hpp__
@@ -0,0 +1,102 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdParallelRows_h__
+#define __SimdParallelRows_h__
+
+#include "Simd/SimdArray.h"
+#include "Simd/SimdMath.h"
+#include "Simd/SimdBase.h"
+#include "Simd/SimdParallel.hpp"
+
+namespace Simd
+{
+    namespace Base
+    {
+        bool ParallelRowsEnable(size_t width, size_t height);
+
+        struct ParallelRowsWorker
+        {
+            ParallelRowsWorker();
+            ~ParallelRowsWorker();
+        };
+
+        template<class Function> void ParallelRows(size_t height, size_t align, const Function & function)
+        {
+            Simd::Parallel(0, height, [&function](size_t thread, size_t begin, size_t end)
+            {
+                ParallelRowsWorker worker;
+                function(begin, end);
+            }, GetThreadNumber(), align);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        SIMD_INLINE size_t ParallelRowsTransformOffset(SimdTransformType transform, size_t height, size_t begin, size_t end, size_t pixelSize, size_t dstStride)
+        {
+            switch (transform)
+            {
+            case SimdTransformRotate0: return begin * dstStride;
+            case SimdTransformRotate90: return begin * pixelSize;
+            case SimdTransformRotate180: return (height - end) * dstStride;
+            case SimdTransformRotate270: return (height - end) * pixelSize;
+            case SimdTransformTransposeRotate0: return begin * pixelSize;
+            case SimdTransformTransposeRotate90: return begin * dstStride;
+            case SimdTransformTransposeRotate180: return (height - end) * pixelSize;
+            case SimdTransformTransposeRotate270: return (height - end) * dstStride;
+            default:
+                assert(0);
+                return 0;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        // Bayer demosaicing replicates border row pairs, so the boundary row pairs of each block are recomputed with their real neighbours.
+        template<class Convert> void ParallelRowsBayer(size_t width, size_t height, size_t channels, uint8_t * dst, size_t dstStride, const Convert & convert)
+        {
+            ParallelRows(height, 2, [&](size_t begin, size_t end)
+            {
+                convert(begin, end - begin, dst + begin * dstStride, dstStride);
+                size_t rowSize = width * channels;
+                Array8u buffer(6 * rowSize);
+                if (begin > 0)
+                {
+                    size_t top = begin - 2, bottom = Min(begin + 4, height);
+                    convert(top, bottom - top, buffer.data, rowSize);
+                    for (size_t row = 0; row < 2; ++row)
+                        memcpy(dst + (begin + row) * dstStride, buffer.data + (begin - top + row) * rowSize, rowSize);
+                }
+                if (end < height)
+                {
+                    size_t top = end < 4 ? 0 : end - 4, bottom = end + 2;
+                    convert(top, bottom - top, buffer.data, rowSize);
+                    for (size_t row = 0; row < 2; ++row)
+                        memcpy(dst + (end - 2 + row) * dstStride, buffer.data + (end - 2 - top + row) * rowSize, rowSize);
+                }
+            });
+        }
+    }
+}
+
+#endif//__SimdParallelRows_h__
@@ -257,6 +257,40 @@ namespace Simd
         //---------------------------------------------------------------------------------------------
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        //---------------------------------------------------------------------------------------------
+
+        class ResizerYuv420p : public Deletable
+        {
+        public:
+            typedef void* (*ResizerInitPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+            typedef void (*InterleaveUvPtr)(const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, size_t width, size_t height, uint8_t* uv, size_t uvStride);
+            typedef void (*Nv12ToBgrPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgr, size_t bgrStride, SimdYuvType yuvType);
+            typedef void (*Nv12ToBgraPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* bgra, size_t bgraStride, uint8_t alpha, SimdYuvType yuvType);
+
+            ResizerYuv420p(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method,
+                ResizerInitPtr resizerInit, InterleaveUvPtr interleaveUv, Nv12ToBgrPtr nv12ToBgr, Nv12ToBgrPtr nv12ToRgb, Nv12ToBgraPtr nv12ToBgra, Nv12ToBgraPtr nv12ToRgba);
+            virtual ~ResizerYuv420p();
+
+            bool Valid() const { return _valid; }
+
+            void Run(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride, uint8_t* dst, size_t dstStride);
+
+            static bool Supported(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format);
+
+        protected:
+            size_t _dstX, _dstY;
+            SimdPixelFormatType _format;
+            SimdYuvType _yuvType;
+            bool _valid;
+            Resizer * _y, * _uv, * _u;
+            InterleaveUvPtr _interleaveUv;
+            Nv12ToBgrPtr _toBgr;
+            Nv12ToBgraPtr _toBgra;
+            Array8u _buffer;
+        };
+
+        void * ResizerYuv420pInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
     }
 
 #ifdef SIMD_SSE41_ENABLE    
@@ -369,6 +403,8 @@ namespace Simd
         //---------------------------------------------------------------------------------------------
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerYuv420pInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
     }
 #endif //SIMD_SSE41_ENABLE
 
@@ -484,6 +520,8 @@ namespace Simd
         //---------------------------------------------------------------------------------------------
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerYuv420pInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX2_ENABLE 
 
@@ -584,6 +622,8 @@ namespace Simd
         //---------------------------------------------------------------------------------------------
 
         void * ResizerInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, size_t channels, SimdResizeChannelType type, SimdResizeMethodType method);
+
+        void * ResizerYuv420pInit(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
     }
 #endif //SIMD_AVX512BW_ENABLE 
 
@@ -26,8 +26,10 @@
 #define __SimdShift_hpp__
 
 #include "Simd/SimdLib.hpp"
+#include "Simd/SimdParallel.hpp"
 
 #include <vector>
+#include <thread>
 #include <float.h>
 
 namespace Simd
@@ -66,6 +68,17 @@ namespace Simd
             return 0;
         }
         \endverbatim
+
+        If there are many regions at the same frame it is better to use batch version of ShiftDetector::Estimate():
+        \verbatim
+        ShiftDetector::Rects regions;
+        for (ptrdiff_t y = 64; y + 128 <= 448; y += 128)
+            for (ptrdiff_t x = 64; x + 128 <= 448; x += 128)
+                regions.push_back(ShiftDetector::Rect(x, y, x + 128, y + 128));
+
+        ShiftDetector::Results results;
+        detector.Estimate(currentFrame, regions, ShiftDetector::Points(1, ShiftDetector::Point(32, 32)), results);
+        \endverbatim
     */
     template <template<class> class A>
     struct ShiftDetector
@@ -75,6 +88,31 @@ namespace Simd
         typedef Simd::Point<ptrdiff_t> Point; /*!< A point with integer coordinates. */
         typedef Simd::Point<double> FPoint; /*!< A point with float point coordinates. */
         typedef Rectangle<ptrdiff_t> Rect; /*!< A rectangle type definition. */
+        typedef std::vector<Rect> Rects; /*!< A vector of rectangles type definition. */
+        typedef std::vector<Point> Points; /*!< A vector of points type definition. */
+
+        /*!
+            \short The Result structure contains result of shift estimation of one region (see batch version of ShiftDetector::Estimate()).
+        */
+        struct Result
+        {
+            bool found; /*!< A flag that shift was found. Other fields are valid only if this flag is true. */
+            Point shift; /*!< Estimated integer shift (see ShiftDetector::Shift()). */
+            FPoint proximateShift; /*!< Proximate shift with sub-pixel accuracy (see ShiftDetector::ProximateShift()). */
+            double stability; /*!< Stability (reliability) of found shift (see ShiftDetector::Stability()). */
+            double correlation; /*!< The best correlation of background and current image (see ShiftDetector::Correlation()). */
+
+            /*!
+                Creates a new empty Result structure.
+            */
+            Result()
+                : found(false)
+                , stability(0)
+                , correlation(0)
+            {
+            }
+        };
+        typedef std::vector<Result> Results; /*!< A vector of shift estimation results type definition. */
 
         /*!
             \enum TextureType
@@ -110,6 +148,26 @@ namespace Simd
             SquaredDifference,
         };
 
+        /*!
+            Creates a new ShiftDetector structure.
+        */
+        ShiftDetector()
+            : _textureType(TextureGray)
+            , _differenceType(AbsDifference)
+            , _threadNumber(std::max<size_t>(std::thread::hardware_concurrency(), 1))
+        {
+        }
+
+        /*!
+            Sets maximal number of threads used in batch version of ShiftDetector::Estimate(). By default it is equal to number of hardware threads.
+
+            \param [in] threadNumber - a number of threads.
+        */
+        void SetThreadNumber(size_t threadNumber)
+        {
+            _threadNumber = std::max<size_t>(threadNumber, 1);
+        }
+
         /*!
             Initializes internal buffers of ShiftDetector structure. It allows it to work with image of given size.
 
@@ -182,19 +240,10 @@ namespace Simd
             if (region.Area() < regionAreaMin)
                 return false;
 
-            InitLevels(region, maxShift, regionAreaMin);
+            InitLevels(_levels, region, maxShift, regionAreaMin);
             SetCurrent(current, region);
 
-            Point shift;
-            for (ptrdiff_t i = _levels.size() - 1; i >= 0; i--)
-            {
-                shift.x *= 2;
-                shift.y *= 2;
-                if (!SearchLocalMin(_levels[i], shift, hiddenAreaPenalty))
-                    return false;
-                shift = _levels[i].shift;
-            }
-            return true;
+            return Search(_levels, hiddenAreaPenalty);
         }
 
         /*!
@@ -212,6 +261,59 @@ namespace Simd
             return Estimate(current, region, Point(maxShift, maxShift), hiddenAreaPenalty, regionAreaMin);
         }
 
+        /*!
+            Estimates shifts of many regions of current frame relative to background image.
+
+            Texture image and pyramid of current frame are built once. Then regions are processed in parallel (see ShiftDetector::SetThreadNumber()),
+            every thread uses its own buffers of differences. Results of this function do not change state of ShiftDetector::Shift() and other getters.
+
+            \param [in] current - current frame. Its size must be equal to frameSize (see function ShiftDetector::InitBuffers).
+            \param [in] regions - regions at the background where the algorithm start to search corresponding regions of current frame.
+            \param [in] maxShifts - maximal possible shifts of the regions (along X and Y axes). It contains one common value or value for every region.
+            \param [out] results - results of shift estimation of every region.
+            \param [in] hiddenAreaPenalty - a parameter used to restrict searching of the shift at the border of background image.
+            \param [in] regionAreaMin - a parameter used to set minimal area of region use for shift estimation. By default is equal to 25.
+            \return a result of the operation. It is false if input parameters are wrong.
+        */
+        bool Estimate(const View & current, const Rects & regions, const Points & maxShifts, Results & results,
+            double hiddenAreaPenalty = 0, ptrdiff_t regionAreaMin = REGION_CORRELATION_AREA_MIN)
+        {
+            if (_current.Size() == 0 || current.Size() != _current[0].Size() || current.format != View::Gray8)
+                return false;
+            if (maxShifts.size() != 1 && maxShifts.size() != regions.size())
+                return false;
+
+            SetCurrent(current);
+
+            results.clear();
+            results.resize(regions.size());
+            size_t threadNumber = std::max<size_t>(std::min<size_t>(_threadNumber, regions.size()), 1);
+            if (_threads.size() < threadNumber)
+            {
+                _threads.clear();
+                _threads.resize(threadNumber);
+            }
+            ParallelQueue(regions.size(), threadNumber, [&](size_t thread, size_t i)
+            {
+                Levels & levels = _threads[thread];
+                const Rect & region = regions[i];
+                if (region.Area() < regionAreaMin || region.Left() < 0 || region.Top() < 0 ||
+                    region.Right() > current.Size().x || region.Bottom() > current.Size().y)
+                    return;
+                InitLevels(levels, region, maxShifts[maxShifts.size() == 1 ? 0 : i], regionAreaMin);
+                if (Search(levels, hiddenAreaPenalty))
+                {
+                    Result & result = results[i];
+                    result.found = true;
+                    result.shift = levels[0].shift;
+                    result.proximateShift = FPoint(levels[0].shift) + levels[0].differences.Refinement();
+                    result.stability = levels[0].differences.Stability();
+                    result.correlation = Correlation(levels[0]);
+                }
+            });
+            return true;
+        }
+
         /*!
             Gets estimated integer shift of current image relative to background image.
 
@@ -249,11 +351,7 @@ namespace Simd
         */
         double Correlation() const
         {
-            double difference = _levels[0].differences.At(_levels[0].shift);
-            if (_differenceType == AbsDifference)
-                return 1.0 - difference / 255;
-            else
-                return 1.0 - ::sqrt(difference) / 255;
+            return Correlation(_levels[0]);
         }
 
 
@@ -444,8 +542,10 @@ namespace Simd
         Levels _levels;
         TextureType _textureType;
         DifferenceType _differenceType;
+        size_t _threadNumber;
+        std::vector<Levels> _threads;
 
-        SIMD_INLINE size_t AlignHi(size_t size, size_t align)
+        SIMD_INLINE size_t AlignHi(size_t size, size_t align) const
         {
             return (size + align - 1) & ~(align - 1);
         }
@@ -455,7 +555,7 @@ namespace Simd
             return size & ~(align - 1);
         }
 
-        void InitLevels(const Rect & region, const Point & maxShift, ptrdiff_t regionAreaMin)
+        void InitLevels(Levels & levels, const Rect & region, const Point & maxShift, ptrdiff_t regionAreaMin) const
         {
             assert(region.Left() >= 0 && region.Top() >= 0 && region.Right() <= _current[0].Size().x && region.Bottom() <= _current[0].Size().y);
 
@@ -470,33 +570,44 @@ namespace Simd
 
             const ptrdiff_t maxShiftMin = 2;
 
-            _levels.resize(levelCount);
+            levels.resize(levelCount);
             size_t buildRegionAlign = size_t(1) << (levelCount - 1);
-            for (size_t i = 0; i < _levels.size(); ++i)
+            for (size_t i = 0; i < levels.size(); ++i)
             {
-                _levels[i].maxShift.x = std::max<ptrdiff_t>((maxShift.x >> i) + 1, maxShiftMin);
-                _levels[i].maxShift.y = std::max<ptrdiff_t>((maxShift.y >> i) + 1, maxShiftMin);
+                levels[i].maxShift.x = std::max<ptrdiff_t>((maxShift.x >> i) + 1, maxShiftMin);
+                levels[i].maxShift.y = std::max<ptrdiff_t>((maxShift.y >> i) + 1, maxShiftMin);
 
-                _levels[i].neighborhood.x = (i == _levels.size() - 1 ? _levels[i].maxShift.x : maxShiftMin + 1);
-                _levels[i].neighborhood.y = (i == _levels.size() - 1 ? _levels[i].maxShift.y : maxShiftMin + 1);
+                levels[i].neighborhood.x = (i == levels.size() - 1 ? levels[i].maxShift.x : maxShiftMin + 1);
+                levels[i].neighborhood.y = (i == levels.size() - 1 ? levels[i].maxShift.y : maxShiftMin + 1);
 
-                _levels[i].searchRegion.left = region.left >> i;
-                _levels[i].searchRegion.top = region.top >> i;
-                _levels[i].searchRegion.right = region.right >> i;
-                _levels[i].searchRegion.bottom = region.bottom >> i;
+                levels[i].searchRegion.left = region.left >> i;
+                levels[i].searchRegion.top = region.top >> i;
+                levels[i].searchRegion.right = region.right >> i;
+                levels[i].searchRegion.bottom = region.bottom >> i;
 
-                _levels[i].current = _current[i];
-                _levels[i].background = _background[i];
+                levels[i].current = _current[i];
+                levels[i].background = _background[i];
 
-                _levels[i].shift = Point(INT_MAX, INT_MAX);
+                levels[i].shift = Point(INT_MAX, INT_MAX);
 
-                _levels[i].buildRegion.left = AlignLo(region.left, buildRegionAlign) >> i;
-                _levels[i].buildRegion.top = AlignLo(region.top, buildRegionAlign) >> i;
-                _levels[i].buildRegion.right = AlignHi(region.right, buildRegionAlign) >> i;
-                _levels[i].buildRegion.bottom = AlignHi(region.bottom, buildRegionAlign) >> i;
+                levels[i].buildRegion.left = AlignLo(region.left, buildRegionAlign) >> i;
+                levels[i].buildRegion.top = AlignLo(region.top, buildRegionAlign) >> i;
+                levels[i].buildRegion.right = AlignHi(region.right, buildRegionAlign) >> i;
+                levels[i].buildRegion.bottom = AlignHi(region.bottom, buildRegionAlign) >> i;
             }
         }
 
+        void SetCurrent(const View & current)
+        {
+            if (_textureType == TextureGray)
+                Simd::Copy(current, _current[0]);
+            else if (_textureType == TextureGrad)
+                Simd::AbsGradientSaturatedSum(current, _current[0]);
+            else
+                assert(0);
+            Build(_current, ::SimdReduce2x2);
+        }
+
         void SetCurrent(const View & current, const Rect & region)
         {
             if (_textureType == TextureGray)
@@ -509,7 +620,30 @@ namespace Simd
                 Simd::ReduceGray2x2(_current[i - 1].Region(_levels[i - 1].buildRegion), _current[i].Region(_levels[i].buildRegion).Ref());
         }
 
-        double GetDifference(const View & background, const View & current, const Point & shift, const Rect & region)
+        bool Search(Levels & levels, double hiddenAreaPenalty) const
+        {
+            Point shift;
+            for (ptrdiff_t i = levels.size() - 1; i >= 0; i--)
+            {
+                shift.x *= 2;
+                shift.y *= 2;
+                if (!SearchLocalMin(levels[i], shift, hiddenAreaPenalty))
+                    return false;
+                shift = levels[i].shift;
+            }
+            return true;
+        }
+
+        double Correlation(const Level & level) const
+        {
+            double difference = level.differences.At(level.shift);
+            if (_differenceType == AbsDifference)
+                return 1.0 - difference / 255;
+            else
+                return 1.0 - ::sqrt(difference) / 255;
+        }
+
+        double GetDifference(const View & background, const View & current, const Point & shift, const Rect & region) const
         {
             View _background = background.Region(region.Shifted(shift));
             View _current = current.Region(region);
@@ -521,7 +655,7 @@ namespace Simd
             return double(difference) / region.Area();
         }
 
-        void GetDifferences3x3(Level & level, const Point & shift)
+        void GetDifferences3x3(Level & level, const Point & shift) const
         {
             Point size = level.current.Size();
             Rect enlarged = level.searchRegion;
@@ -550,7 +684,7 @@ namespace Simd
             }
         }
 
-        bool SearchLocalMin(Level & level, const Point & shift, double hiddenAreaPenalty)
+        bool SearchLocalMin(Level & level, const Point & shift, double hiddenAreaPenalty) const
         {
             Differences & differences = level.differences;
             differences.Init(level.neighborhood, shift);
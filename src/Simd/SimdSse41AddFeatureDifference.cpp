@@ -99,6 +99,61 @@ namespace Simd
             else
                 AddFeatureDifference<false>(value, valueStride, width, height, lo, loStride, hi, hiStride, weight, difference, differenceStride);
         }
+
+        template <bool align> SIMD_INLINE void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi,
+            size_t offset, const uint16_t * weight, size_t count, const uint8_t * mask, uint8_t * difference)
+        {
+            __m128i sum = _mm_setzero_si128();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const __m128i _value = Load<align>((__m128i*)(value[i] + offset));
+                const __m128i _lo = Load<align>((__m128i*)(lo[i] + offset));
+                const __m128i _hi = Load<align>((__m128i*)(hi[i] + offset));
+                const __m128i featureDifference = FeatureDifference(_value, _lo, _hi);
+                sum = _mm_adds_epu8(sum, ShiftedWeightedSquare8(featureDifference, _mm_set1_epi16((short)weight[i])));
+            }
+            if (mask)
+                sum = _mm_and_si128(sum, Load<align>((__m128i*)mask));
+            Store<align>((__m128i*)difference, sum);
+        }
+
+        template <bool align> void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+            uint8_t * difference, size_t differenceStride)
+        {
+            assert(width >= A);
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0, offset = 0; row < height; ++row, offset += stride)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    FeatureDifferenceSum<align>(value, lo, hi, offset + col, weight, count, mask ? mask + col : NULL, difference + col);
+                if (alignedWidth != width)
+                    FeatureDifferenceSum<false>(value, lo, hi, offset + width - A, weight, count, mask ? mask + width - A : NULL, difference + width - A);
+                if (mask)
+                    mask += maskStride;
+                difference += differenceStride;
+            }
+        }
+
+        bool FeatureDifferenceSumAligned(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            size_t count, const uint8_t * mask, size_t maskStride, uint8_t * difference, size_t differenceStride)
+        {
+            bool aligned = Aligned(stride) && Aligned(difference) && Aligned(differenceStride) && (mask == NULL || (Aligned(mask) && Aligned(maskStride)));
+            for (size_t i = 0; i < count && aligned; ++i)
+                aligned = Aligned(value[i]) && Aligned(lo[i]) && Aligned(hi[i]);
+            return aligned;
+        }
+
+        void FeatureDifferenceSum(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+            const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+            uint8_t * difference, size_t differenceStride)
+        {
+            if (FeatureDifferenceSumAligned(value, lo, hi, stride, count, mask, maskStride, difference, differenceStride))
+                FeatureDifferenceSum<true>(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+            else
+                FeatureDifferenceSum<false>(value, lo, hi, stride, weight, count, width, height, mask, maskStride, difference, differenceStride);
+        }
     }
 #endif
 }
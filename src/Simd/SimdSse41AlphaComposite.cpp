@@ -0,0 +1,73 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdAlphaBlending.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        const __m128i K8_SHUFFLE_ALPHA_LO = SIMD_MM_SETR_EPI8(0x3, -1, 0x3, -1, 0x3, -1, 0x3, -1, 0x7, -1, 0x7, -1, 0x7, -1, 0x7, -1);
+        const __m128i K8_SHUFFLE_ALPHA_HI = SIMD_MM_SETR_EPI8(0xB, -1, 0xB, -1, 0xB, -1, 0xB, -1, 0xF, -1, 0xF, -1, 0xF, -1, 0xF, -1);
+
+        SIMD_INLINE void AlphaBlendingPremultiplied(const uint8_t* src, uint8_t* dst)
+        {
+            __m128i _src = _mm_loadu_si128((__m128i*)src);
+            __m128i _dst = _mm_loadu_si128((__m128i*)dst);
+            __m128i lo = _mm_mullo_epi16(_mm_unpacklo_epi8(_dst, K_ZERO), _mm_sub_epi16(K16_00FF, _mm_shuffle_epi8(_src, K8_SHUFFLE_ALPHA_LO)));
+            __m128i hi = _mm_mullo_epi16(_mm_unpackhi_epi8(_dst, K_ZERO), _mm_sub_epi16(K16_00FF, _mm_shuffle_epi8(_src, K8_SHUFFLE_ALPHA_HI)));
+            _mm_storeu_si128((__m128i*)dst, _mm_adds_epu8(_src, _mm_packus_epi16(Divide16uBy255(lo), Divide16uBy255(hi))));
+        }
+
+        void AlphaBlendingPremultiplied(const uint8_t* src, size_t srcStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, size_t channelCount)
+        {
+            if (channelCount != 4)
+            {
+                Base::AlphaBlendingPremultiplied(src, srcStride, width, height, dst, dstStride, channelCount);
+                return;
+            }
+            size_t size = width * 4, sizeA = AlignLo(size, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t i = 0; i < sizeA; i += A)
+                    AlphaBlendingPremultiplied(src + i, dst + i);
+                if (sizeA < size)
+                    Base::AlphaBlendingPremultiplied(src + sizeA, 0, (size - sizeA) / 4, 1, dst + sizeA, 0, 4);
+                src += srcStride;
+                dst += dstStride;
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void AlphaComposite(const SimdAlphaLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height, size_t channelCount)
+        {
+            static const Base::AlphaCompositeKernels kernels = { A, AlphaBlending, AlphaBlendingUniform, AlphaFilling, AlphaBlendingPremultiplied };
+            Base::AlphaComposite(layers, count, dst, dstStride, width, height, channelCount, kernels);
+        }
+    }
+#endif
+}
@@ -0,0 +1,216 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBayer.h"
+#include "Simd/SimdInterleave.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i Bayer16Gain(__m128i src, __m128i gain, __m128i round, __m128i max)
+        {
+            return _mm_min_epi32(_mm_srli_epi32(_mm_add_epi32(_mm_mullo_epi32(src, gain), round), Base::BAYER16_GAIN_SHIFT), max);
+        }
+
+        SIMD_INLINE void Bayer16GainRow8(const uint16_t* src, __m128i gain, __m128i round, __m128i max, uint16_t* dst)
+        {
+            __m128i _src = _mm_loadu_si128((__m128i*)src);
+            __m128i lo = Bayer16Gain(_mm_cvtepu16_epi32(_src), gain, round, max);
+            __m128i hi = Bayer16Gain(_mm_unpackhi_epi16(_src, K_ZERO), gain, round, max);
+            _mm_storeu_si128((__m128i*)dst, _mm_packus_epi32(lo, hi));
+        }
+
+        void Bayer16GainRow(const uint16_t* src, size_t width, const uint32_t gain[2], uint32_t max, uint16_t* dst)
+        {
+            assert(width >= HA);
+
+            __m128i _gain = _mm_setr_epi32(gain[0], gain[1], gain[0], gain[1]);
+            __m128i _round = _mm_set1_epi32(1 << (Base::BAYER16_GAIN_SHIFT - 1));
+            __m128i _max = _mm_set1_epi32(max);
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                Bayer16GainRow8(src + x, _gain, _round, _max, dst + x);
+            if (widthHA < width)
+                Bayer16GainRow8(src + width - HA, _gain, _round, _max, dst + width - HA);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        template<int part> SIMD_INLINE __m128i Bayer16Load(const uint16_t* src)
+        {
+            __m128i _src = _mm_loadu_si128((__m128i*)src);
+            return part ? _mm_unpackhi_epi16(_src, K_ZERO) : _mm_cvtepu16_epi32(_src);
+        }
+
+        SIMD_INLINE __m128i Bayer16Value(__m128i value, __m128i round, __m128i shift, __m128i max)
+        {
+            return _mm_min_epi32(_mm_max_epi32(_mm_sra_epi32(_mm_add_epi32(value, round), shift), K_ZERO), max);
+        }
+
+        template<bool malvar, bool red, int part> SIMD_INLINE __m128i Bayer16Demosaic(const uint16_t* src[5], size_t x, __m128i green,
+            __m128i round, __m128i shift, __m128i max, __m128i& b, __m128i& g)
+        {
+            __m128i c = Bayer16Load<part>(src[2] + x);
+            __m128i we = _mm_add_epi32(Bayer16Load<part>(src[2] + x - 1), Bayer16Load<part>(src[2] + x + 1));
+            __m128i ns = _mm_add_epi32(Bayer16Load<part>(src[1] + x), Bayer16Load<part>(src[3] + x));
+            __m128i diag = _mm_add_epi32(_mm_add_epi32(Bayer16Load<part>(src[1] + x - 1), Bayer16Load<part>(src[1] + x + 1)),
+                _mm_add_epi32(Bayer16Load<part>(src[3] + x - 1), Bayer16Load<part>(src[3] + x + 1)));
+            __m128i gat, hor, ver, dia;
+            if (malvar)
+            {
+                __m128i wwee = _mm_add_epi32(Bayer16Load<part>(src[2] + x - 2), Bayer16Load<part>(src[2] + x + 2));
+                __m128i nnss = _mm_add_epi32(Bayer16Load<part>(src[0] + x), Bayer16Load<part>(src[4] + x));
+                __m128i far = _mm_add_epi32(wwee, nnss), c10 = _mm_add_epi32(_mm_slli_epi32(c, 3), _mm_slli_epi32(c, 1));
+                __m128i diag2 = _mm_slli_epi32(diag, 1);
+                gat = _mm_sub_epi32(_mm_add_epi32(_mm_slli_epi32(c, 3), _mm_slli_epi32(_mm_add_epi32(we, ns), 2)), _mm_slli_epi32(far, 1));
+                hor = _mm_add_epi32(_mm_sub_epi32(_mm_add_epi32(c10, _mm_slli_epi32(we, 3)), _mm_add_epi32(_mm_slli_epi32(wwee, 1), diag2)), nnss);
+                ver = _mm_add_epi32(_mm_sub_epi32(_mm_add_epi32(c10, _mm_slli_epi32(ns, 3)), _mm_add_epi32(_mm_slli_epi32(nnss, 1), diag2)), wwee);
+                dia = _mm_sub_epi32(_mm_add_epi32(_mm_add_epi32(c10, _mm_slli_epi32(c, 1)), _mm_slli_epi32(diag, 2)), _mm_add_epi32(_mm_slli_epi32(far, 1), far));
+            }
+            else
+            {
+                gat = _mm_slli_epi32(_mm_add_epi32(we, ns), 2);
+                hor = _mm_slli_epi32(we, 3);
+                ver = _mm_slli_epi32(ns, 3);
+                dia = _mm_slli_epi32(diag, 2);
+            }
+            c = _mm_slli_epi32(c, 4);
+            b = Bayer16Value(_mm_blendv_epi8(red ? dia : c, red ? ver : hor, green), round, shift, max);
+            g = Bayer16Value(_mm_blendv_epi8(gat, c, green), round, shift, max);
+            return Bayer16Value(_mm_blendv_epi8(red ? c : dia, red ? hor : ver, green), round, shift, max);
+        }
+
+        template<bool malvar, bool red> SIMD_INLINE void Bayer16Demosaic8(const uint16_t* src[5], size_t x, __m128i green,
+            __m128i round, __m128i shift, __m128i max, uint16_t* b, uint16_t* g, uint16_t* r)
+        {
+            __m128i b0, g0, b1, g1;
+            __m128i r0 = Bayer16Demosaic<malvar, red, 0>(src, x, green, round, shift, max, b0, g0);
+            __m128i r1 = Bayer16Demosaic<malvar, red, 1>(src, x, green, round, shift, max, b1, g1);
+            _mm_storeu_si128((__m128i*)(b + x), _mm_packus_epi32(b0, b1));
+            _mm_storeu_si128((__m128i*)(g + x), _mm_packus_epi32(g0, g1));
+            _mm_storeu_si128((__m128i*)(r + x), _mm_packus_epi32(r0, r1));
+        }
+
+        template<bool malvar, bool red> void Bayer16DemosaicRow(const uint16_t* src[5], size_t width, bool greenFirst, int shift, int max, uint16_t* b, uint16_t* g, uint16_t* r)
+        {
+            __m128i green = greenFirst ? _mm_setr_epi32(-1, 0, -1, 0) : _mm_setr_epi32(0, -1, 0, -1);
+            __m128i _round = _mm_set1_epi32(1 << (shift - 1));
+            __m128i _shift = _mm_cvtsi32_si128(shift);
+            __m128i _max = _mm_set1_epi32(max);
+            size_t widthHA = AlignLo(width, HA);
+            for (size_t x = 0; x < widthHA; x += HA)
+                Bayer16Demosaic8<malvar, red>(src, x, green, _round, _shift, _max, b, g, r);
+            if (widthHA < width)
+                Bayer16Demosaic8<malvar, red>(src, width - HA, green, _round, _shift, _max, b, g, r);
+        }
+
+        void Bayer16DemosaicRow(const uint16_t* src[5], size_t width, bool malvar, bool red, bool greenFirst, int shift, int max, uint16_t* b, uint16_t* g, uint16_t* r)
+        {
+            assert(width >= HA);
+
+            if (malvar)
+            {
+                if (red)
+                    Bayer16DemosaicRow<true, true>(src, width, greenFirst, shift, max, b, g, r);
+                else
+                    Bayer16DemosaicRow<true, false>(src, width, greenFirst, shift, max, b, g, r);
+            }
+            else
+            {
+                if (red)
+                    Bayer16DemosaicRow<false, true>(src, width, greenFirst, shift, max, b, g, r);
+                else
+                    Bayer16DemosaicRow<false, false>(src, width, greenFirst, shift, max, b, g, r);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        const __m128i K8_SHUFFLE_BGR48_0 = SIMD_MM_SETR_EPI8(0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5, -1, -1);
+        const __m128i K8_SHUFFLE_BGR48_1 = SIMD_MM_SETR_EPI8(-1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1, 0x4, 0x5);
+        const __m128i K8_SHUFFLE_BGR48_2 = SIMD_MM_SETR_EPI8(-1, -1, -1, -1, 0x0, 0x1, -1, -1, -1, -1, 0x2, 0x3, -1, -1, -1, -1);
+
+        SIMD_INLINE void StoreBgr48(const uint16_t* b, const uint16_t* g, const uint16_t* r, uint16_t* bgr)
+        {
+            __m128i _b = _mm_loadu_si128((__m128i*)b);
+            __m128i _g = _mm_loadu_si128((__m128i*)g);
+            __m128i _r = _mm_loadu_si128((__m128i*)r);
+            _mm_storeu_si128((__m128i*)bgr + 0, _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(_b, K8_SHUFFLE_BGR48_0),
+                _mm_shuffle_epi8(_g, K8_SHUFFLE_BGR48_1)), _mm_shuffle_epi8(_r, K8_SHUFFLE_BGR48_2)));
+            _mm_storeu_si128((__m128i*)bgr + 1, _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(_mm_srli_si128(_r, 4), K8_SHUFFLE_BGR48_0),
+                _mm_shuffle_epi8(_mm_srli_si128(_b, 6), K8_SHUFFLE_BGR48_1)), _mm_shuffle_epi8(_mm_srli_si128(_g, 6), K8_SHUFFLE_BGR48_2)));
+            _mm_storeu_si128((__m128i*)bgr + 2, _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(_mm_srli_si128(_g, 10), K8_SHUFFLE_BGR48_0),
+                _mm_shuffle_epi8(_mm_srli_si128(_r, 10), K8_SHUFFLE_BGR48_1)), _mm_shuffle_epi8(_mm_srli_si128(_b, 12), K8_SHUFFLE_BGR48_2)));
+        }
+
+        SIMD_INLINE void StoreBgr24(const uint16_t* b, const uint16_t* g, const uint16_t* r, uint8_t* bgr)
+        {
+            __m128i _b = _mm_packus_epi16(_mm_loadu_si128((__m128i*)b + 0), _mm_loadu_si128((__m128i*)b + 1));
+            __m128i _g = _mm_packus_epi16(_mm_loadu_si128((__m128i*)g + 0), _mm_loadu_si128((__m128i*)g + 1));
+            __m128i _r = _mm_packus_epi16(_mm_loadu_si128((__m128i*)r + 0), _mm_loadu_si128((__m128i*)r + 1));
+            _mm_storeu_si128((__m128i*)bgr + 0, InterleaveBgr<0>(_b, _g, _r));
+            _mm_storeu_si128((__m128i*)bgr + 1, InterleaveBgr<1>(_b, _g, _r));
+            _mm_storeu_si128((__m128i*)bgr + 2, InterleaveBgr<2>(_b, _g, _r));
+        }
+
+        void Bayer16StoreRow(const uint16_t* b, const uint16_t* g, const uint16_t* r, size_t width, size_t bgrDepth, uint8_t* bgr)
+        {
+            if (bgrDepth == 8 && width >= A)
+            {
+                size_t widthA = AlignLo(width, A);
+                for (size_t x = 0; x < widthA; x += A)
+                    StoreBgr24(b + x, g + x, r + x, bgr + 3 * x);
+                if (widthA < width)
+                    StoreBgr24(b + width - A, g + width - A, r + width - A, bgr + 3 * (width - A));
+            }
+            else if (bgrDepth == 16)
+            {
+                uint16_t* dst = (uint16_t*)bgr;
+                size_t widthHA = AlignLo(width, HA);
+                for (size_t x = 0; x < widthHA; x += HA)
+                    StoreBgr48(b + x, g + x, r + x, dst + 3 * x);
+                if (widthHA < width)
+                    StoreBgr48(b + width - HA, g + width - HA, r + width - HA, dst + 3 * (width - HA));
+            }
+            else
+                Base::Bayer16StoreRow(b, g, r, width, bgrDepth, bgr);
+        }
+
+        //-----------------------------------------------------------------------------------------
+
+        void Bayer16ToBgr(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth,
+            const float* gains, SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth)
+        {
+            assert(width >= HA);
+
+            Base::Bayer16ToBgr(bayer, width, height, bayerStride, bayerFormat, bitDepth, gains, demosaic, bgr, bgrStride, bgrDepth,
+                Bayer16GainRow, Bayer16DemosaicRow, Bayer16StoreRow);
+        }
+    }
+#endif
+}
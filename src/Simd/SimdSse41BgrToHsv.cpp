@@ -0,0 +1,136 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+#include "Simd/SimdUnpack.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        SIMD_INLINE __m128i HsvHue32(__m128i dividend, __m128i range)
+        {
+            __m128 hue = _mm_div_ps(_mm_mul_ps(_mm_cvtepi32_ps(dividend), _mm_set1_ps(Base::KF_255_DIV_6)), _mm_cvtepi32_ps(range));
+            return _mm_and_si128(_mm_cvttps_epi32(hue), K32_000000FF);
+        }
+
+        SIMD_INLINE __m128i HsvHue16(__m128i blue, __m128i green, __m128i red, __m128i range, __m128i redMax, __m128i greenMax)
+        {
+            __m128i dividend = _mm_add_epi16(_mm_sub_epi16(red, green), _mm_mullo_epi16(range, K16_0004));
+            dividend = _mm_blendv_epi8(dividend, _mm_add_epi16(_mm_sub_epi16(blue, red), _mm_mullo_epi16(range, K16_0002)), greenMax);
+            dividend = _mm_blendv_epi8(dividend, _mm_add_epi16(_mm_sub_epi16(green, blue), _mm_mullo_epi16(range, K16_0006)), redMax);
+            __m128i lo = HsvHue32(_mm_srai_epi32(_mm_unpacklo_epi16(dividend, dividend), 16), _mm_unpacklo_epi16(range, K_ZERO));
+            __m128i hi = HsvHue32(_mm_srai_epi32(_mm_unpackhi_epi16(dividend, dividend), 16), _mm_unpackhi_epi16(range, K_ZERO));
+            return _mm_packus_epi32(lo, hi);
+        }
+
+        SIMD_INLINE __m128i HsvSaturationInRange16(__m128i max, __m128i range, __m128i satLo, __m128i satHi)
+        {
+            __m128i scaled = _mm_mullo_epi16(range, K16_00FF);
+            __m128i geLo = _mm_cmpeq_epi16(_mm_max_epu16(scaled, _mm_mullo_epi16(max, satLo)), scaled);
+            __m128i geHi = _mm_cmpeq_epi16(_mm_max_epu16(scaled, _mm_mullo_epi16(max, satHi)), scaled);
+            return _mm_andnot_si128(geHi, geLo);
+        }
+
+        SIMD_INLINE __m128i GreaterOrEqual8u(__m128i a, __m128i b)
+        {
+            return _mm_cmpeq_epi8(_mm_max_epu8(a, b), a);
+        }
+
+        SIMD_INLINE __m128i LesserOrEqual8u(__m128i a, __m128i b)
+        {
+            return _mm_cmpeq_epi8(_mm_min_epu8(a, b), a);
+        }
+
+        struct HsvRange
+        {
+            __m128i hueLo, hueHi, satLo, satHi, satZero, valLo, valHi;
+            bool hueWrap;
+
+            HsvRange(const uint8_t * lo, const uint8_t * hi)
+            {
+                hueLo = _mm_set1_epi8(lo[0]);
+                hueHi = _mm_set1_epi8(hi[0]);
+                hueWrap = lo[0] > hi[0];
+                satLo = _mm_set1_epi16(lo[1]);
+                satHi = _mm_set1_epi16(hi[1] + 1);
+                satZero = _mm_set1_epi8(lo[1] == 0 ? -1 : 0);
+                valLo = _mm_set1_epi8(lo[2]);
+                valHi = _mm_set1_epi8(hi[2]);
+            }
+        };
+
+        SIMD_INLINE void BgrToHsvRangeMask(const uint8_t * bgr, const HsvRange & hsv, uint8_t * mask)
+        {
+            __m128i _bgr[3];
+            _bgr[0] = _mm_loadu_si128((__m128i*)bgr + 0);
+            _bgr[1] = _mm_loadu_si128((__m128i*)bgr + 1);
+            _bgr[2] = _mm_loadu_si128((__m128i*)bgr + 2);
+            __m128i blue = BgrToBlue(_bgr);
+            __m128i green = BgrToGreen(_bgr);
+            __m128i red = BgrToRed(_bgr);
+            __m128i max = _mm_max_epu8(red, _mm_max_epu8(green, blue));
+            __m128i min = _mm_min_epu8(red, _mm_min_epu8(green, blue));
+            __m128i range = _mm_sub_epi8(max, min);
+            __m128i redMax = _mm_cmpeq_epi8(red, max);
+            __m128i greenMax = _mm_andnot_si128(redMax, _mm_cmpeq_epi8(green, max));
+
+            __m128i hue = _mm_packus_epi16(
+                HsvHue16(UnpackU8<0>(blue), UnpackU8<0>(green), UnpackU8<0>(red), UnpackU8<0>(range), UnpackU8<0>(redMax, redMax), UnpackU8<0>(greenMax, greenMax)),
+                HsvHue16(UnpackU8<1>(blue), UnpackU8<1>(green), UnpackU8<1>(red), UnpackU8<1>(range), UnpackU8<1>(redMax, redMax), UnpackU8<1>(greenMax, greenMax)));
+            hue = _mm_andnot_si128(_mm_cmpeq_epi8(range, K_ZERO), hue);
+            __m128i hueGe = GreaterOrEqual8u(hue, hsv.hueLo);
+            __m128i hueLe = LesserOrEqual8u(hue, hsv.hueHi);
+            __m128i result = hsv.hueWrap ? _mm_or_si128(hueGe, hueLe) : _mm_and_si128(hueGe, hueLe);
+
+            __m128i saturation = _mm_packs_epi16(
+                HsvSaturationInRange16(UnpackU8<0>(max), UnpackU8<0>(range), hsv.satLo, hsv.satHi),
+                HsvSaturationInRange16(UnpackU8<1>(max), UnpackU8<1>(range), hsv.satLo, hsv.satHi));
+            saturation = _mm_blendv_epi8(saturation, hsv.satZero, _mm_cmpeq_epi8(max, K_ZERO));
+            result = _mm_and_si128(result, saturation);
+
+            result = _mm_and_si128(result, _mm_and_si128(GreaterOrEqual8u(max, hsv.valLo), LesserOrEqual8u(max, hsv.valHi)));
+            _mm_storeu_si128((__m128i*)mask, result);
+        }
+
+        void BgrToHsvRangeMask(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, const uint8_t * lo, const uint8_t * hi, uint8_t * mask, size_t maskStride)
+        {
+            assert(width >= A);
+
+            HsvRange hsv(lo, hi);
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    BgrToHsvRangeMask(bgr + 3 * col, hsv, mask + col);
+                if (width != alignedWidth)
+                    BgrToHsvRangeMask(bgr + 3 * (width - A), hsv, mask + width - A);
+                bgr += bgrStride;
+                mask += maskStride;
+            }
+        }
+    }
+#endif
+}
@@ -105,7 +105,21 @@ namespace Simd
                 Load<align>((__m128i*)(buffer.src2 + offset)), Load<align>((__m128i*)(buffer.src3 + offset)))), K16_00FF), K_ZERO);
         }
 
-        template <bool even> void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+        template <bool max> SIMD_INLINE void StoreReduced(uint8_t * dst, __m128i value)
+        {
+            if (max)
+                value = _mm_max_epu8(value, _mm_loadl_epi64((__m128i*)dst));
+            _mm_storel_epi64((__m128i*)dst, value);
+        }
+
+        template <bool max> SIMD_INLINE void StoreReduced(uint8_t * dst, __m128i value, __m128i previous)
+        {
+            if (max)
+                value = _mm_max_epu8(value, previous);
+            _mm_storel_epi64((__m128i*)dst, value);
+        }
+
+        template <bool even, bool max> void ReduceGray4x4(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
         {
             assert((srcWidth + 1) / 2 == dstWidth && (srcHeight + 1) / 2 == dstHeight && srcWidth > A);
@@ -150,11 +164,13 @@ namespace Simd
                 Store<false>((__m128i*)(buffer.src2 + dstWidth - HA), ReduceColTail<even>(src2 + srcTail));
                 Store<false>((__m128i*)(buffer.src3 + dstWidth - HA), ReduceColTail<even>(src3 + srcTail));
 
+                // The tail overlaps the body: it is merged with the values of dst saved before the body was stored.
+                __m128i tail = _mm_loadl_epi64((__m128i*)(dst + dstWidth - HA));
                 for (size_t col = 0; col < alignedDstWidth; col += HA)
-                    _mm_storel_epi64((__m128i*)(dst + col), ReduceRow<true>(buffer, col));
+                    StoreReduced<max>(dst + col, ReduceRow<true>(buffer, col));
 
                 if (alignedDstWidth != dstWidth)
-                    _mm_storel_epi64((__m128i*)(dst + dstWidth - HA), ReduceRow<false>(buffer, dstWidth - HA));
+                    StoreReduced<max>(dst + dstWidth - HA, ReduceRow<false>(buffer, dstWidth - HA), tail);
 
                 Swap(buffer.src0, buffer.src2);
                 Swap(buffer.src1, buffer.src3);
@@ -165,9 +181,18 @@ namespace Simd
             uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
         {
             if (Aligned(srcWidth, 2))
-                ReduceGray4x4<true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ReduceGray4x4<true, false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+            else
+                ReduceGray4x4<false, false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+        }
+
+        void ReduceGray4x4Max(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            if (Aligned(srcWidth, 2))
+                ReduceGray4x4<true, true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
             else
-                ReduceGray4x4<false>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                ReduceGray4x4<false, true>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
         }
     }
 #endif
@@ -135,6 +135,61 @@ namespace Simd
 
         //-----------------------------------------------------------------------------------------
 
+        SIMD_INLINE void SquaredDifferenceSum(const __m128i & a, const uint8_t * b, __m128i & sum)
+        {
+            sum = _mm_add_epi32(sum, SquaredDifference(a, Load<false>((__m128i*)b)));
+        }
+
+        SIMD_INLINE void SquaredDifferenceSum(const __m128i & a, const uint8_t * b, const __m128i & mask, __m128i & sum)
+        {
+            sum = _mm_add_epi32(sum, SquaredDifference(a, _mm_and_si128(mask, Load<false>((__m128i*)b))));
+        }
+
+        void SquaredDifferenceSums8u(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums)
+        {
+            assert(size >= A && size <= 0x10000);
+
+            size_t sizeA = AlignLo(size, A), count4 = AlignLo(count, 4), i = 0;
+            __m128i tailMask = ShiftLeft(K_INV_ZERO, A - size + sizeA);
+            for (; i < count4; i += 4, b += 4 * size)
+            {
+                const uint8_t * b0 = b, * b1 = b0 + size, * b2 = b1 + size, * b3 = b2 + size;
+                __m128i s0 = _mm_setzero_si128(), s1 = _mm_setzero_si128(), s2 = _mm_setzero_si128(), s3 = _mm_setzero_si128();
+                for (size_t j = 0; j < sizeA; j += A)
+                {
+                    __m128i _a = Load<false>((__m128i*)(a + j));
+                    SquaredDifferenceSum(_a, b0 + j, s0);
+                    SquaredDifferenceSum(_a, b1 + j, s1);
+                    SquaredDifferenceSum(_a, b2 + j, s2);
+                    SquaredDifferenceSum(_a, b3 + j, s3);
+                }
+                if (sizeA < size)
+                {
+                    size_t j = size - A;
+                    __m128i _a = _mm_and_si128(tailMask, Load<false>((__m128i*)(a + j)));
+                    SquaredDifferenceSum(_a, b0 + j, tailMask, s0);
+                    SquaredDifferenceSum(_a, b1 + j, tailMask, s1);
+                    SquaredDifferenceSum(_a, b2 + j, tailMask, s2);
+                    SquaredDifferenceSum(_a, b3 + j, tailMask, s3);
+                }
+                _mm_storeu_si128((__m128i*)(sums + i), _mm_hadd_epi32(_mm_hadd_epi32(s0, s1), _mm_hadd_epi32(s2, s3)));
+            }
+            for (; i < count; i += 1, b += size)
+            {
+                __m128i s0 = _mm_setzero_si128();
+                for (size_t j = 0; j < sizeA; j += A)
+                    SquaredDifferenceSum(Load<false>((__m128i*)(a + j)), b + j, s0);
+                if (sizeA < size)
+                {
+                    size_t j = size - A;
+                    SquaredDifferenceSum(_mm_and_si128(tailMask, Load<false>((__m128i*)(a + j))), b + j, tailMask, s0);
+                }
+                sums[i] = (uint32_t)ExtractInt32Sum(s0);
+            }
+        }
+
+        //-----------------------------------------------------------------------------------------
+
         template <bool align> SIMD_INLINE void SquaredDifferenceSum32f(const float* a, const float* b, size_t offset, __m128& sum)
         {
             __m128 _a = Load<align>(a + offset);
@@ -31,6 +31,7 @@
 #include "Simd/SimdExp.h"
 #include "Simd/SimdGather.h"
 #include "Simd/SimdPow.h"
+#include "Simd/SimdSynetSoftmax32f.h"
 
 namespace Simd
 {
@@ -967,6 +968,21 @@ namespace Simd
             else
                 SynetUnaryOperation32fLayerForward<false>(src, size, type, dst);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetSoftmax32f::SynetSoftmax32f(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+            : Base::SynetSoftmax32f(outer, count, inner, format)
+        {
+            _softmax = Sse41::SynetSoftmaxLayerForward;
+        }
+
+        void* SynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+        {
+            if (outer == 0 || count == 0 || inner == 0 || Base::SynetSoftmax32fBlock(count, format) == 0)
+                return NULL;
+            return new SynetSoftmax32f(outer, count, inner, format);
+        }
    }
 #endif
 }
@@ -0,0 +1,111 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdSynet.h"
+#include "Simd/SimdExp.h"
+#include "Simd/SimdSse41.h"
+
+namespace Simd
+{
+#if defined(SIMD_SSE41_ENABLE) && defined(SIMD_SYNET_ENABLE)   
+    namespace Sse41
+    {
+        void SynetDetectionDecode32f(const float* loc, const float* anchor, const float* variance, size_t count, float* box)
+        {
+            size_t count4 = AlignLo(count, 4), i = 0;
+            __m128 v0 = _mm_set1_ps(variance[0]), v1 = _mm_set1_ps(variance[1]);
+            __m128 v2 = _mm_set1_ps(variance[2]), v3 = _mm_set1_ps(variance[3]);
+            __m128 half = _mm_set1_ps(0.5f);
+            for (; i < count4; i += 4, loc += 16, anchor += 16, box += 16)
+            {
+                __m128 l0 = _mm_loadu_ps(loc + 0), l1 = _mm_loadu_ps(loc + 4), l2 = _mm_loadu_ps(loc + 8), l3 = _mm_loadu_ps(loc + 12);
+                _MM_TRANSPOSE4_PS(l0, l1, l2, l3);
+                __m128 a0 = _mm_loadu_ps(anchor + 0), a1 = _mm_loadu_ps(anchor + 4), a2 = _mm_loadu_ps(anchor + 8), a3 = _mm_loadu_ps(anchor + 12);
+                _MM_TRANSPOSE4_PS(a0, a1, a2, a3);
+                __m128 aw = _mm_sub_ps(a2, a0), ah = _mm_sub_ps(a3, a1);
+                __m128 cx = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(v0, l0), aw), _mm_mul_ps(_mm_add_ps(a0, a2), half));
+                __m128 cy = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(v1, l1), ah), _mm_mul_ps(_mm_add_ps(a1, a3), half));
+                __m128 hw = _mm_mul_ps(_mm_mul_ps(Exponent(_mm_mul_ps(v2, l2)), aw), half);
+                __m128 hh = _mm_mul_ps(_mm_mul_ps(Exponent(_mm_mul_ps(v3, l3)), ah), half);
+                __m128 b0 = _mm_sub_ps(cx, hw), b1 = _mm_sub_ps(cy, hh), b2 = _mm_add_ps(cx, hw), b3 = _mm_add_ps(cy, hh);
+                _MM_TRANSPOSE4_PS(b0, b1, b2, b3);
+                _mm_storeu_ps(box + 0, b0);
+                _mm_storeu_ps(box + 4, b1);
+                _mm_storeu_ps(box + 8, b2);
+                _mm_storeu_ps(box + 12, b3);
+            }
+            for (; i < count; ++i, loc += 4, anchor += 4, box += 4)
+                Base::SynetDetectionDecodeBox(loc, anchor, variance, box);
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        size_t SynetDetectionFilter32f(const float* score, size_t size, float threshold, uint32_t* index)
+        {
+            size_t size16 = AlignLo(size, 16), i = 0, count = 0;
+            __m128 _threshold = _mm_set1_ps(threshold);
+            for (; i < size16; i += 16)
+            {
+                int mask = _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(score + i + 0), _threshold)) << 0;
+                mask |= _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(score + i + 4), _threshold)) << 4;
+                mask |= _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(score + i + 8), _threshold)) << 8;
+                mask |= _mm_movemask_ps(_mm_cmpgt_ps(_mm_loadu_ps(score + i + 12), _threshold)) << 12;
+                for (size_t j = 0; mask; ++j, mask >>= 1)
+                    if (mask & 1)
+                        index[count++] = uint32_t(i + j);
+            }
+            for (; i < size; ++i)
+                if (score[i] > threshold)
+                    index[count++] = (uint32_t)i;
+            return count;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        static bool Overlapped(const float* box, float area, float label, float threshold, const float* kept, size_t stride, size_t size)
+        {
+            size_t size4 = AlignLo(size, 4), i = 0;
+            __m128 x0 = _mm_set1_ps(box[0]), y0 = _mm_set1_ps(box[1]), x1 = _mm_set1_ps(box[2]), y1 = _mm_set1_ps(box[3]);
+            __m128 _area = _mm_set1_ps(area), _label = _mm_set1_ps(label), _threshold = _mm_set1_ps(threshold), zero = _mm_setzero_ps();
+            for (; i < size4; i += 4)
+            {
+                __m128 w = _mm_max_ps(_mm_sub_ps(_mm_min_ps(x1, _mm_loadu_ps(kept + 2 * stride + i)), _mm_max_ps(x0, _mm_loadu_ps(kept + 0 * stride + i))), zero);
+                __m128 h = _mm_max_ps(_mm_sub_ps(_mm_min_ps(y1, _mm_loadu_ps(kept + 3 * stride + i)), _mm_max_ps(y0, _mm_loadu_ps(kept + 1 * stride + i))), zero);
+                __m128 inter = _mm_mul_ps(w, h);
+                __m128 _union = _mm_sub_ps(_mm_add_ps(_area, _mm_loadu_ps(kept + 4 * stride + i)), inter);
+                __m128 overlapped = _mm_cmpgt_ps(inter, _mm_mul_ps(_threshold, _union));
+                __m128 same = _mm_cmpeq_ps(_label, _mm_loadu_ps(kept + 5 * stride + i));
+                if (_mm_movemask_ps(_mm_and_ps(overlapped, same)))
+                    return true;
+            }
+            return Base::SynetDetectionOverlapped(box, area, label, threshold, kept, stride, i, size);
+        }
+
+        size_t SynetDetectionNms32f(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index)
+        {
+            return Base::SynetDetectionNms32fCommon(box, score, label, count, threshold, topK, index, Overlapped);
+        }
+    }
+#endif
+}
@@ -28,6 +28,7 @@
 #include "Simd/SimdSynet.h"
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse41.h"
+#include "Simd/SimdSynetPooling32f.h"
 
 namespace Simd
 {
@@ -775,6 +776,26 @@ namespace Simd
             else
                 assert(0);
         }
+
+        //-------------------------------------------------------------------------------------------------
+
+        SynetPooling32f::SynetPooling32f(const Base::Pooling32fParam& param)
+            : Base::SynetPooling32f(param)
+        {
+            _poolingMax = Sse41::SynetPoolingMax32f;
+            _poolingAverage = Sse41::SynetPoolingAverage;
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX,
+            size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format)
+        {
+            Base::Pooling32fParam param(batch, channels, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dstH, dstW, method, excludePad, format);
+            if (!param.Valid())
+                return NULL;
+            return new SynetPooling32f(param);
+        }
     }
 #endif// SIMD_SSE41_ENABLE
 }
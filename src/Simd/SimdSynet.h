@@ -220,6 +220,11 @@ namespace Simd
             return Simd::Max(0.0f, src * scale + bias);
         }
 
+        SIMD_INLINE float SynetGelu32f(float value)
+        {
+            return value * 0.5f * (1.0f + ::erf(value * 0.70710678f));
+        }
+
         SIMD_INLINE float SynetHardSigmoid32f(float value, float scale, float shift)
         {
             return Simd::Max(0.0f, Simd::Min(value * scale + shift, 1.0f));
@@ -310,6 +315,47 @@ namespace Simd
         {
             return int32_t(value) | (int32_t(value) << 8) | (int32_t(value) << 16) | (int32_t(value) << 24);
         }
+
+        //---------------------------------------------------------------------
+
+        SIMD_INLINE void SynetDetectionDecodeBox(const float* loc, const float* anchor, const float* variance, float* box)
+        {
+            float aw = anchor[2] - anchor[0], ah = anchor[3] - anchor[1];
+            float ax = (anchor[0] + anchor[2]) * 0.5f, ay = (anchor[1] + anchor[3]) * 0.5f;
+            float cx = variance[0] * loc[0] * aw + ax;
+            float cy = variance[1] * loc[1] * ah + ay;
+            float hw = ::exp(variance[2] * loc[2]) * aw * 0.5f;
+            float hh = ::exp(variance[3] * loc[3]) * ah * 0.5f;
+            box[0] = cx - hw;
+            box[1] = cy - hh;
+            box[2] = cx + hw;
+            box[3] = cy + hh;
+        }
+
+        SIMD_INLINE float SynetDetectionArea(const float* box)
+        {
+            return Simd::Max(box[2] - box[0], 0.0f) * Simd::Max(box[3] - box[1], 0.0f);
+        }
+
+        SIMD_INLINE bool SynetDetectionOverlapped(const float* box, float area, float label, float threshold, const float* kept, size_t stride, size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (kept[5 * stride + i] != label)
+                    continue;
+                float w = Simd::Max(Simd::Min(box[2], kept[2 * stride + i]) - Simd::Max(box[0], kept[0 * stride + i]), 0.0f);
+                float h = Simd::Max(Simd::Min(box[3], kept[3 * stride + i]) - Simd::Max(box[1], kept[1 * stride + i]), 0.0f);
+                float inter = w * h;
+                if (inter > threshold * (area + kept[4 * stride + i] - inter))
+                    return true;
+            }
+            return false;
+        }
+
+        typedef bool (*SynetDetectionOverlappedPtr)(const float* box, float area, float label, float threshold, const float* kept, size_t stride, size_t size);
+
+        size_t SynetDetectionNms32fCommon(const float* box, const float* score, const int32_t* label, size_t count, 
+            float threshold, size_t topK, uint32_t* index, SynetDetectionOverlappedPtr overlapped);
     }
 
 #ifdef SIMD_SSE41_ENABLE
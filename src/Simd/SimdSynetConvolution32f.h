@@ -746,6 +746,8 @@ namespace Simd
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
+        void ConvolutionBiasAndActivation(const float* bias, size_t count, size_t size, ::SimdConvolutionActivationType activation, const float* params, ::SimdBool trans, float* dst);
+
         void NhwcRun(size_t M, size_t N, size_t K, const float * A, const float * B, float * C);
         void NhwcReorderB(size_t M, size_t N, size_t K, const float * B, float * pB);
         size_t NhwcBufferSize(size_t M, size_t N, size_t K);
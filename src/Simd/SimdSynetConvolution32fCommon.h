@@ -92,6 +92,11 @@ namespace Simd
             return SynetSwish32f(value, params[0]);
         }
 
+        template<> SIMD_INLINE float Activate<SimdConvolutionActivationGelu>(float value, const float* params, size_t offset)
+        {
+            return SynetGelu32f(value);
+        }
+
         template<SimdConvolutionActivationType type> void DepthwiseConvolution(const float* src, const SimdConvolutionParameters& p,
             size_t maC, size_t yBeg, size_t yEnd, const size_t bufH[2], const float* weight, const float* bias, const float* params, float* dst, int first)
         {
@@ -185,6 +190,11 @@ namespace Simd
             return Swish(value, _mm_set1_ps(params[0]));
         }
 
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationGelu>(__m128 value, const float* params, size_t offset)
+        {
+            return Gelu(value);
+        }
+
         //---------------------------------------------------------------------
 
         template<::SimdConvolutionActivationType type> SIMD_INLINE __m128 Activate(__m128 value, const __m128 * params, size_t index);
@@ -239,6 +249,11 @@ namespace Simd
             return Swish(value, params[0]);
         }
 
+        template<> SIMD_INLINE __m128 Activate<::SimdConvolutionActivationGelu>(__m128 value, const __m128* params, size_t index)
+        {
+            return Gelu(value);
+        }
+
         //---------------------------------------------------------------------
 
         template <TermType term> struct Term
@@ -490,6 +505,11 @@ namespace Simd
             return Avx2::Swish(value, _mm256_set1_ps(params[0]));
         }
 
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGelu>(__m256 value, const float* params, size_t offset)
+        {
+            return Avx2::Gelu(value);
+        }
+
         //---------------------------------------------------------------------
 
         template<::SimdConvolutionActivationType type> SIMD_INLINE __m256 Activate(__m256 value, const __m256 * params, size_t index);
@@ -544,6 +564,11 @@ namespace Simd
             return Avx2::Swish(value, params[0]);
         }
 
+        template<> SIMD_INLINE __m256 Activate<::SimdConvolutionActivationGelu>(__m256 value, const __m256* params, size_t index)
+        {
+            return Avx2::Gelu(value);
+        }
+
         //---------------------------------------------------------------------
 
         template <TermType term> struct Term
@@ -677,6 +702,11 @@ namespace Simd
             return Swish(value, _mm512_set1_ps(params[0]));
         }
 
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGelu>(__m512 value, const float* params, size_t offset, __mmask16 tail)
+        {
+            return Gelu(value);
+        }
+
         //---------------------------------------------------------------------
 
         template<::SimdConvolutionActivationType type> SIMD_INLINE __m512 Activate(__m512 value, const __m512 * params, size_t index);
@@ -731,6 +761,11 @@ namespace Simd
             return Swish(value, params[0]);
         }
 
+        template<> SIMD_INLINE __m512 Activate<::SimdConvolutionActivationGelu>(__m512 value, const __m512* params, size_t index)
+        {
+            return Gelu(value);
+        }
+
         //---------------------------------------------------------------------
 
         template <TermType term> struct Term
@@ -903,6 +938,11 @@ namespace Simd
             return Neon::Swish<1>(value, params[0]);
         }
 
+        template<> SIMD_INLINE float32x4_t Activate<::SimdConvolutionActivationGelu>(float32x4_t value, const float32x4_t* params, size_t index)
+        {
+            return Neon::Gelu<1>(value);
+        }
+
         template <TermType term> struct Term
         {
             template<SimdConvolutionActivationType type, int index> static SIMD_INLINE void Save(float * ptr, float32x4_t value, const float32x4_t * bias, const float32x4_t * params);
@@ -0,0 +1,438 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetGraph_hpp__
+#define __SimdSynetGraph_hpp__
+
+#include "Simd/SimdLib.hpp"
+
+#include <vector>
+#include <functional>
+#include <algorithm>
+
+namespace Simd
+{
+    /*! @ingroup cpp_synet_graph
+
+        \short SynetGraph structure sequentially executes Synet layers and places all their tensors into one memory arena.
+
+        Layers are added in order of execution. Every layer has input tensors (graph inputs or outputs of previous layers), 
+        one output tensor and optional scratch buffer. Function SynetGraph::Plan performs liveness analysis of all tensors and 
+        places them into single aligned arena so that tensors with non-overlapping lifetimes share the same memory. 
+        Output of a layer marked as in-place reuses memory of its input if the input is not used after this layer.
+        Function SynetGraph::Run does not allocate memory.
+
+        Using example:
+        \verbatim
+        #include "Simd/SimdSynetGraph.hpp"
+
+        void Infer(void * conv, void * pool, void * softmax, size_t srcSize, size_t convSize, size_t poolSize)
+        {
+            typedef Simd::SynetGraph<Simd::Allocator> Graph;
+            Graph graph;
+            size_t src = graph.AddInput(srcSize);
+            size_t dst = graph.AddConvolution32f(conv, src, convSize);
+            dst = graph.AddPooling32f(pool, dst, poolSize);
+            dst = graph.AddSoftmax32f(softmax, dst, poolSize, true);
+            graph.MarkOutput(dst);
+            graph.Plan();
+
+            // fill graph.Data(src) with input data...
+            graph.Run();
+            // read output data from graph.Data(dst)...
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct SynetGraph
+    {
+        typedef A<uint8_t> Allocator; /*!< Allocator type definition. */
+        typedef std::vector<size_t> Ids; /*!< Vector of tensor identifiers. */
+
+        /*!
+            Layer forward function type. It gets pointers to input tensors, scratch buffer (can be NULL) and output tensor.
+        */
+        typedef std::function<void(const float* const* src, float* buf, float* dst)> Forward;
+
+        /*!
+            Creates a new empty SynetGraph structure.
+        */
+        SynetGraph()
+            : _arena(NULL)
+            , _arenaSize(0)
+            , _plan(false)
+        {
+        }
+
+        /*!
+            A SynetGraph destructor. It frees memory arena. Layer contexts are not released.
+        */
+        ~SynetGraph()
+        {
+            if (_arena)
+                Allocator::Free(_arena);
+        }
+
+        /*!
+            Adds input tensor of the graph. Its memory is not reused by other tensors, so the graph can be run several times with the same input.
+
+            \param [in] size - a size of tensor (in 32-bit floats).
+            \return identifier of the tensor.
+        */
+        size_t AddInput(size_t size)
+        {
+            return AddTensor(size, -1, true);
+        }
+
+        /*!
+            Adds a layer to the graph.
+
+            \param [in] forward - a forward function of the layer.
+            \param [in] src - identifiers of input tensors of the layer.
+            \param [in] dstSize - a size of output tensor of the layer (in 32-bit floats).
+            \param [in] bufSize - a size of scratch buffer of the layer (in 32-bit floats). It can be 0.
+            \param [in] inplace - a flag that the layer can write its output over the memory of the first input tensor.
+            \return identifier of output tensor of the layer.
+        */
+        size_t AddLayer(const Forward & forward, const Ids & src, size_t dstSize, size_t bufSize = 0, bool inplace = false)
+        {
+            Layer layer;
+            layer.forward = forward;
+            layer.src = src;
+            layer.dst = AddTensor(dstSize, (ptrdiff_t)_layers.size(), false);
+            layer.buf = bufSize ? AddTensor(bufSize, (ptrdiff_t)_layers.size(), false) : -1;
+            layer.inplace = inplace;
+            _layers.push_back(layer);
+            _plan = false;
+            return layer.dst;
+        }
+
+        /*!
+            Adds FP32 convolution layer (see ::SimdSynetConvolution32fInit).
+
+            \param [in] context - a pointer to FP32 convolution context. It is not released by the graph.
+            \param [in] src - identifier of input tensor.
+            \param [in] dstSize - a size of output tensor (in 32-bit floats).
+            \return identifier of output tensor of the layer.
+        */
+        size_t AddConvolution32f(void * context, size_t src, size_t dstSize)
+        {
+            return AddLayer([context](const float* const* s, float* b, float* d) { SimdSynetConvolution32fForward(context, s[0], b, d); },
+                Ids(1, src), dstSize, SimdSynetConvolution32fExternalBufferSize(context));
+        }
+
+        /*!
+            Adds FP32 merged convolution layer (see ::SimdSynetMergedConvolution32fInit).
+
+            \param [in] context - a pointer to FP32 merged convolution context. It is not released by the graph.
+            \param [in] src - identifier of input tensor.
+            \param [in] dstSize - a size of output tensor (in 32-bit floats).
+            \return identifier of output tensor of the layer.
+        */
+        size_t AddMergedConvolution32f(void * context, size_t src, size_t dstSize)
+        {
+            return AddLayer([context](const float* const* s, float* b, float* d) { SimdSynetMergedConvolution32fForward(context, s[0], b, d); },
+                Ids(1, src), dstSize, SimdSynetMergedConvolution32fExternalBufferSize(context));
+        }
+
+        /*!
+            Adds FP32 deconvolution layer (see ::SimdSynetDeconvolution32fInit).
+
+            \param [in] context - a pointer to FP32 deconvolution context. It is not released by the graph.
+            \param [in] src - identifier of input tensor.
+            \param [in] dstSize - a size of output tensor (in 32-bit floats).
+            \return identifier of output tensor of the layer.
+        */
+        size_t AddDeconvolution32f(void * context, size_t src, size_t dstSize)
+        {
+            return AddLayer([context](const float* const* s, float* b, float* d) { SimdSynetDeconvolution32fForward(context, s[0], b, d); },
+                Ids(1, src), dstSize, SimdSynetDeconvolution32fExternalBufferSize(context));
+        }
+
+        /*!
+            Adds FP32 inner product layer (see ::SimdSynetInnerProduct32fInit).
+
+            \param [in] context - a pointer to FP32 inner product context. It is not released by the graph.
+            \param [in] src - identifier of input tensor.
+            \param [in] dstSize - a size of output tensor (in 32-bit floats).
+            \return identifier of output tensor of the layer.
+        */
+        size_t AddInnerProduct32f(void * context, size_t src, size_t dstSize)
+        {
+            return AddLayer([context](const float* const* s, float* b, float* d) { SimdSynetInnerProduct32fForward(context, s[0], d); },
+                Ids(1, src), dstSize);
+        }
+
+        /*!
+            Adds FP32 pooling layer (see ::SimdSynetPooling32fInit).
+
+            \param [in] context - a pointer to pooling context. It is not released by the graph.
+            \param [in] src - identifier of input tensor.
+            \param [in] dstSize - a size of output tensor (in 32-bit floats).
+            \return identifier of output tensor of the layer.
+        */
+        size_t AddPooling32f(void * context, size_t src, size_t dstSize)
+        {
+            return AddLayer([context](const float* const* s, float* b, float* d) { SimdSynetPooling32fForward(context, s[0], d); },
+                Ids(1, src), dstSize);
+        }
+
+        /*!
+            Adds FP32 softmax layer (see ::SimdSynetSoftmax32fInit).
+
+            \param [in] context - a pointer to softmax context. It is not released by the graph.
+            \param [in] src - identifier of input tensor.
+            \param [in] dstSize - a size of output tensor (in 32-bit floats).
+            \param [in] inplace - a flag of in-place execution.
+            \return identifier of output tensor of the layer.
+        */
+        size_t AddSoftmax32f(void * context, size_t src, size_t dstSize, bool inplace = true)
+        {
+            return AddLayer([context](const float* const* s, float* b, float* d) { SimdSynetSoftmax32fForward(context, s[0], d); },
+                Ids(1, src), dstSize, 0, inplace);
+        }
+
+        /*!
+            Marks the tensor as output of the graph. Its memory is not reused by other tensors.
+
+            \param [in] id - identifier of the tensor.
+        */
+        void MarkOutput(size_t id)
+        {
+            _tensors[id].output = true;
+            _plan = false;
+        }
+
+        /*!
+            Performs liveness analysis of all tensors and allocates the memory arena.
+
+            \return a result of the operation.
+        */
+        bool Plan()
+        {
+            const ptrdiff_t last = (ptrdiff_t)_layers.size();
+            std::vector<ptrdiff_t> end(_tensors.size());
+            for (size_t t = 0; t < _tensors.size(); ++t)
+                end[t] = _tensors[t].output || _tensors[t].input ? last : Max(_tensors[t].begin, ptrdiff_t(0));
+            for (size_t l = 0; l < _layers.size(); ++l)
+                for (size_t s = 0; s < _layers[l].src.size(); ++s)
+                {
+                    if (_layers[l].src[s] >= _tensors.size() || _tensors[_layers[l].src[s]].begin >= (ptrdiff_t)l)
+                        return false;
+                    end[_layers[l].src[s]] = Max(end[_layers[l].src[s]], (ptrdiff_t)l);
+                }
+
+            _storages.clear();
+            for (size_t t = 0; t < _tensors.size(); ++t)
+                _tensors[t].storage = -1;
+            for (size_t t = 0; t < _tensors.size(); ++t)
+            {
+                if (_tensors[t].input)
+                    _tensors[t].storage = AddStorage(_tensors[t].size, -1, end[t]);
+            }
+            for (size_t l = 0; l < _layers.size(); ++l)
+            {
+                const Layer & layer = _layers[l];
+                Tensor & dst = _tensors[layer.dst];
+                if (layer.inplace && layer.src.size())
+                {
+                    const Tensor & src = _tensors[layer.src[0]];
+                    Storage & storage = _storages[src.storage];
+                    if (end[layer.src[0]] == (ptrdiff_t)l && storage.end == (ptrdiff_t)l && !src.input && !src.output && storage.size >= Allocator::Align(dst.size * sizeof(float), Allocator::Alignment()))
+                    {
+                        dst.storage = src.storage;
+                        storage.end = end[layer.dst];
+                    }
+                }
+                if (dst.storage < 0)
+                    dst.storage = AddStorage(dst.size, l, end[layer.dst]);
+                if (layer.buf >= 0)
+                    _tensors[layer.buf].storage = AddStorage(_tensors[layer.buf].size, l, l);
+            }
+
+            std::vector<size_t> order(_storages.size());
+            for (size_t i = 0; i < order.size(); ++i)
+                order[i] = i;
+            std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) { return _storages[a].size > _storages[b].size; });
+            size_t arenaSize = 0;
+            std::vector<size_t> placed;
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                Storage & curr = _storages[order[i]];
+                std::vector<std::pair<size_t, size_t>> busy;
+                for (size_t j = 0; j < placed.size(); ++j)
+                {
+                    const Storage & prev = _storages[placed[j]];
+                    if (prev.begin <= curr.end && curr.begin <= prev.end)
+                        busy.push_back(std::make_pair(prev.offset, prev.offset + prev.size));
+                }
+                std::sort(busy.begin(), busy.end());
+                size_t offset = 0, best = SIZE_MAX, bestGap = SIZE_MAX;
+                for (size_t j = 0; j < busy.size(); ++j)
+                {
+                    if (busy[j].first >= offset + curr.size && busy[j].first - offset < bestGap)
+                    {
+                        best = offset;
+                        bestGap = busy[j].first - offset;
+                    }
+                    offset = Max(offset, busy[j].second);
+                }
+                curr.offset = best == SIZE_MAX ? offset : best;
+                arenaSize = Max(arenaSize, curr.offset + curr.size);
+                placed.push_back(order[i]);
+            }
+
+            if (arenaSize != _arenaSize)
+            {
+                if (_arena)
+                    Allocator::Free(_arena);
+                _arena = arenaSize ? (uint8_t*)Allocator::Allocate(arenaSize, Allocator::Alignment()) : NULL;
+                _arenaSize = arenaSize;
+            }
+            size_t srcMax = 0;
+            for (size_t l = 0; l < _layers.size(); ++l)
+                srcMax = Max(srcMax, _layers[l].src.size());
+            _src.resize(srcMax);
+            _plan = true;
+            return true;
+        }
+
+        /*!
+            Gets size of memory arena (in bytes). It is valid after call of function SynetGraph::Plan.
+
+            \return size of memory arena.
+        */
+        size_t ArenaSize() const
+        {
+            return _arenaSize;
+        }
+
+        /*!
+            Gets total size of all tensors and buffers of the graph (in bytes) in the case of separate allocation of them.
+
+            \return total size of all tensors.
+        */
+        size_t TotalSize() const
+        {
+            size_t total = 0;
+            for (size_t t = 0; t < _tensors.size(); ++t)
+                total += Allocator::Align(_tensors[t].size * sizeof(float), Allocator::Alignment());
+            return total;
+        }
+
+        /*!
+            Gets pointer to tensor data in the memory arena. It is valid after call of function SynetGraph::Plan.
+
+            \param [in] id - identifier of the tensor.
+            \return pointer to tensor data.
+        */
+        float * Data(size_t id)
+        {
+            assert(_plan && id < _tensors.size());
+            return (float*)(_arena + _storages[_tensors[id].storage].offset);
+        }
+
+        /*!
+            Executes all layers of the graph. Function SynetGraph::Plan must be called before.
+        */
+        void Run()
+        {
+            assert(_plan);
+            for (size_t l = 0; l < _layers.size(); ++l)
+            {
+                const Layer & layer = _layers[l];
+                for (size_t s = 0; s < layer.src.size(); ++s)
+                    _src[s] = Data(layer.src[s]);
+                layer.forward(_src.data(), layer.buf >= 0 ? Data(layer.buf) : NULL, Data(layer.dst));
+            }
+        }
+
+    private:
+        struct Tensor
+        {
+            size_t size;
+            ptrdiff_t begin, storage;
+            bool input, output;
+        };
+        typedef std::vector<Tensor> Tensors;
+
+        struct Layer
+        {
+            Forward forward;
+            Ids src;
+            size_t dst;
+            ptrdiff_t buf;
+            bool inplace;
+        };
+        typedef std::vector<Layer> Layers;
+
+        struct Storage
+        {
+            size_t size, offset;
+            ptrdiff_t begin, end;
+        };
+        typedef std::vector<Storage> Storages;
+
+        Tensors _tensors;
+        Layers _layers;
+        Storages _storages;
+        std::vector<const float*> _src;
+        uint8_t * _arena;
+        size_t _arenaSize;
+        bool _plan;
+
+        SynetGraph(const SynetGraph &);
+        SynetGraph & operator = (const SynetGraph &);
+
+        size_t AddTensor(size_t size, ptrdiff_t begin, bool input)
+        {
+            Tensor tensor;
+            tensor.size = size;
+            tensor.begin = begin;
+            tensor.storage = -1;
+            tensor.input = input;
+            tensor.output = false;
+            _tensors.push_back(tensor);
+            _plan = false;
+            return _tensors.size() - 1;
+        }
+
+        ptrdiff_t AddStorage(size_t size, ptrdiff_t begin, ptrdiff_t end)
+        {
+            Storage storage;
+            storage.size = Allocator::Align(size * sizeof(float), Allocator::Alignment());
+            storage.offset = 0;
+            storage.begin = begin;
+            storage.end = end;
+            _storages.push_back(storage);
+            return _storages.size() - 1;
+        }
+
+        template<class T> static SIMD_INLINE T Max(T a, T b)
+        {
+            return a > b ? a : b;
+        }
+    };
+}
+
+#endif//__SimdSynetGraph_hpp__
@@ -230,7 +230,7 @@ namespace Simd
             Array32f _rWeight[3], _rBias[3], _rParams[3];
             const float * _weight[3], * _bias[3], * _params[3];
 
-            size_t _miC, _maC, _yStep[2], _bufH[2], _dp[2], _dw[3];
+            size_t _miC, _maC, _yStep[2], _bufH[2], _dp[2], _dw[3], _batch;
         };
 
         class SynetMergedConvolution32fCdc : public SynetMergedConvolution32f
@@ -295,7 +295,7 @@ namespace Simd
 
             struct AlgParam
             {
-                size_t miC, maC, yStep[3], yStart[3], bufH[3], dp[2], dw[3];
+                size_t miC, maC, yStep[3], yStart[3], bufH[3], dp[2], dw[3], batch;
             };
 
             typedef void(*ConvertPtr)(const float* src, const ConvParam32f& p, size_t yBeg, size_t yEnd, uint16_t* dst, size_t bufH);
@@ -170,7 +170,7 @@ namespace Simd
 
             struct AlgParam
             {
-                size_t miC, maC, yStep[3], yStart[3], bufH[3], dp[2], dw[3], size;
+                size_t miC, maC, yStep[3], yStart[3], bufH[3], dp[2], dw[3], size, batch;
                 int32_t zero, upper;
             };
 
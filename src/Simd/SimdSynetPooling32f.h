@@ -0,0 +1,180 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetPooling32f_h__
+#define __SimdSynetPooling32f_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        struct Pooling32fParam
+        {
+            size_t batch, channels, srcH, srcW, kernelY, kernelX, strideY, strideX, padY, padX, dstH, dstW;
+            SimdSynetPoolingMethodType method;
+            SimdBool excludePad;
+            SimdTensorFormatType format;
+
+            SIMD_INLINE Pooling32fParam(size_t b, size_t c, size_t sh, size_t sw, size_t ky, size_t kx, size_t sy, size_t sx, size_t py, size_t px, 
+                size_t dh, size_t dw, SimdSynetPoolingMethodType m, SimdBool e, SimdTensorFormatType f)
+                : batch(b), channels(c), srcH(sh), srcW(sw), kernelY(ky), kernelX(kx), strideY(sy), strideX(sx), padY(py), padX(px)
+                , dstH(dh), dstW(dw), method(m), excludePad(e), format(f)
+            {
+            }
+
+            SIMD_INLINE bool Valid() const
+            {
+                if (batch == 0 || channels == 0 || srcH == 0 || srcW == 0 || dstH == 0 || dstW == 0)
+                    return false;
+                if (kernelY == 0 || kernelX == 0 || strideY == 0 || strideX == 0 || padY >= kernelY || padX >= kernelX)
+                    return false;
+                if (method != SimdSynetPoolingMethodMax && method != SimdSynetPoolingMethodAverage)
+                    return false;
+                return Block() != 0;
+            }
+
+            SIMD_INLINE size_t Block() const
+            {
+                switch (format)
+                {
+                case SimdTensorFormatNchw: return 1;
+                case SimdTensorFormatNhwc: return channels;
+                case SimdTensorFormatNchw4c: return 4;
+                case SimdTensorFormatNchw8c: return 8;
+                case SimdTensorFormatNchw16c: return 16;
+                default: return 0;
+                }
+            }
+
+            SIMD_INLINE bool IsGlobal() const
+            {
+                return dstH == 1 && dstW == 1 && padY == 0 && padX == 0 && kernelY == srcH && kernelX == srcW;
+            }
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        class SynetPooling32f : public Deletable
+        {
+        public:
+            SynetPooling32f(const Pooling32fParam & param);
+
+            size_t InternalBufferSize() const
+            {
+                return _buffer.RawSize();
+            }
+
+            void Forward(const float* src, float* dst);
+
+            typedef void (*PoolingMaxPtr)(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelC, size_t kernelY, size_t kernelX, 
+                size_t strideC, size_t strideY, size_t strideX, size_t padC, size_t padY, size_t padX, float* dst, size_t dstC, size_t dstH, size_t dstW, SimdTensorFormatType format);
+            typedef void (*PoolingAveragePtr)(const float* src, size_t srcC, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX,
+                size_t strideY, size_t strideX, size_t padY, size_t padX, float* dst, size_t dstH, size_t dstW, SimdBool excludePad, SimdTensorFormatType format);
+
+        protected:
+            void PoolingRows(const float* src, size_t channels, size_t dstY, size_t dstE, SimdTensorFormatType format, float* dst);
+            void PoolingGlobal(const float* src, float* dst);
+
+            Pooling32fParam _param;
+            PoolingMaxPtr _poolingMax;
+            PoolingAveragePtr _poolingAverage;
+            size_t _threads, _block, _count, _tiles;
+            Array32f _buffer;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX,
+            size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetPooling32f : public Base::SynetPooling32f
+        {
+        public:
+            SynetPooling32f(const Base::Pooling32fParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX,
+            size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetPooling32f : public Sse41::SynetPooling32f
+        {
+        public:
+            SynetPooling32f(const Base::Pooling32fParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX,
+            size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class SynetPooling32f : public Avx2::SynetPooling32f
+        {
+        public:
+            SynetPooling32f(const Base::Pooling32fParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX,
+            size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class SynetPooling32f : public Base::SynetPooling32f
+        {
+        public:
+            SynetPooling32f(const Base::Pooling32fParam& param);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetPooling32fInit(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX,
+            size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format);
+    }
+#endif
+}
+
+#endif
@@ -0,0 +1,139 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdSynetSoftmax32f_h__
+#define __SimdSynetSoftmax32f_h__
+
+#include "Simd/SimdMath.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdArray.h"
+
+namespace Simd
+{
+    namespace Base
+    {
+        SIMD_INLINE size_t SynetSoftmax32fBlock(size_t count, SimdTensorFormatType format)
+        {
+            switch (format)
+            {
+            case SimdTensorFormatNchw: return 1;
+            case SimdTensorFormatNhwc: return count;
+            case SimdTensorFormatNchw4c: return 4;
+            case SimdTensorFormatNchw8c: return 8;
+            case SimdTensorFormatNchw16c: return 16;
+            default: return 0;
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
+        class SynetSoftmax32f : public Deletable
+        {
+        public:
+            SynetSoftmax32f(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+
+            size_t InternalBufferSize() const
+            {
+                return _buffer.RawSize();
+            }
+
+            void Forward(const float* src, float* dst);
+
+            typedef void (*SoftmaxPtr)(const float* src, size_t outer, size_t count, size_t inner, float* dst);
+
+        protected:
+            void Gather(const float* src, size_t offset, size_t size, float* dst) const;
+            void Scatter(const float* src, size_t offset, size_t size, float* dst) const;
+
+            size_t _outer, _count, _inner, _blockC, _threads, _block;
+            SoftmaxPtr _softmax;
+            Array32f _buffer;
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+    }
+
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        class SynetSoftmax32f : public Base::SynetSoftmax32f
+        {
+        public:
+            SynetSoftmax32f(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+    }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        class SynetSoftmax32f : public Sse41::SynetSoftmax32f
+        {
+        public:
+            SynetSoftmax32f(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        class SynetSoftmax32f : public Avx2::SynetSoftmax32f
+        {
+        public:
+            SynetSoftmax32f(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+    }
+#endif
+
+#ifdef SIMD_NEON_ENABLE    
+    namespace Neon
+    {
+        class SynetSoftmax32f : public Base::SynetSoftmax32f
+        {
+        public:
+            SynetSoftmax32f(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+        };
+
+        //-------------------------------------------------------------------------------------------------
+
+        void* SynetSoftmax32fInit(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+    }
+#endif
+}
+
+#endif
@@ -28,6 +28,8 @@
 #include "Simd/SimdSet.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdUnpack.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdInterleave.h"
 
 namespace Simd
 {
@@ -307,6 +309,27 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        template <bool align, size_t N> SIMD_INLINE void StoreBgrOrBgra(__m128i b, __m128i g, __m128i r, __m128i a, uint8_t* dst)
+        {
+            if (N == 3)
+            {
+                Store<align>((__m128i*)dst + 0, InterleaveBgr<0>(b, g, r));
+                Store<align>((__m128i*)dst + 1, InterleaveBgr<1>(b, g, r));
+                Store<align>((__m128i*)dst + 2, InterleaveBgr<2>(b, g, r));
+            }
+            else
+            {
+                __m128i bg0 = _mm_unpacklo_epi8(b, g), bg1 = _mm_unpackhi_epi8(b, g);
+                __m128i ra0 = _mm_unpacklo_epi8(r, a), ra1 = _mm_unpackhi_epi8(r, a);
+                Store<align>((__m128i*)dst + 0, _mm_unpacklo_epi16(bg0, ra0));
+                Store<align>((__m128i*)dst + 1, _mm_unpackhi_epi16(bg0, ra0));
+                Store<align>((__m128i*)dst + 2, _mm_unpacklo_epi16(bg1, ra1));
+                Store<align>((__m128i*)dst + 3, _mm_unpackhi_epi16(bg1, ra1));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         template<class T> SIMD_INLINE __m128i BgrToY32(__m128i b16_r16, __m128i g16_1)
         {
             static const __m128i BY_RY = SIMD_MM_SET2_EPI16(T::B_2_Y, T::R_2_Y);
@@ -476,6 +499,29 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        template <bool align, size_t N> SIMD_INLINE void StoreBgrOrBgra(__m256i b, __m256i g, __m256i r, __m256i a, uint8_t* dst)
+        {
+            if (N == 3)
+            {
+                Store<align>((__m256i*)dst + 0, InterleaveBgr<0>(b, g, r));
+                Store<align>((__m256i*)dst + 1, InterleaveBgr<1>(b, g, r));
+                Store<align>((__m256i*)dst + 2, InterleaveBgr<2>(b, g, r));
+            }
+            else
+            {
+                __m256i bg0 = _mm256_unpacklo_epi8(b, g), bg1 = _mm256_unpackhi_epi8(b, g);
+                __m256i ra0 = _mm256_unpacklo_epi8(r, a), ra1 = _mm256_unpackhi_epi8(r, a);
+                __m256i bgra0 = _mm256_unpacklo_epi16(bg0, ra0), bgra1 = _mm256_unpackhi_epi16(bg0, ra0);
+                __m256i bgra2 = _mm256_unpacklo_epi16(bg1, ra1), bgra3 = _mm256_unpackhi_epi16(bg1, ra1);
+                Store<align>((__m256i*)dst + 0, _mm256_permute2x128_si256(bgra0, bgra1, 0x20));
+                Store<align>((__m256i*)dst + 1, _mm256_permute2x128_si256(bgra2, bgra3, 0x20));
+                Store<align>((__m256i*)dst + 2, _mm256_permute2x128_si256(bgra0, bgra1, 0x31));
+                Store<align>((__m256i*)dst + 3, _mm256_permute2x128_si256(bgra2, bgra3, 0x31));
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         template<class T> SIMD_INLINE __m256i BgrToY32(__m256i b16_r16, __m256i g16_1)
         {
             static const __m256i BY_RY = SIMD_MM256_SET2_EPI16(T::B_2_Y, T::R_2_Y);
@@ -657,6 +703,30 @@ namespace Simd
 
         //-------------------------------------------------------------------------------------------------
 
+        template <bool align, bool mask, size_t N> SIMD_INLINE void StoreBgrOrBgra(__m512i b, __m512i g, __m512i r, __m512i a, uint8_t* dst, const __mmask64* tails)
+        {
+            if (N == 3)
+            {
+                Store<align, mask>(dst + 0 * A, InterleaveBgr<0>(b, g, r), tails[0]);
+                Store<align, mask>(dst + 1 * A, InterleaveBgr<1>(b, g, r), tails[1]);
+                Store<align, mask>(dst + 2 * A, InterleaveBgr<2>(b, g, r), tails[2]);
+            }
+            else
+            {
+                b = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, b);
+                g = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, g);
+                r = _mm512_permutexvar_epi32(K32_PERMUTE_FOR_TWO_UNPACK, r);
+                __m512i bg0 = UnpackU8<0>(b, g), bg1 = UnpackU8<1>(b, g);
+                __m512i ra0 = UnpackU8<0>(r, a), ra1 = UnpackU8<1>(r, a);
+                Store<align, mask>(dst + 0 * A, UnpackU16<0>(bg0, ra0), tails[0]);
+                Store<align, mask>(dst + 1 * A, UnpackU16<1>(bg0, ra0), tails[1]);
+                Store<align, mask>(dst + 2 * A, UnpackU16<0>(bg1, ra1), tails[2]);
+                Store<align, mask>(dst + 3 * A, UnpackU16<1>(bg1, ra1), tails[3]);
+            }
+        }
+
+        //-------------------------------------------------------------------------------------------------
+
         template<class T> SIMD_INLINE __m512i BgrToY32(__m512i b16_r16, __m512i g16_1)
         {
             static const __m512i BY_RY = SIMD_MM512_SET2_EPI16(T::B_2_Y, T::R_2_Y);
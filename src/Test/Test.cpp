@@ -72,11 +72,13 @@ namespace Test
     TEST_ADD_GROUP_A0(AbsDifferenceSums3x3Masked);
     TEST_ADD_GROUP_A0(SquaredDifferenceSum);
     TEST_ADD_GROUP_A0(SquaredDifferenceSumMasked);
+    TEST_ADD_GROUP_A0(SquaredDifferenceSums8u);
     TEST_ADD_GROUP_A0(SquaredDifferenceSum32f);
     TEST_ADD_GROUP_A0(SquaredDifferenceKahanSum32f);
     TEST_ADD_GROUP_A0(CosineDistance32f);
 
     TEST_ADD_GROUP_A0(AddFeatureDifference);
+    TEST_ADD_GROUP_A0(FeatureDifferenceSum);
 
     TEST_ADD_GROUP_A0(BgraToBgr);
     TEST_ADD_GROUP_A0(BgraToGray);
@@ -85,8 +87,11 @@ namespace Test
     TEST_ADD_GROUP_A0(BgrToGray);
     TEST_ADD_GROUP_A0(BgrToHsl);
     TEST_ADD_GROUP_A0(BgrToHsv);
+    TEST_ADD_GROUP_A0(BgrToHsvRangeMask);
     TEST_ADD_GROUP_A0(BgrToRgb);
     TEST_ADD_GROUP_A0(GrayToBgr);
+    TEST_ADD_GROUP_A0(HslToBgr);
+    TEST_ADD_GROUP_A0(HsvToBgr);
     TEST_ADD_GROUP_A0(Int16ToGray);
     TEST_ADD_GROUP_A0(RgbToGray);
     TEST_ADD_GROUP_A0(RgbaToGray);
@@ -123,6 +128,7 @@ namespace Test
     TEST_ADD_GROUP_A0(Base64Encode);
 
     TEST_ADD_GROUP_A0(BayerToBgr);
+    TEST_ADD_GROUP_A0(Bayer16ToBgr);
 
     TEST_ADD_GROUP_A0(BayerToBgra);
 
@@ -135,6 +141,15 @@ namespace Test
     TEST_ADD_GROUP_A0(AveragingBinarization);
     TEST_ADD_GROUP_A0(AveragingBinarizationV2);
 
+    TEST_ADD_GROUP_A0(BitMaskPack);
+    TEST_ADD_GROUP_A0(BitMaskUnpack);
+    TEST_ADD_GROUP_A0(BitMaskOperation);
+    TEST_ADD_GROUP_A0(BitMaskNot);
+    TEST_ADD_GROUP_A0(BitMaskCount);
+    TEST_ADD_GROUP_A0(BitMaskBoundingBox);
+    TEST_ADD_GROUP_A0(BitMaskCopy);
+    TEST_ADD_GROUP_A0(BitMaskFill);
+
     TEST_ADD_GROUP_A0(ConditionalCount8u);
     TEST_ADD_GROUP_A0(ConditionalCount16i);
     TEST_ADD_GROUP_A0(ConditionalSum);
@@ -168,6 +183,7 @@ namespace Test
     TEST_ADD_GROUP_A0(AlphaBlending2x);
     TEST_ADD_GROUP_A0(AlphaBlendingBgraToYuv420p);
     TEST_ADD_GROUP_A0(AlphaBlendingUniform);
+    TEST_ADD_GROUP_A0(AlphaComposite);
     TEST_ADD_GROUP_A0(AlphaFilling);
     TEST_ADD_GROUP_A0(AlphaPremultiply);
     TEST_ADD_GROUP_A0(AlphaUnpremultiply);
@@ -180,6 +196,7 @@ namespace Test
     TEST_ADD_GROUP_0S(DrawCircle);
 
     TEST_ADD_GROUP_0S(FontDraw);
+    TEST_ADD_GROUP_0S(OverlayDraw);
 
     TEST_ADD_GROUP_A0(EdgeBackgroundGrowRangeSlow);
     TEST_ADD_GROUP_A0(EdgeBackgroundGrowRangeFast);
@@ -253,10 +270,12 @@ namespace Test
     TEST_ADD_GROUP_A0(HogLiteFilterSeparable);
     TEST_ADD_GROUP_A0(HogLiteFindMax7x7);
     TEST_ADD_GROUP_A0(HogLiteCreateMask);
+    TEST_ADD_GROUP_0S(HogPyramid);
 
     TEST_ADD_GROUP_0S(ImageMatcher);
 
     TEST_ADD_GROUP_A0(Integral);
+    TEST_ADD_GROUP_A0(IntegralParallel);
 
     TEST_ADD_GROUP_A0(InterferenceIncrement);
     TEST_ADD_GROUP_A0(InterferenceIncrementMasked);
@@ -268,6 +287,8 @@ namespace Test
     TEST_ADD_GROUP_A0(InterleaveBgra);
 
     TEST_ADD_GROUP_0S(Motion);
+    TEST_ADD_GROUP_0S(MotionMultiDetector);
+    TEST_ADD_GROUP_0S(FrameContext);
 
     TEST_ADD_GROUP_A0(NeuralConvert);
     TEST_ADD_GROUP_A0(NeuralProductSum);
@@ -303,6 +324,15 @@ namespace Test
     TEST_ADD_GROUP_A0(NeuralAddConvolution5x5Sum);
     TEST_ADD_GROUP_A0(NeuralConvolutionForward);
 
+    TEST_ADD_GROUP_A0(Nv12ToBgr);
+    TEST_ADD_GROUP_A0(Nv12ToBgra);
+    TEST_ADD_GROUP_A0(Nv12ToRgb);
+    TEST_ADD_GROUP_A0(Nv12ToRgba);
+
+    TEST_ADD_GROUP_A0(P010ToBgr);
+    TEST_ADD_GROUP_A0(P010ToBgra);
+    TEST_ADD_GROUP_A0(P010ToPlanar32f);
+
     TEST_ADD_GROUP_A0(OperationBinary8u);
     TEST_ADD_GROUP_A0(OperationBinary16i);
     TEST_ADD_GROUP_A0(VectorProduct);
@@ -311,6 +341,7 @@ namespace Test
     TEST_ADD_GROUP_A0(ReduceGray2x2);
     TEST_ADD_GROUP_A0(ReduceGray3x3);
     TEST_ADD_GROUP_A0(ReduceGray4x4);
+    TEST_ADD_GROUP_A0(ReduceGray4x4Max);
     TEST_ADD_GROUP_A0(ReduceGray5x5);
 
     TEST_ADD_GROUP_A0(Reorder16bit);
@@ -320,6 +351,7 @@ namespace Test
     TEST_ADD_GROUP_AS(ResizeBilinear);
     TEST_ADD_GROUP_A0(Resizer);
     TEST_ADD_GROUP_0S(ResizeYuv420p);
+    TEST_ADD_GROUP_A0(Yuv420pResizer);
 
     TEST_ADD_GROUP_A0(SegmentationShrinkRegion);
     TEST_ADD_GROUP_A0(SegmentationFillSingleHoles);
@@ -328,6 +360,7 @@ namespace Test
 
     TEST_ADD_GROUP_A0(ShiftBilinear);
     TEST_ADD_GROUP_0S(ShiftDetectorRand);
+    TEST_ADD_GROUP_0S(ShiftDetectorBatch);
     TEST_ADD_GROUP_0S(ShiftDetectorFile);
 
     TEST_ADD_GROUP_A0(GetStatistic);
@@ -357,9 +390,11 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetLrnLayerCrossChannels);
     TEST_ADD_GROUP_A0(SynetShuffleLayerForward);
     TEST_ADD_GROUP_A0(SynetSoftmaxLayerForward);
+    TEST_ADD_GROUP_A0(SynetSoftmax32f);
     TEST_ADD_GROUP_A0(SynetUnaryOperation32fLayerForward);
 
     TEST_ADD_GROUP_A0(SynetElu32f);
+    TEST_ADD_GROUP_A0(SynetGelu32f);
     TEST_ADD_GROUP_A0(SynetHardSigmoid32f);
     TEST_ADD_GROUP_A0(SynetHswish32f);
     TEST_ADD_GROUP_A0(SynetMish32f);
@@ -383,6 +418,12 @@ namespace Test
 
     TEST_ADD_GROUP_A0(SynetDeconvolution32fForward);
 
+    TEST_ADD_GROUP_A0(SynetDetectionDecode32f);
+    TEST_ADD_GROUP_A0(SynetDetectionFilter32f);
+    TEST_ADD_GROUP_A0(SynetDetectionNms32f);
+
+    TEST_ADD_GROUP_A0(SynetGraph);
+
     TEST_ADD_GROUP_A0(SynetFusedLayerForward0);
     TEST_ADD_GROUP_A0(SynetFusedLayerForward1);
     TEST_ADD_GROUP_A0(SynetFusedLayerForward2);
@@ -400,12 +441,15 @@ namespace Test
     TEST_ADD_GROUP_A0(SynetMergedConvolution32fForward);
 
     TEST_ADD_GROUP_A0(SynetNormalizeLayerForward);
+    TEST_ADD_GROUP_A0(SynetNormalizeLayerForwardV2);
+    TEST_ADD_GROUP_A0(SynetNormalizeLayerForwardV3);
 
     TEST_ADD_GROUP_A0(SynetPermute);
 
     TEST_ADD_GROUP_A0(SynetPoolingAverage);
     TEST_ADD_GROUP_A0(SynetPoolingMax32f);
     TEST_ADD_GROUP_A0(SynetPoolingMax8u);
+    TEST_ADD_GROUP_A0(SynetPooling32f);
 
     TEST_ADD_GROUP_A0(SynetScaleLayerForward);
     TEST_ADD_GROUP_A0(SynetScale8iForward);
@@ -417,6 +461,7 @@ namespace Test
     TEST_ADD_GROUP_A0(TexturePerformCompensation);
 
     TEST_ADD_GROUP_A0(TransformImage);
+    TEST_ADD_GROUP_A0(ParallelRows);
 
     TEST_ADD_GROUP_A0(Uyvy422ToBgr);
 
@@ -459,6 +504,9 @@ namespace Test
 
     TEST_ADD_GROUP_A0(Yuv444pToBgr);
     TEST_ADD_GROUP_A0(Yuv422pToBgr);
+    TEST_ADD_GROUP_A0(Yuv420p16ToBgr);
+    TEST_ADD_GROUP_A0(Yuv420p16ToBgra);
+
     TEST_ADD_GROUP_AS(Yuv420pToBgr);
     TEST_ADD_GROUP_A0(Yuv444pToHsl);
     TEST_ADD_GROUP_A0(Yuv444pToHsv);
@@ -126,4 +126,111 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncFDS
+        {
+            typedef void(*FuncPtr)(const uint8_t * const * value, const uint8_t * const * lo, const uint8_t * const * hi, size_t stride,
+                const uint16_t * weight, size_t count, size_t width, size_t height, const uint8_t * mask, size_t maskStride,
+                uint8_t * difference, size_t differenceStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncFDS(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const Views & values, const uint16_t * weight, size_t count, const View & mask, View & difference) const
+            {
+                const uint8_t * value[3], * lo[3], * hi[3];
+                for (size_t i = 0; i < count; ++i)
+                {
+                    value[i] = values[3 * i + 0].data;
+                    lo[i] = values[3 * i + 1].data;
+                    hi[i] = values[3 * i + 2].data;
+                }
+                TEST_PERFORMANCE_TEST(description);
+                func(value, lo, hi, values[0].stride, weight, count, difference.width, difference.height,
+                    mask.data, mask.stride, difference.data, difference.stride);
+            }
+        };
+    }
+
+#define FUNC_FDS(function) FuncFDS(function, std::string(#function))
+
+    bool FeatureDifferenceSumAutoTest(int width, int height, size_t count, bool masked, const FuncFDS & f1, const FuncFDS & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "] <" << count << ", " << masked << ">.");
+
+        Views values(3 * count);
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            values[i].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            FillRandom(values[i]);
+        }
+        const uint16_t weight[3] = { 256 * 4, 256 * 1, 256 * 17 };
+        View mask;
+        if (masked)
+        {
+            mask.Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            FillRandom(mask);
+        }
+
+        View difference1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View difference2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(values, weight, count, mask, difference1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(values, weight, count, mask, difference2));
+
+        result = result && Compare(difference1, difference2, 0, true, 32, 0);
+
+        return result;
+    }
+
+    bool FeatureDifferenceSumAutoTest(const FuncFDS & f1, const FuncFDS & f2)
+    {
+        bool result = true;
+
+        for (size_t count = 1; count <= 3 && result; count += 2)
+        {
+            result = result && FeatureDifferenceSumAutoTest(W, H, count, true, f1, f2);
+            result = result && FeatureDifferenceSumAutoTest(W + O, H - O, count, false, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool FeatureDifferenceSumAutoTest()
+    {
+        bool result = true;
+
+        result = result && FeatureDifferenceSumAutoTest(FUNC_FDS(Simd::Base::FeatureDifferenceSum), FUNC_FDS(SimdFeatureDifferenceSum));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && FeatureDifferenceSumAutoTest(FUNC_FDS(Simd::Sse41::FeatureDifferenceSum), FUNC_FDS(SimdFeatureDifferenceSum));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && FeatureDifferenceSumAutoTest(FUNC_FDS(Simd::Avx2::FeatureDifferenceSum), FUNC_FDS(SimdFeatureDifferenceSum));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && FeatureDifferenceSumAutoTest(FUNC_FDS(Simd::Avx512bw::FeatureDifferenceSum), FUNC_FDS(SimdFeatureDifferenceSum));
+#endif 
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W >= Simd::Neon::A)
+            result = result && FeatureDifferenceSumAutoTest(FUNC_FDS(Simd::Neon::FeatureDifferenceSum), FUNC_FDS(SimdFeatureDifferenceSum));
+#endif 
+
+        return result;
+    }
 }
@@ -276,6 +276,84 @@ namespace Test
         return result;
     }
 
+    //-----------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncHRM
+        {
+            typedef void(*FuncPtr)(const uint8_t* bgr, size_t width, size_t height, size_t bgrStride, const uint8_t* lo, const uint8_t* hi, uint8_t* mask, size_t maskStride);
+            FuncPtr func;
+            String description;
+
+            FuncHRM(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& bgr, const uint8_t* lo, const uint8_t* hi, View& mask) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(bgr.data, bgr.width, bgr.height, bgr.stride, lo, hi, mask.data, mask.stride);
+            }
+        };
+    }
+
+#define FUNC_HRM(func) FuncHRM(func, #func)
+
+    bool BgrToHsvRangeMaskAutoTest(int width, int height, const uint8_t* lo, const uint8_t* hi, const FuncHRM& f1, const FuncHRM& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] and range ["
+            << int(lo[0]) << "-" << int(hi[0]) << ", " << int(lo[1]) << "-" << int(hi[1]) << ", " << int(lo[2]) << "-" << int(hi[2]) << "].");
+
+        View bgr(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        FillRandom(bgr);
+
+        View mask1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View mask2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(bgr, lo, hi, mask1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(bgr, lo, hi, mask2));
+
+        result = result && Compare(mask1, mask2, 0, true, 64);
+
+        return result;
+    }
+
+    bool BgrToHsvRangeMaskAutoTest(const FuncHRM& f1, const FuncHRM& f2)
+    {
+        bool result = true;
+
+        const uint8_t lo0[3] = { 40, 60, 50 }, hi0[3] = { 120, 255, 230 };
+        const uint8_t lo1[3] = { 230, 0, 20 }, hi1[3] = { 20, 200, 255 };
+
+        result = result && BgrToHsvRangeMaskAutoTest(W, H, lo0, hi0, f1, f2);
+        result = result && BgrToHsvRangeMaskAutoTest(W + O, H - O, lo1, hi1, f1, f2);
+
+        return result;
+    }
+
+    bool BgrToHsvRangeMaskAutoTest()
+    {
+        bool result = true;
+
+        result = result && BgrToHsvRangeMaskAutoTest(FUNC_HRM(Simd::Base::BgrToHsvRangeMask), FUNC_HRM(SimdBgrToHsvRangeMask));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BgrToHsvRangeMaskAutoTest(FUNC_HRM(Simd::Sse41::BgrToHsvRangeMask), FUNC_HRM(SimdBgrToHsvRangeMask));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BgrToHsvRangeMaskAutoTest(FUNC_HRM(Simd::Avx2::BgrToHsvRangeMask), FUNC_HRM(SimdBgrToHsvRangeMask));
+#endif 
+
+        return result;
+    }
+
+    //-----------------------------------------------------------------------------------------
+
     bool BgrToRgbAutoTest()
     {
         bool result = true;
@@ -339,6 +417,44 @@ namespace Test
         return result;
     }
 
+    bool HslToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Base::HslToBgr), FUNC_O(SimdHslToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Sse41::HslToBgr), FUNC_O(SimdHslToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Hsl24, View::Bgr24, FUNC_O(Simd::Avx2::HslToBgr), FUNC_O(SimdHslToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool HsvToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Base::HsvToBgr), FUNC_O(SimdHsvToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Sse41::HsvToBgr), FUNC_O(SimdHsvToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && AnyToAnyAutoTest(View::Hsv24, View::Bgr24, FUNC_O(Simd::Avx2::HsvToBgr), FUNC_O(SimdHsvToBgr));
+#endif 
+
+        return result;
+    }
+
     bool Int16ToGrayAutoTest()
     {
         bool result = true;
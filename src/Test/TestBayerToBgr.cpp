@@ -111,4 +111,104 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct Func16
+        {
+            typedef void(*FuncPtr)(const uint8_t* bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, size_t bitDepth,
+                const float* gains, SimdBayerDemosaicType demosaic, uint8_t* bgr, size_t bgrStride, size_t bgrDepth);
+            FuncPtr func;
+            String description;
+
+            Func16(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdPixelFormatType format, size_t bitDepth, SimdBayerDemosaicType demosaic, size_t bgrDepth)
+            {
+                description = description + "[" + ToString(format - SimdPixelFormatBayerGrbg) + "-" + ToString(bitDepth) + "-" +
+                    (demosaic == SimdBayerDemosaicMalvar ? "M" : "B") + "-" + ToString(bgrDepth) + "]";
+            }
+
+            void Call(const View& src, SimdPixelFormatType format, size_t bitDepth, const float* gains, SimdBayerDemosaicType demosaic, View& dst, size_t bgrDepth) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, format, bitDepth, gains, demosaic, dst.data, dst.stride, bgrDepth);
+            }
+        };
+    }
+
+#define FUNC16(func) Func16(func, #func)
+
+    bool Bayer16ToBgrAutoTest(int width, int height, SimdPixelFormatType format, size_t bitDepth, SimdBayerDemosaicType demosaic, size_t bgrDepth, Func16 f1, Func16 f2)
+    {
+        bool result = true;
+
+        f1.Update(format, bitDepth, demosaic, bgrDepth);
+        f2.Update(format, bitDepth, demosaic, bgrDepth);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View s(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(s, 0, uint16_t((1 << bitDepth) - 1));
+
+        const float gains[3] = { 1.9f, 1.0f, 1.45f };
+
+        View d1, d2;
+        if (bgrDepth == 8)
+        {
+            d1.Recreate(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+            d2.Recreate(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        }
+        else
+        {
+            d1.Recreate(width * 3, height, View::Int16, NULL, TEST_ALIGN(width));
+            d2.Recreate(width * 3, height, View::Int16, NULL, TEST_ALIGN(width));
+        }
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, format, bitDepth, gains, demosaic, d1, bgrDepth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, format, bitDepth, gains, demosaic, d2, bgrDepth));
+
+        result = result && Compare(d1, d2, 0, true, 32);
+
+        return result;
+    }
+
+    bool Bayer16ToBgrAutoTest(const Func16& f1, const Func16& f2)
+    {
+        bool result = true;
+
+        const int w = (W + E) & (~1), h = (H - E) & (~1);
+        for (int format = SimdPixelFormatBayerGrbg; format <= SimdPixelFormatBayerBggr; format++)
+        {
+            SimdPixelFormatType bayerFormat = (SimdPixelFormatType)format;
+            result = result && Bayer16ToBgrAutoTest(W, H, bayerFormat, 12, SimdBayerDemosaicMalvar, 8, f1, f2);
+            result = result && Bayer16ToBgrAutoTest(w, h, bayerFormat, 10, SimdBayerDemosaicBilinear, 8, f1, f2);
+            result = result && Bayer16ToBgrAutoTest(w, h, bayerFormat, 16, SimdBayerDemosaicMalvar, 16, f1, f2);
+            result = result && Bayer16ToBgrAutoTest(W, H, bayerFormat, 8, SimdBayerDemosaicBilinear, 16, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool Bayer16ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Bayer16ToBgrAutoTest(FUNC16(Simd::Base::Bayer16ToBgr), FUNC16(SimdBayer16ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::HA)
+            result = result && Bayer16ToBgrAutoTest(FUNC16(Simd::Sse41::Bayer16ToBgr), FUNC16(SimdBayer16ToBgr));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::HA)
+            result = result && Bayer16ToBgrAutoTest(FUNC16(Simd::Avx2::Bayer16ToBgr), FUNC16(SimdBayer16ToBgr));
+#endif
+
+        return result;
+    }
 }
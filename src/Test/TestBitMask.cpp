@@ -0,0 +1,651 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+namespace Test
+{
+    static void FillRandomBitMask(View & bits, size_t width, size_t height)
+    {
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src, 0, 1);
+        SimdBitMaskPack(src.data, src.stride, width, height, bits.data, bits.stride);
+    }
+
+    static void FillRandomSparseBitMask(View & bits, size_t width, size_t height)
+    {
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        Simd::Fill(src, 0);
+        if (Random(8))
+        {
+            size_t x = Random((int)width), y = Random((int)height);
+            Simd::FillFrame(src, Rect(x, y, x + 1, y + 1), 255);
+            x = Random((int)width), y = Random((int)height);
+            Simd::FillFrame(src, Rect(x, y, x + 1, y + 1), 255);
+        }
+        SimdBitMaskPack(src.data, src.stride, width, height, bits.data, bits.stride);
+    }
+
+    namespace
+    {
+        struct FuncP
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncP(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, size_t width, size_t height, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, width, height, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_P(function) FuncP(function, #function)
+
+    bool BitMaskPackAutoTest(int width, int height, const FuncP & f1, const FuncP & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        int bytes = (width + 7) / 8;
+        View src(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(src, 0, 1);
+
+        View dst1(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        View dst2(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, width, height, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, width, height, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        return result;
+    }
+
+    bool BitMaskPackAutoTest(const FuncP & f1, const FuncP & f2)
+    {
+        bool result = true;
+
+        result = result && BitMaskPackAutoTest(W, H, f1, f2);
+        result = result && BitMaskPackAutoTest(W + O, H - O, f1, f2);
+
+        return result;
+    }
+
+    bool BitMaskPackAutoTest()
+    {
+        bool result = true;
+
+        result = result && BitMaskPackAutoTest(FUNC_P(Simd::Base::BitMaskPack), FUNC_P(SimdBitMaskPack));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BitMaskPackAutoTest(FUNC_P(Simd::Sse41::BitMaskPack), FUNC_P(SimdBitMaskPack));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BitMaskPackAutoTest(FUNC_P(Simd::Avx2::BitMaskPack), FUNC_P(SimdBitMaskPack));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool BitMaskUnpackAutoTest(int width, int height, const FuncP & f1, const FuncP & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        int bytes = (width + 7) / 8;
+        View src(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        FillRandomBitMask(src, width, height);
+
+        View dst1(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, width, height, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, width, height, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        return result;
+    }
+
+    bool BitMaskUnpackAutoTest(const FuncP & f1, const FuncP & f2)
+    {
+        bool result = true;
+
+        result = result && BitMaskUnpackAutoTest(W, H, f1, f2);
+        result = result && BitMaskUnpackAutoTest(W + O, H - O, f1, f2);
+
+        return result;
+    }
+
+    bool BitMaskUnpackAutoTest()
+    {
+        bool result = true;
+
+        result = result && BitMaskUnpackAutoTest(FUNC_P(Simd::Base::BitMaskUnpack), FUNC_P(SimdBitMaskUnpack));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BitMaskUnpackAutoTest(FUNC_P(Simd::Sse41::BitMaskUnpack), FUNC_P(SimdBitMaskUnpack));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BitMaskUnpackAutoTest(FUNC_P(Simd::Avx2::BitMaskUnpack), FUNC_P(SimdBitMaskUnpack));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncO
+        {
+            typedef void(*FuncPtr)(const uint8_t * a, size_t aStride, const uint8_t * b, size_t bStride, 
+                size_t width, size_t height, SimdBitMaskOperationType type, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncO(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Update(SimdBitMaskOperationType type)
+            {
+                const char * names[] = { "And", "Or", "Xor", "AndNot" };
+                description = description + "[" + names[type] + "]";
+            }
+
+            void Call(const View & a, const View & b, size_t width, size_t height, SimdBitMaskOperationType type, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(a.data, a.stride, b.data, b.stride, width, height, type, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_O(function) FuncO(function, #function)
+
+    bool BitMaskOperationAutoTest(int width, int height, SimdBitMaskOperationType type, FuncO f1, FuncO f2)
+    {
+        bool result = true;
+
+        f1.Update(type);
+        f2.Update(type);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        int bytes = (width + 7) / 8;
+        View a(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        FillRandomBitMask(a, width, height);
+        View b(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        FillRandomBitMask(b, width, height);
+
+        View dst1(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        View dst2(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(a, b, width, height, type, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(a, b, width, height, type, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        return result;
+    }
+
+    bool BitMaskOperationAutoTest(const FuncO & f1, const FuncO & f2)
+    {
+        bool result = true;
+
+        for (int type = SimdBitMaskOperationAnd; type <= SimdBitMaskOperationAndNot && result; ++type)
+        {
+            result = result && BitMaskOperationAutoTest(W, H, (SimdBitMaskOperationType)type, f1, f2);
+            result = result && BitMaskOperationAutoTest(W + O, H - O, (SimdBitMaskOperationType)type, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool BitMaskOperationAutoTest()
+    {
+        bool result = true;
+
+        result = result && BitMaskOperationAutoTest(FUNC_O(Simd::Base::BitMaskOperation), FUNC_O(SimdBitMaskOperation));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && BitMaskOperationAutoTest(FUNC_O(Simd::Sse41::BitMaskOperation), FUNC_O(SimdBitMaskOperation));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BitMaskOperationAutoTest(FUNC_O(Simd::Avx2::BitMaskOperation), FUNC_O(SimdBitMaskOperation));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    bool BitMaskNotAutoTest(int width, int height, const FuncP & f1, const FuncP & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        int bytes = (width + 7) / 8;
+        View src(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        FillRandomBitMask(src, width, height);
+
+        View dst1(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        View dst2(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, width, height, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, width, height, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        return result;
+    }
+
+    bool BitMaskNotAutoTest(const FuncP & f1, const FuncP & f2)
+    {
+        bool result = true;
+
+        result = result && BitMaskNotAutoTest(W, H, f1, f2);
+        result = result && BitMaskNotAutoTest(W + O, H - O, f1, f2);
+
+        return result;
+    }
+
+    bool BitMaskNotAutoTest()
+    {
+        bool result = true;
+
+        result = result && BitMaskNotAutoTest(FUNC_P(Simd::Base::BitMaskNot), FUNC_P(SimdBitMaskNot));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && BitMaskNotAutoTest(FUNC_P(Simd::Sse41::BitMaskNot), FUNC_P(SimdBitMaskNot));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BitMaskNotAutoTest(FUNC_P(Simd::Avx2::BitMaskNot), FUNC_P(SimdBitMaskNot));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncC
+        {
+            typedef void(*FuncPtr)(const uint8_t * mask, size_t stride, size_t width, size_t height, uint64_t * count);
+
+            FuncPtr func;
+            String description;
+
+            FuncC(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & mask, size_t width, size_t height, uint64_t * count) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(mask.data, mask.stride, width, height, count);
+            }
+        };
+    }
+
+#define FUNC_C(function) FuncC(function, #function)
+
+    bool BitMaskCountAutoTest(int width, int height, const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        int bytes = (width + 7) / 8;
+        View mask(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        FillRandom(mask);
+
+        uint64_t count1, count2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, width, height, &count1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, width, height, &count2));
+
+        TEST_CHECK_VALUE(count);
+
+        return result;
+    }
+
+    bool BitMaskCountAutoTest(const FuncC & f1, const FuncC & f2)
+    {
+        bool result = true;
+
+        result = result && BitMaskCountAutoTest(W, H, f1, f2);
+        result = result && BitMaskCountAutoTest(W + O, H - O, f1, f2);
+
+        return result;
+    }
+
+    bool BitMaskCountAutoTest()
+    {
+        bool result = true;
+
+        result = result && BitMaskCountAutoTest(FUNC_C(Simd::Base::BitMaskCount), FUNC_C(SimdBitMaskCount));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && BitMaskCountAutoTest(FUNC_C(Simd::Sse41::BitMaskCount), FUNC_C(SimdBitMaskCount));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BitMaskCountAutoTest(FUNC_C(Simd::Avx2::BitMaskCount), FUNC_C(SimdBitMaskCount));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncBB
+        {
+            typedef void(*FuncPtr)(const uint8_t * mask, size_t stride, size_t width, size_t height,
+                ptrdiff_t * left, ptrdiff_t * top, ptrdiff_t * right, ptrdiff_t * bottom);
+
+            FuncPtr func;
+            String description;
+
+            FuncBB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & mask, size_t width, size_t height, Rect & box) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(mask.data, mask.stride, width, height, &box.left, &box.top, &box.right, &box.bottom);
+            }
+        };
+    }
+
+#define FUNC_BB(function) FuncBB(function, #function)
+
+    bool BitMaskBoundingBoxAutoTest(int width, int height, const FuncBB & f1, const FuncBB & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        int bytes = (width + 7) / 8;
+        View mask(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        for (int i = 0; i < 8 && result; ++i)
+        {
+            FillRandomSparseBitMask(mask, width, height);
+
+            Rect box1, box2;
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(mask, width, height, box1));
+
+            TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(mask, width, height, box2));
+
+            if (box1 != box2)
+            {
+                TEST_LOG_SS(Error, "Error bounding box: (" << box1.left << ", " << box1.top << ", " << box1.right << ", " << box1.bottom 
+                    << ") != (" << box2.left << ", " << box2.top << ", " << box2.right << ", " << box2.bottom << ")! ");
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+    bool BitMaskBoundingBoxAutoTest(const FuncBB & f1, const FuncBB & f2)
+    {
+        bool result = true;
+
+        result = result && BitMaskBoundingBoxAutoTest(W, H, f1, f2);
+        result = result && BitMaskBoundingBoxAutoTest(W + O, H - O, f1, f2);
+
+        return result;
+    }
+
+    bool BitMaskBoundingBoxAutoTest()
+    {
+        bool result = true;
+
+        result = result && BitMaskBoundingBoxAutoTest(FUNC_BB(Simd::Base::BitMaskBoundingBox), FUNC_BB(SimdBitMaskBoundingBox));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && BitMaskBoundingBoxAutoTest(FUNC_BB(Simd::Sse41::BitMaskBoundingBox), FUNC_BB(SimdBitMaskBoundingBox));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && BitMaskBoundingBoxAutoTest(FUNC_BB(Simd::Avx2::BitMaskBoundingBox), FUNC_BB(SimdBitMaskBoundingBox));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncCp
+        {
+            typedef void(*FuncPtr)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t pixelSize,
+                const uint8_t * mask, size_t maskStride, uint8_t * dst, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncCp(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, const View & mask, View & dst) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.stride, src.width, src.height, src.PixelSize(), mask.data, mask.stride, dst.data, dst.stride);
+            }
+        };
+    }
+
+#define FUNC_CP(function) FuncCp(function, #function)
+
+#define ARGS_CP(format, width, height, function1, function2) \
+    format, width, height, \
+    FuncCp(function1.func, function1.description + ColorDescription(format)), \
+    FuncCp(function2.func, function2.description + ColorDescription(format))
+
+    bool BitMaskCopyAutoTest(View::Format format, int width, int height, const FuncCp & f1, const FuncCp & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        int bytes = (width + 7) / 8;
+        View mask(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        FillRandomBitMask(mask, width, height);
+
+        View src(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(src);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(dst1);
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+        Simd::Copy(dst1, dst2);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, mask, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, mask, dst2));
+
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        return result;
+    }
+
+    bool BitMaskCopyAutoTest(const FuncCp & f1, const FuncCp & f2)
+    {
+        bool result = true;
+
+        View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+        for (int i = 0; i < 4; ++i)
+        {
+            result = result && BitMaskCopyAutoTest(ARGS_CP(formats[i], W, H, f1, f2));
+            result = result && BitMaskCopyAutoTest(ARGS_CP(formats[i], W + O, H - O, f1, f2));
+        }
+
+        return result;
+    }
+
+    bool BitMaskCopyAutoTest()
+    {
+        bool result = true;
+
+        result = result && BitMaskCopyAutoTest(FUNC_CP(Simd::Base::BitMaskCopy), FUNC_CP(SimdBitMaskCopy));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BitMaskCopyAutoTest(FUNC_CP(Simd::Sse41::BitMaskCopy), FUNC_CP(SimdBitMaskCopy));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BitMaskCopyAutoTest(FUNC_CP(Simd::Avx2::BitMaskCopy), FUNC_CP(SimdBitMaskCopy));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncF
+        {
+            typedef void(*FuncPtr)(uint8_t * dst, size_t dstStride, size_t width, size_t height, 
+                const uint8_t * pixel, size_t pixelSize, const uint8_t * mask, size_t maskStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncF(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(View & dst, const uint8_t * pixel, const View & mask) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(dst.data, dst.stride, dst.width, dst.height, pixel, dst.PixelSize(), mask.data, mask.stride);
+            }
+        };
+    }
+
+#define FUNC_F(function) FuncF(function, #function)
+
+#define ARGS_F(format, width, height, function1, function2) \
+    format, width, height, \
+    FuncF(function1.func, function1.description + ColorDescription(format)), \
+    FuncF(function2.func, function2.description + ColorDescription(format))
+
+    bool BitMaskFillAutoTest(View::Format format, int width, int height, const FuncF & f1, const FuncF & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        int bytes = (width + 7) / 8;
+        View mask(bytes, height, View::Gray8, NULL, TEST_ALIGN(bytes));
+        FillRandomBitMask(mask, width, height);
+
+        uint8_t pixel[4];
+        FillRandom(pixel, 4);
+
+        View dst1(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(dst1);
+        View dst2(width, height, format, NULL, TEST_ALIGN(width));
+        Simd::Copy(dst1, dst2);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(dst1, pixel, mask));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(dst2, pixel, mask));
+
+        result = result && Compare(dst1, dst2, 0, true, 32);
+
+        return result;
+    }
+
+    bool BitMaskFillAutoTest(const FuncF & f1, const FuncF & f2)
+    {
+        bool result = true;
+
+        View::Format formats[4] = { View::Gray8, View::Uv16, View::Bgr24, View::Bgra32 };
+        for (int i = 0; i < 4; ++i)
+        {
+            result = result && BitMaskFillAutoTest(ARGS_F(formats[i], W, H, f1, f2));
+            result = result && BitMaskFillAutoTest(ARGS_F(formats[i], W + O, H - O, f1, f2));
+        }
+
+        return result;
+    }
+
+    bool BitMaskFillAutoTest()
+    {
+        bool result = true;
+
+        result = result && BitMaskFillAutoTest(FUNC_F(Simd::Base::BitMaskFill), FUNC_F(SimdBitMaskFill));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && BitMaskFillAutoTest(FUNC_F(Simd::Sse41::BitMaskFill), FUNC_F(SimdBitMaskFill));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && BitMaskFillAutoTest(FUNC_F(Simd::Avx2::BitMaskFill), FUNC_F(SimdBitMaskFill));
+#endif 
+
+        return result;
+    }
+}
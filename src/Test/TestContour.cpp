@@ -229,14 +229,32 @@ namespace Test
             return false;
         }
 
+        bool result = true;
+
         ContourDetector detector;
         detector.Init(image.Size());
 
         ContourDetector::Contours contours;
+        detector.SetThreadNumber(1);
         detector.Detect(image, contours);
 
         TEST_LOG_SS(Info, contours.size() << " contours were found.");
 
+        ContourDetector::Contours parallel;
+        detector.SetThreadNumber(4);
+        detector.Detect(image, parallel);
+        if (parallel != contours)
+        {
+            TEST_LOG_SS(Error, "Contours found in 4 threads differ from ones found in 1 thread!");
+            result = false;
+        }
+
+        ContourDetector::Contours tiled;
+        detector.SetTiledRouting(true);
+        detector.Detect(image, tiled);
+
+        TEST_LOG_SS(Info, tiled.size() << " contours were found with tiled routing.");
+
         for (size_t i = 0; i < contours.size(); ++i)
         {
             for (size_t j = 1; j < contours[i].size(); ++j)
@@ -244,7 +262,7 @@ namespace Test
         }
         image.Save("result.pgm");
 
-        return true;
+        return result;
     }
 }
 
@@ -476,6 +476,33 @@ namespace Test
 #endif
     }
 
+    static bool DetectionProfilingCheck(const Detection & detection)
+    {
+        Detection::Profiles profiles;
+        detection.GetProfiling(profiles);
+        uint64_t windows = 0;
+        for (size_t i = 0; i < profiles.size(); ++i)
+        {
+            const Detection::Profile & p = profiles[i];
+            for (size_t j = 0; j < p.passed.size(); ++j)
+            {
+                if (p.passed[j] > (j ? p.passed[j - 1] : p.windows))
+                {
+                    TEST_LOG_SS(Error, "Detection profile of level " << p.scale << " has wrong number of passed windows at stage " << j << " !");
+                    return false;
+                }
+            }
+            windows += p.windows;
+        }
+        if (windows == 0)
+        {
+            TEST_LOG_SS(Error, "Detection profiling has not counted any window!");
+            return false;
+        }
+        TEST_LOG_SS(Info, "Detection profiling: " << profiles.size() << " levels, " << windows << " windows.");
+        return true;
+    }
+
     bool DetectionSpecialTest()
     {
         Detection detection;
@@ -499,7 +526,12 @@ namespace Test
         if (std::thread::hardware_concurrency() >= 8)
             DetectionSpecialTest(detection, om, 8);
 
-        bool result = true;
+        detection.SetProfiling(true);
+        Objects op;
+        DetectionSpecialTest(detection, op, 2);
+        bool result = DetectionProfilingCheck(detection) && op.size() == os.size();
+        detection.SetProfiling(false);
+
         if (os.size() != om.size())
             result = false;
         else
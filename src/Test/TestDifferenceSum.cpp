@@ -63,6 +63,22 @@ namespace Test
             }
         };
 
+        struct FuncSS
+        {
+            typedef void(*FuncPtr)(const uint8_t * a, const uint8_t * b, size_t size, size_t count, uint32_t * sums);
+
+            FuncPtr func;
+            String description;
+
+            FuncSS(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & a, const View & b, uint32_t * sums) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(a.data, b.data, a.width, b.height, sums);
+            }
+        };
+
         struct FuncF
         {
             typedef void(*FuncPtr)(const float * a, const float * b, size_t size, float * sum);
@@ -82,6 +98,7 @@ namespace Test
 
 #define FUNC_S(function) FuncS(function, #function)
 #define FUNC_M(function) FuncM(function, #function)
+#define FUNC_SS(function) FuncSS(function, #function)
 #define FUNC_F(function) FuncF(function, #function)
 
     bool DifferenceSumsAutoTest(int width, int height, const FuncS & f1, const FuncS & f2, int count)
@@ -255,6 +272,69 @@ namespace Test
         return result;
     }
 
+    bool SquaredDifferenceSums8uAutoTest(size_t size, size_t count, const FuncSS & f1, const FuncSS & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << size << ", " << count << "].");
+
+        View a(size, 1, View::Gray8, NULL, 1);
+        FillRandom(a);
+
+        View b(size, count, View::Gray8, NULL, 1);
+        FillRandom(b);
+
+        Sums s1(count, 0), s2(count, 0);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(a, b, s1.data()));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(a, b, s2.data()));
+
+        result = Compare(s1, s2, 0, true, 32);
+
+        return result;
+    }
+
+    bool SquaredDifferenceSums8uAutoTest(const FuncSS & f1, const FuncSS & f2)
+    {
+        bool result = true;
+
+        result = result && SquaredDifferenceSums8uAutoTest(16, W * H / 16 + O, f1, f2);
+        result = result && SquaredDifferenceSums8uAutoTest(256, W * H / 256 - O, f1, f2);
+        result = result && SquaredDifferenceSums8uAutoTest(W + O, H, f1, f2);
+
+        return result;
+    }
+
+    bool SquaredDifferenceSums8uAutoTest()
+    {
+        bool result = true;
+
+        result = result && SquaredDifferenceSums8uAutoTest(FUNC_SS(Simd::Base::SquaredDifferenceSums8u), FUNC_SS(SimdSquaredDifferenceSums8u));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SquaredDifferenceSums8uAutoTest(FUNC_SS(Simd::Sse41::SquaredDifferenceSums8u), FUNC_SS(SimdSquaredDifferenceSums8u));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SquaredDifferenceSums8uAutoTest(FUNC_SS(Simd::Avx2::SquaredDifferenceSums8u), FUNC_SS(SimdSquaredDifferenceSums8u));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SquaredDifferenceSums8uAutoTest(FUNC_SS(Simd::Avx512bw::SquaredDifferenceSums8u), FUNC_SS(SimdSquaredDifferenceSums8u));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SquaredDifferenceSums8uAutoTest(FUNC_SS(Simd::Neon::SquaredDifferenceSums8u), FUNC_SS(SimdSquaredDifferenceSums8u));
+#endif 
+
+        return result;
+    }
+
     bool AbsDifferenceSumAutoTest()
     {
         bool result = true;
@@ -406,6 +406,192 @@ namespace Test
         return result;
     }
 
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncAC
+        {
+            typedef void(*FuncPtr)(const SimdAlphaLayer* layers, size_t count, uint8_t* dst, size_t dstStride, size_t width, size_t height, size_t channelCount);
+            FuncPtr func;
+            String description;
+
+            FuncAC(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const std::vector<SimdAlphaLayer>& layers, const View& dstSrc, View& dstDst) const
+            {
+                Simd::Copy(dstSrc, dstDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(layers.data(), layers.size(), dstDst.data, dstDst.stride, dstDst.width, dstDst.height, dstDst.ChannelCount());
+            }
+        };
+
+        struct AlphaCompositeLayers
+        {
+            std::vector<SimdAlphaLayer> layers;
+            std::vector<View> srcs, alphas;
+
+            AlphaCompositeLayers(View::Format format, int width, int height, size_t count)
+                : layers(count), srcs(count), alphas(count)
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    SimdAlphaLayer& layer = layers[i];
+                    layer.type = SimdAlphaLayerType(Random(3));
+                    layer.width = 1 + Random(width);
+                    layer.height = 1 + Random(height / 2);
+                    layer.left = Random(width + width / 2) - width / 4;
+                    layer.top = Random(height + height / 2) - height / 4;
+                    layer.value = uint8_t(Random(256));
+                    for (size_t c = 0; c < 4; ++c)
+                        layer.color[c] = uint8_t(Random(256));
+                    if (layer.type != SimdAlphaLayerFill)
+                    {
+                        srcs[i].Recreate(layer.width, layer.height, layer.type == SimdAlphaLayerPremultiplied ? View::Bgra32 : format);
+                        FillRandom(srcs[i]);
+                        if (layer.type == SimdAlphaLayerPremultiplied)
+                            SimdAlphaPremultiply(srcs[i].data, srcs[i].stride, srcs[i].width, srcs[i].height, srcs[i].data, srcs[i].stride, SimdFalse);
+                        layer.src = srcs[i].data;
+                        layer.srcStride = srcs[i].stride;
+                    }
+                    else
+                    {
+                        layer.src = NULL;
+                        layer.srcStride = 0;
+                    }
+                    if (layer.type != SimdAlphaLayerPremultiplied && Random(2))
+                    {
+                        alphas[i].Recreate(layer.width, layer.height, View::Gray8);
+                        FillRandom(alphas[i]);
+                        layer.alpha = alphas[i].data;
+                        layer.alphaStride = alphas[i].stride;
+                    }
+                    else
+                    {
+                        layer.alpha = NULL;
+                        layer.alphaStride = 0;
+                    }
+                }
+            }
+        };
+
+        void AlphaCompositeSequential(const std::vector<SimdAlphaLayer>& layers, View& dst)
+        {
+            size_t channelCount = dst.ChannelCount();
+            for (size_t i = 0; i < layers.size(); ++i)
+            {
+                const SimdAlphaLayer& layer = layers[i];
+                ptrdiff_t left = std::max<ptrdiff_t>(layer.left, 0), top = std::max<ptrdiff_t>(layer.top, 0);
+                ptrdiff_t right = std::min<ptrdiff_t>(layer.left + layer.width, dst.width), bottom = std::min<ptrdiff_t>(layer.top + layer.height, dst.height);
+                if (left >= right || top >= bottom)
+                    continue;
+                size_t width = right - left, height = bottom - top, x = left - layer.left, y = top - layer.top;
+                uint8_t* d = dst.data + top * dst.stride + left * channelCount;
+                const uint8_t* alpha = layer.alpha ? layer.alpha + y * layer.alphaStride + x : NULL;
+                if (layer.type == SimdAlphaLayerBlend)
+                {
+                    const uint8_t* src = layer.src + y * layer.srcStride + x * channelCount;
+                    if (alpha)
+                        SimdAlphaBlending(src, layer.srcStride, width, height, channelCount, alpha, layer.alphaStride, d, dst.stride);
+                    else
+                        SimdAlphaBlendingUniform(src, layer.srcStride, width, height, channelCount, layer.value, d, dst.stride);
+                }
+                else if (layer.type == SimdAlphaLayerFill)
+                {
+                    if (alpha)
+                        SimdAlphaFilling(d, dst.stride, width, height, layer.color, channelCount, alpha, layer.alphaStride);
+                    else
+                    {
+                        View color(width, height, dst.format);
+                        for (size_t row = 0; row < height; ++row)
+                            for (size_t col = 0; col < width; ++col)
+                                memcpy(color.data + row * color.stride + col * channelCount, layer.color, channelCount);
+                        SimdAlphaBlendingUniform(color.data, color.stride, width, height, channelCount, layer.value, d, dst.stride);
+                    }
+                }
+                else
+                {
+                    for (size_t row = 0; row < height; ++row)
+                    {
+                        const uint8_t* s = layer.src + (y + row) * layer.srcStride + x * 4;
+                        uint8_t* r = d + row * dst.stride;
+                        for (size_t col = 0; col < width; ++col, s += 4, r += channelCount)
+                            for (size_t c = 0; c < channelCount; ++c)
+                                {
+                                int value = r[c] * (255 - s[3]);
+                                r[c] = std::min(s[c] + ((value + 1 + (value >> 8)) >> 8), 255);
+                            }
+                    }
+                }
+            }
+        }
+    }
+
+#define FUNC_AC(func) FuncAC(func, #func)
+
+    bool AlphaCompositeAutoTest(View::Format format, int width, int height, const FuncAC& f1, const FuncAC& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        AlphaCompositeLayers layers(format, width, height, 8);
+
+        View b(width, height, format, NULL, TEST_ALIGN(width));
+        FillRandom(b);
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+        View d3(width, height, format, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(layers.layers, b, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(layers.layers, b, d2));
+
+        Simd::Copy(b, d3);
+        AlphaCompositeSequential(layers.layers, d3);
+
+        result = result && Compare(d1, d2, 0, true, 64);
+        result = result && Compare(d1, d3, 0, true, 64, 0, "sequential");
+
+        return result;
+    }
+
+    bool AlphaCompositeAutoTest(const FuncAC& f1, const FuncAC& f2)
+    {
+        bool result = true;
+
+        for (View::Format format = View::Gray8; format <= View::Bgra32; format = View::Format(format + 1))
+        {
+            FuncAC f1c = FuncAC(f1.func, f1.description + ColorDescription(format));
+            FuncAC f2c = FuncAC(f2.func, f2.description + ColorDescription(format));
+
+            result = result && AlphaCompositeAutoTest(format, W, H, f1c, f2c);
+            result = result && AlphaCompositeAutoTest(format, W + O, H - O, f1c, f2c);
+        }
+
+        return result;
+    }
+
+    bool AlphaCompositeAutoTest()
+    {
+        bool result = true;
+
+        result = result && AlphaCompositeAutoTest(FUNC_AC(Simd::Base::AlphaComposite), FUNC_AC(SimdAlphaComposite));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && AlphaCompositeAutoTest(FUNC_AC(Simd::Sse41::AlphaComposite), FUNC_AC(SimdAlphaComposite));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && AlphaCompositeAutoTest(FUNC_AC(Simd::Avx2::AlphaComposite), FUNC_AC(SimdAlphaComposite));
+#endif 
+
+        return result;
+    }
+
     //-------------------------------------------------------------------------
 
     namespace
@@ -26,6 +26,7 @@
 #include "Test/TestRandom.h"
 
 #include "Simd/SimdFont.hpp"
+#include "Simd/SimdOverlay.hpp"
 
 //#define TEST_GENERATE_FONT
 
@@ -228,4 +229,63 @@ namespace Test
 
         return true;
     }
+
+    bool OverlayDrawSpecialTest()
+    {
+        typedef Simd::Pixel::Bgra32 Color;
+        typedef Simd::Overlay<Color> Overlay;
+
+        bool result = true;
+
+        View background(W, H * 4, View::Bgra32);
+        FillRandom(background);
+        View control(background.Size(), View::Bgra32), image(background.Size(), View::Bgra32);
+        Simd::Copy(background, control);
+        Simd::Copy(background, image);
+
+        Simd::Font font(16), cached(16);
+        cached.SetCacheSize(4);
+        const String texts[3] = { "Label", "Camera #1\n12:34:56", "FPS: 60" };
+
+        Overlay overlay;
+        for (size_t i = 0; i < 256; ++i)
+        {
+            Point p1(Random(W * 5 / 4) - W / 8, Random(H * 5) - H / 2);
+            Point p2 = p1 + Point(Random(W / 2) - W / 4, Random(H) - H / 2);
+            Color color(Random(255), Random(255), Random(255), Random(255));
+            size_t width = Random(3) + 1;
+            switch (i % 4)
+            {
+            case 0:
+                overlay.AddLine(p1, p2, color, width);
+                Simd::DrawLine(control, p1, p2, color, width);
+                break;
+            case 1:
+                overlay.AddRectangle(Rect(p1, p2), color, width);
+                Simd::DrawRectangle(control, Rect(p1, p2), color, width);
+                break;
+            case 2:
+            {
+                Rect rect(p1, p1 + Point(Random(W / 8), Random(H / 8)));
+                overlay.AddFilledRectangle(rect, color);
+                Simd::DrawFilledRectangle(control, rect, color);
+                break;
+            }
+            case 3:
+            {
+                const String & text = texts[Random(3)];
+                overlay.AddText(cached, text, p1, color);
+                font.Draw(control, text, p1, color);
+                break;
+            }
+            }
+        }
+        overlay.Draw(image);
+
+        result = result && Compare(control, image, 0, true, 64, 0, "overlay");
+
+        image.Save("overlay.ppm");
+
+        return result;
+    }
 }
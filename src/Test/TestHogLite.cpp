@@ -26,6 +26,8 @@
 #include "Test/TestString.h"
 #include "Test/TestRandom.h"
 
+#include "Simd/SimdHogPyramid.hpp"
+
 namespace Test
 {
     void FillCircle(View & view)
@@ -771,4 +773,73 @@ namespace Test
 
         return result;
     }
+
+    //-----------------------------------------------------------------------------
+
+    bool HogPyramidSpecialTest()
+    {
+        typedef Simd::HogPyramid<Simd::Allocator> HogPyramid;
+
+        bool result = true;
+
+        const size_t cell = 8, filterWidth = 6, filterHeight = 12, featureSize = HogPyramid::FEATURE_SIZE;
+        const Size minSize((filterWidth + 2) * cell, (filterHeight + 2) * cell);
+
+        View src(W, H, View::Gray8, NULL, TEST_ALIGN(W));
+        FillRandom(src);
+
+        Buffer32f filter(filterWidth * filterHeight * featureSize);
+        FillRandom(filter, -1.0f, 1.0f);
+
+        HogPyramid single, multi;
+        single.SetThreadNumber(1);
+        multi.SetThreadNumber(4);
+        if (!single.Init(src.Size(), cell, 4, minSize) || !multi.Init(src.Size(), cell, 4, minSize))
+        {
+            TEST_LOG_SS(Error, "Can't initialize HogPyramid for image [" << W << ", " << H << "] !");
+            return false;
+        }
+
+        TEST_LOG_SS(Info, "Test HogPyramid for image [" << W << ", " << H << "] with " << single.LevelCount() << " levels.");
+
+        {
+            TEST_PERFORMANCE_TEST("HogPyramid-1");
+            single.Compute(src);
+            single.Filter(filter.data(), filterWidth, filterHeight);
+        }
+        {
+            TEST_PERFORMANCE_TEST("HogPyramid-4");
+            multi.Compute(src);
+            multi.Filter(filter.data(), filterWidth, filterHeight);
+        }
+
+        for (size_t i = 0; i < single.LevelCount() && result; ++i)
+        {
+            const HogPyramid::Level & s = single[i], & m = multi[i];
+            String level = String("level ") + ToString(i);
+            result = result && Compare(s.features, m.features, EPS, true, 32, DifferenceAbsolute, level + " features");
+            if (s.response.data && m.response.data)
+                result = result && Compare(s.response, m.response, EPS, true, 32, DifferenceAbsolute, level + " response");
+            else if (s.response.data || m.response.data)
+            {
+                TEST_LOG_SS(Error, "Different response state at " << level << " !");
+                result = false;
+            }
+        }
+
+        if (result)
+        {
+            const HogPyramid::Level & base = single[0];
+            View features(base.size.x * featureSize, base.size.y, View::Float);
+            Simd::HogLiteExtractFeatures(src, cell, (float*)features.data, features.stride / sizeof(float));
+            result = result && Compare(base.features, features, EPS, true, 32, DifferenceAbsolute, "base features");
+
+            View response(base.size.x - filterWidth + 1, base.size.y - filterHeight + 1, View::Float);
+            SimdHogLiteFilterFeatures((float*)features.data, features.stride / sizeof(float), base.size.x, base.size.y, featureSize,
+                filter.data(), filterWidth, filterHeight, NULL, 0, (float*)response.data, response.stride / sizeof(float));
+            result = result && Compare(base.response, response, EPS, true, 32, DifferenceAbsolute, "base response");
+        }
+
+        return result;
+    }
 }
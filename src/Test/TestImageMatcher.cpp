@@ -121,6 +121,94 @@ namespace Test
         TEST_LOG_SS(Info, "Filtration performance for " << g_names[type] << " : " << std::setprecision(3) << std::fixed << (GetTime() - time) << " s. ");
     }
 
+    bool CompareResults(const ImageMatcher::Results & a, const ImageMatcher::Results & b, const String & description)
+    {
+        if (a.size() != b.size())
+        {
+            TEST_LOG_SS(Error, description << " : different number of results: " << a.size() << " != " << b.size() << " !");
+            return false;
+        }
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            if (a[i].hash->tag != b[i].hash->tag || a[i].difference != b[i].difference)
+            {
+                TEST_LOG_SS(Error, description << " : different result [" << i << "]: (" << a[i].hash->tag << ", " << a[i].difference
+                    << ") != (" << b[i].hash->tag << ", " << b[i].difference << ") !");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool CheckIndex(const ViewPtrs & src, double threshold, bool normalized)
+    {
+        const size_t repeats = 40000 / src.size() + 1, threads = 4, step = src.size() / 16 + 1;
+        const String path = "image_matcher_index.bin";
+
+        ImageMatcher matcher;
+        matcher.Init(threshold, ImageMatcher::Hash16x16, 0, normalized);
+        std::vector<ImageMatcher::HashPtr> hashes(src.size());
+        for (size_t i = 0; i < src.size(); ++i)
+            hashes[i] = matcher.Create(*src[i], i);
+        for (size_t r = 0; r < repeats; ++r)
+            for (size_t i = 0; i < src.size(); ++i)
+                matcher.Add(hashes[i]);
+
+        TEST_LOG_SS(Info, "Check ImageMatcher index with " << matcher.Size() << " hashes: parallel search, serialization and removing.");
+
+        ImageMatcher loaded;
+        if (!matcher.Save(path) || !loaded.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't save and load ImageMatcher index '" << path << "' !");
+            return false;
+        }
+        ::remove(path.c_str());
+        if (loaded.Size() != matcher.Size())
+        {
+            TEST_LOG_SS(Error, "Loaded ImageMatcher has wrong size: " << loaded.Size() << " != " << matcher.Size() << " !");
+            return false;
+        }
+
+        for (size_t i = 0; i < src.size(); i += step)
+        {
+            ImageMatcher::Results single, parallel, restored;
+            matcher.SetThreadNumber(1);
+            matcher.Find(hashes[i], single);
+            matcher.SetThreadNumber(threads);
+            matcher.Find(hashes[i], parallel);
+            loaded.Find(hashes[i], restored);
+            if (!CompareResults(single, parallel, "Parallel search") || !CompareResults(single, restored, "Loaded index"))
+                return false;
+        }
+
+        size_t size = matcher.Size();
+        for (size_t r = 0; r < repeats; ++r)
+        {
+            if (!matcher.Remove(hashes[0]))
+            {
+                TEST_LOG_SS(Error, "Can't remove hash from ImageMatcher!");
+                return false;
+            }
+        }
+        if (matcher.Remove(hashes[0]) || matcher.Size() != size - repeats)
+        {
+            TEST_LOG_SS(Error, "Wrong state of ImageMatcher after removing!");
+            return false;
+        }
+        ImageMatcher::Results results;
+        matcher.Find(hashes[0], results);
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            if (results[i].hash == hashes[0].get())
+            {
+                TEST_LOG_SS(Error, "Removed hash was found in ImageMatcher!");
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     bool ImageMatcherSpecialTest()
     {
         bool result = true;
@@ -147,9 +235,11 @@ namespace Test
         Indexes is2;
         PerformFiltration(samples, size.x, threshold, 2, normalized, is2);
 
-        result = Compare(is0, is1, 0, true, 0, "D1");
+        result = result && Compare(is0, is1, 0, true, 0, "D1");
+
+        result = result && Compare(is1, is2, 0, true, 0, "D3");
 
-        result = Compare(is1, is2, 0, true, 0, "D3");
+        result = result && CheckIndex(samples, threshold, normalized);
 
         return result;
     }
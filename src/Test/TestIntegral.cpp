@@ -118,6 +118,46 @@ namespace Test
 
         result = result && IntegralAutoTest(View::Int32, View::Int32, f1, f2);
         result = result && IntegralAutoTest(View::Int32, View::Double, f1, f2);
+        result = result && IntegralAutoTest(View::Int32, View::Int64, f1, f2);
+        result = result && IntegralAutoTest(View::Int32, View::Float, f1, f2);
+
+        return result;
+    }
+
+    bool IntegralParallelAutoTest(View::Format sqsumFormat, const Func & f1, const Func & f2)
+    {
+        bool result = true;
+
+        for (int sqsumEnable = 0; sqsumEnable <= 1; ++sqsumEnable)
+        {
+            std::stringstream ss;
+            ss << ColorDescription(View::Int32) + ColorDescription(sqsumFormat);
+            ss << "[1" << sqsumEnable << "0]";
+
+            Func f1d = Func(f1.func, f1.description + ss.str());
+            Func f2d = Func(f2.func, f2.description + ss.str());
+            result = result && IntegralAutoTest(W, H, sqsumEnable != 0, false, View::Int32, sqsumFormat, f1d, f2d);
+            result = result && IntegralAutoTest(W + O, H - O, sqsumEnable != 0, false, View::Int32, sqsumFormat, f1d, f2d);
+        }
+
+        return result;
+    }
+
+    bool IntegralParallelAutoTest()
+    {
+        bool result = true;
+
+        size_t threadNumber = SimdGetThreadNumber();
+        SimdSetThreadNumber(4);
+        if (SimdGetThreadNumber() < 2)
+            TEST_LOG_SS(Info, "Only one thread is available: SimdIntegral uses a single-threaded algorithm in IntegralParallelAutoTest!");
+
+        result = result && IntegralParallelAutoTest(View::Int32, FUNC(Simd::Base::Integral), FUNC(SimdIntegral));
+        result = result && IntegralParallelAutoTest(View::Int64, FUNC(Simd::Base::Integral), FUNC(SimdIntegral));
+        result = result && IntegralParallelAutoTest(View::Float, FUNC(Simd::Base::Integral), FUNC(SimdIntegral));
+        result = result && IntegralParallelAutoTest(View::Double, FUNC(Simd::Base::Integral), FUNC(SimdIntegral));
+
+        SimdSetThreadNumber(threadNumber);
 
         return result;
     }
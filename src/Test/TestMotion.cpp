@@ -23,6 +23,8 @@
 */
 #include "Test/TestCompare.h"
 #include "Test/TestPerformance.h"
+#include "Test/TestRandom.h"
+#include "Test/TestString.h"
 
 //-----------------------------------------------------------------------------
 
@@ -161,4 +163,132 @@ namespace Test
 
         return true;
     }
+
+    //-----------------------------------------------------------------------------
+
+    static void MotionMultiDetectorFrame(size_t stream, size_t index, Frame & frame)
+    {
+        View & view = frame.planes[0];
+        Simd::Fill(view, 0);
+        FillRandom(view, 40, 60);
+        ptrdiff_t size = view.height / 6, shift = (stream % 2 ? 3 : 5) + stream;
+        ptrdiff_t left = (index * shift) % (view.width - size), top = view.height / 3 + stream * 4;
+        Simd::Fill(view.Region(left, top, left + size, top + size).Ref(), 200);
+        frame.timestamp = double(index) * 0.04;
+    }
+
+    static bool MotionMultiDetectorCompare(size_t stream, size_t index, const Simd::Motion::Metadata & s, const Simd::Motion::Metadata & m)
+    {
+        bool equal = s.objects.size() == m.objects.size() && s.events.size() == m.events.size();
+        for (size_t i = 0; equal && i < s.objects.size(); ++i)
+            equal = s.objects[i].id == m.objects[i].id && s.objects[i].rect == m.objects[i].rect;
+        for (size_t i = 0; equal && i < s.events.size(); ++i)
+            equal = s.events[i].type == m.events[i].type && s.events[i].objectId == m.events[i].objectId;
+        if (!equal)
+            TEST_LOG_SS(Error, "Metadata of stream " << stream << " at frame " << index << " is different: " << 
+                s.objects.size() << "/" << s.events.size() << " vs " << m.objects.size() << "/" << m.events.size() << " objects/events.");
+        return equal;
+    }
+
+    bool MotionMultiDetectorSpecialTest()
+    {
+        const size_t S = 8, F = 64, W = 320, H = 240;
+
+        std::vector<std::shared_ptr<Simd::Motion::Detector>> singles(S);
+        for (size_t s = 0; s < S; ++s)
+            singles[s].reset(new Simd::Motion::Detector());
+        Simd::Motion::MultiDetector multi(S);
+
+        std::vector<Frame> inputs(S);
+        for (size_t s = 0; s < S; ++s)
+            inputs[s].Recreate(W, H, Frame::Bgr24);
+        std::vector<Simd::Motion::Metadata> singleMetadatas(S), multiMetadatas;
+        double singleTime = 0, multiTime = 0;
+        size_t objects = 0;
+        for (size_t f = 0; f < F; ++f)
+        {
+            for (size_t s = 0; s < S; ++s)
+                MotionMultiDetectorFrame(s, f, inputs[s]);
+
+            double start = GetTime();
+            for (size_t s = 0; s < S; ++s)
+                singles[s]->NextFrame(inputs[s], singleMetadatas[s]);
+            singleTime += GetTime() - start;
+
+            start = GetTime();
+            if (!multi.NextFrames(inputs, multiMetadatas))
+            {
+                TEST_LOG_SS(Error, "Can't process frame " << f << " with MultiDetector!");
+                return false;
+            }
+            multiTime += GetTime() - start;
+
+            for (size_t s = 0; s < S; ++s)
+            {
+                if (!MotionMultiDetectorCompare(s, f, singleMetadatas[s], multiMetadatas[s]))
+                    return false;
+                objects += multiMetadatas[s].objects.size();
+            }
+        }
+
+        TEST_LOG_SS(Info, "Motion detection of " << S << " streams (" << F << " frames " << W << "x" << H << "): single " <<
+            singleTime * 1000 << " ms, multi " << multiTime * 1000 << " ms, " << objects << " objects.");
+
+        return true;
+    }
+
+    //-----------------------------------------------------------------------------
+
+    bool FrameContextSpecialTest()
+    {
+        typedef Simd::FrameContext<Simd::Allocator> FrameContext;
+
+        const size_t F = 32, W = 320, H = 240, L = 4;
+        const uint8_t saturation = 16, boost = 4;
+
+        Simd::Motion::Detector single, shared;
+        Simd::Motion::Metadata singleMetadata, sharedMetadata;
+        Frame input(W, H, Frame::Bgr24);
+        FrameContext context;
+        for (size_t f = 0; f < F; ++f)
+        {
+            MotionMultiDetectorFrame(0, f, input);
+            context.Reset(input);
+
+            View gray(W, H, View::Gray8);
+            Simd::Convert(input, Frame(gray).Ref());
+            if (!Compare(gray, context.Gray(), 0, true, 32, 0, "gray"))
+                return false;
+
+            for (int type = SimdReduce2x2; type <= SimdReduce5x5; ++type)
+            {
+                Simd::Pyramid<Simd::Allocator> pyramid(W, H, L);
+                Simd::Copy(gray, pyramid[0]);
+                Simd::Build(pyramid, (SimdReduceType)type);
+                for (size_t l = 1; l < L; ++l)
+                {
+                    String level = String("level ") + ToString(l) + " of reduce type " + ToString(type);
+                    if (!Compare(pyramid[l], context.Level(l, (SimdReduceType)type), 0, true, 32, 0, level))
+                        return false;
+                }
+            }
+
+            View sum(W / 2 + 1, H / 2 + 1, View::Int32), dx(W / 2, H / 2, View::Gray8), dy(W / 2, H / 2, View::Gray8);
+            Simd::Integral(context.Level(1), sum);
+            Simd::TextureBoostedSaturatedGradient(context.Level(1), saturation, boost, dx, dy);
+            if (!Compare(sum, context.Integral(1), 0, true, 32, 0, "integral") ||
+                !Compare(dx, context.TextureDx(1, saturation, boost), 0, true, 32, 0, "dx") ||
+                !Compare(dy, context.TextureDy(1, saturation, boost), 0, true, 32, 0, "dy"))
+                return false;
+
+            single.NextFrame(input, singleMetadata);
+            shared.NextFrame(context, sharedMetadata);
+            if (!MotionMultiDetectorCompare(0, f, singleMetadata, sharedMetadata))
+                return false;
+        }
+
+        TEST_LOG_SS(Info, "FrameContext test of " << F << " frames " << W << "x" << H << " is passed.");
+
+        return true;
+    }
 }
@@ -0,0 +1,245 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdLib.hpp"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncNv12
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, SimdYuvType yuvType);
+            FuncPtr func;
+            String description;
+
+            FuncNv12(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+            }
+        };
+
+        struct FuncNv12A
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+            FuncPtr func;
+            String description;
+
+            FuncNv12A(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, alpha, yuvType);
+            }
+        };
+    }
+
+#define FUNC_NV12(func) FuncNv12(func, #func)
+#define FUNC_NV12A(func) FuncNv12A(func, #func)
+
+    bool Nv12ToBgrAutoTest(int width, int height, View::Format dstFormat, SimdYuvType yuvType, const FuncNv12& f1, const FuncNv12& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+
+        View dst1(width, height, dstFormat, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstFormat, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Nv12ToBgrAutoTest(View::Format dstFormat, const FuncNv12& f1, const FuncNv12& f2)
+    {
+        bool result = true;
+
+        result = result && Nv12ToBgrAutoTest(W, H, dstFormat, SimdYuvBt601, f1, f2);
+        result = result && Nv12ToBgrAutoTest(W + E, H - E, dstFormat, SimdYuvBt709, f1, f2);
+        result = result && Nv12ToBgrAutoTest(W - E, H + E, dstFormat, SimdYuvTrect871, f1, f2);
+
+        return result;
+    }
+
+    bool Nv12ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToBgrAutoTest(View::Bgr24, FUNC_NV12(Simd::Base::Nv12ToBgr), FUNC_NV12(SimdNv12ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Nv12ToBgrAutoTest(View::Bgr24, FUNC_NV12(Simd::Sse41::Nv12ToBgr), FUNC_NV12(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Nv12ToBgrAutoTest(View::Bgr24, FUNC_NV12(Simd::Avx2::Nv12ToBgr), FUNC_NV12(SimdNv12ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToBgrAutoTest(View::Bgr24, FUNC_NV12(Simd::Avx512bw::Nv12ToBgr), FUNC_NV12(SimdNv12ToBgr));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToBgrAutoTest(View::Rgb24, FUNC_NV12(Simd::Base::Nv12ToRgb), FUNC_NV12(SimdNv12ToRgb));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Nv12ToBgrAutoTest(View::Rgb24, FUNC_NV12(Simd::Sse41::Nv12ToRgb), FUNC_NV12(SimdNv12ToRgb));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Nv12ToBgrAutoTest(View::Rgb24, FUNC_NV12(Simd::Avx2::Nv12ToRgb), FUNC_NV12(SimdNv12ToRgb));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToBgrAutoTest(View::Rgb24, FUNC_NV12(Simd::Avx512bw::Nv12ToRgb), FUNC_NV12(SimdNv12ToRgb));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Nv12ToBgraAutoTest(int width, int height, View::Format dstFormat, SimdYuvType yuvType, const FuncNv12A& f1, const FuncNv12A& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        FillRandom(uv);
+        uint8_t alpha = Random(256);
+
+        View dst1(width, height, dstFormat, NULL, TEST_ALIGN(width));
+        View dst2(width, height, dstFormat, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2, alpha, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        if (dstFormat == View::Bgra32 && result)
+        {
+            View u(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+            View v(width / 2, height / 2, View::Gray8, NULL, TEST_ALIGN(width));
+            View dst3(width, height, dstFormat, NULL, TEST_ALIGN(width));
+            Simd::DeinterleaveUv(uv, u, v);
+            SimdYuv420pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, dst3.data, dst3.stride, alpha, yuvType);
+            result = result && Compare(dst1, dst3, 0, true, 64, 0, "Yuv420pToBgraV2");
+        }
+
+        return result;
+    }
+
+    bool Nv12ToBgraAutoTest(View::Format dstFormat, const FuncNv12A& f1, const FuncNv12A& f2)
+    {
+        bool result = true;
+
+        result = result && Nv12ToBgraAutoTest(W, H, dstFormat, SimdYuvBt601, f1, f2);
+        result = result && Nv12ToBgraAutoTest(W + E, H - E, dstFormat, SimdYuvBt709, f1, f2);
+        result = result && Nv12ToBgraAutoTest(W - E, H + E, dstFormat, SimdYuvBt2020, f1, f2);
+
+        return result;
+    }
+
+    bool Nv12ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToBgraAutoTest(View::Bgra32, FUNC_NV12A(Simd::Base::Nv12ToBgra), FUNC_NV12A(SimdNv12ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Nv12ToBgraAutoTest(View::Bgra32, FUNC_NV12A(Simd::Sse41::Nv12ToBgra), FUNC_NV12A(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Nv12ToBgraAutoTest(View::Bgra32, FUNC_NV12A(Simd::Avx2::Nv12ToBgra), FUNC_NV12A(SimdNv12ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToBgraAutoTest(View::Bgra32, FUNC_NV12A(Simd::Avx512bw::Nv12ToBgra), FUNC_NV12A(SimdNv12ToBgra));
+#endif 
+
+        return result;
+    }
+
+    bool Nv12ToRgbaAutoTest()
+    {
+        bool result = true;
+
+        result = result && Nv12ToBgraAutoTest(View::Rgba32, FUNC_NV12A(Simd::Base::Nv12ToRgba), FUNC_NV12A(SimdNv12ToRgba));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Nv12ToBgraAutoTest(View::Rgba32, FUNC_NV12A(Simd::Sse41::Nv12ToRgba), FUNC_NV12A(SimdNv12ToRgba));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Nv12ToBgraAutoTest(View::Rgba32, FUNC_NV12A(Simd::Avx2::Nv12ToRgba), FUNC_NV12A(SimdNv12ToRgba));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Nv12ToBgraAutoTest(View::Rgba32, FUNC_NV12A(Simd::Avx512bw::Nv12ToRgba), FUNC_NV12A(SimdNv12ToRgba));
+#endif 
+
+        return result;
+    }
+}
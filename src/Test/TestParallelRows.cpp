@@ -0,0 +1,182 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+namespace Test
+{
+    namespace
+    {
+        struct ParallelRowsMode
+        {
+            ParallelRowsMode(size_t threadNumber, size_t threshold)
+                : _threadNumber(SimdGetThreadNumber())
+                , _threshold(SimdGetParallelThreshold())
+            {
+                SimdSetThreadNumber(threadNumber);
+                SimdSetParallelThreshold(threshold);
+            }
+
+            ~ParallelRowsMode()
+            {
+                SimdSetThreadNumber(_threadNumber);
+                SimdSetParallelThreshold(_threshold);
+            }
+
+        private:
+            size_t _threadNumber, _threshold;
+        };
+    }
+
+    template<class Function> bool ParallelRowsAutoTest(const String & name, size_t width, size_t height, View::Format format, Function function)
+    {
+        String desc = "Simd" + name;
+
+        TEST_LOG_SS(Info, "Test " << desc << " [" << width << ", " << height << "].");
+
+        View d1(width, height, format, NULL, TEST_ALIGN(width));
+        View d2(width, height, format, NULL, TEST_ALIGN(width));
+
+        {
+            TEST_PERFORMANCE_TEST(desc + "[1]");
+            function(d1);
+        }
+        {
+            ParallelRowsMode mode(4, 1);
+            TEST_PERFORMANCE_TEST(desc + "[4]");
+            function(d2);
+        }
+
+        return Compare(d1, d2, 0, true, 64, 0, desc);
+    }
+
+    bool ParallelRowsAutoTest(int width, int height)
+    {
+        bool result = true;
+
+        View bgr(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View bgra(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View alpha(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View u(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View v(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View uv(width / 2, height / 2, View::Uv16, NULL, TEST_ALIGN(width));
+        View bayer(width, height, View::BayerGrbg, NULL, TEST_ALIGN(width));
+        FillRandom(bgr);
+        FillRandom(bgra);
+        FillRandom(alpha);
+        FillRandom(y);
+        FillRandom(u);
+        FillRandom(v);
+        FillRandom(uv);
+        FillRandom(bayer);
+
+        result = result && ParallelRowsAutoTest("BgrToGray", width, height, View::Gray8, [&](View & dst)
+        {
+            SimdBgrToGray(bgr.data, bgr.width, bgr.height, bgr.stride, dst.data, dst.stride);
+        });
+
+        result = result && ParallelRowsAutoTest("Copy", width, height, View::Bgra32, [&](View & dst)
+        {
+            SimdCopy(bgra.data, bgra.stride, bgra.width, bgra.height, bgra.PixelSize(), dst.data, dst.stride);
+        });
+
+        result = result && ParallelRowsAutoTest("AlphaBlending", width, height, View::Bgr24, [&](View & dst)
+        {
+            Simd::Fill(dst, 0x77);
+            SimdAlphaBlending(bgr.data, bgr.stride, bgr.width, bgr.height, 3, alpha.data, alpha.stride, dst.data, dst.stride);
+        });
+
+        for (::SimdTransformType transform = ::SimdTransformRotate0; transform <= ::SimdTransformTransposeRotate270; transform = ::SimdTransformType(transform + 1))
+        {
+            Size size = Simd::TransformSize(bgr.Size(), transform);
+            result = result && ParallelRowsAutoTest("TransformImage[" + ToString(transform) + "]", size.x, size.y, View::Bgr24, [&](View & dst)
+            {
+                SimdTransformImage(bgr.data, bgr.stride, bgr.width, bgr.height, 3, transform, dst.data, dst.stride);
+            });
+        }
+
+        for (View::Format format = View::BayerGrbg; format <= View::BayerBggr; format = View::Format(format + 1))
+        {
+            result = result && ParallelRowsAutoTest("BayerToBgr[" + ToString(format) + "]", width, height, View::Bgr24, [&](View & dst)
+            {
+                SimdBayerToBgr(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)format, dst.data, dst.stride);
+            });
+            result = result && ParallelRowsAutoTest("BayerToBgra[" + ToString(format) + "]", width, height, View::Bgra32, [&](View & dst)
+            {
+                SimdBayerToBgra(bayer.data, bayer.width, bayer.height, bayer.stride, (SimdPixelFormatType)format, dst.data, dst.stride, 0xFF);
+            });
+        }
+
+        result = result && ParallelRowsAutoTest("Nv12ToBgr", width, height, View::Bgr24, [&](View & dst)
+        {
+            SimdNv12ToBgr(y.data, y.stride, uv.data, uv.stride, width, height, dst.data, dst.stride, SimdYuvBt601);
+        });
+
+        result = result && ParallelRowsAutoTest("Nv12ToRgba", width, height, View::Rgba32, [&](View & dst)
+        {
+            SimdNv12ToRgba(y.data, y.stride, uv.data, uv.stride, width, height, dst.data, dst.stride, 0xFF, SimdYuvBt709);
+        });
+
+        result = result && ParallelRowsAutoTest("Yuv420pToBgr", width, height, View::Bgr24, [&](View & dst)
+        {
+            SimdYuv420pToBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, dst.data, dst.stride);
+        });
+
+        result = result && ParallelRowsAutoTest("Yuv420pToBgraV2", width, height, View::Bgra32, [&](View & dst)
+        {
+            SimdYuv420pToBgraV2(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, dst.data, dst.stride, 0xFF, SimdYuvBt709);
+        });
+
+        result = result && ParallelRowsAutoTest("Yuv422pToBgra", width, height, View::Bgra32, [&](View & dst)
+        {
+            SimdYuv422pToBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, dst.data, dst.stride, 0xFF);
+        });
+
+        result = result && ParallelRowsAutoTest("Yuv444pToRgb", width, height, View::Rgb24, [&](View & dst)
+        {
+            SimdYuv444pToRgb(y.data, y.stride, u.data, u.stride, v.data, v.stride, width, height, dst.data, dst.stride);
+        });
+
+        return result;
+    }
+
+    bool ParallelRowsAutoTest()
+    {
+        bool result = true;
+
+        {
+            ParallelRowsMode mode(4, 1);
+            if (SimdGetThreadNumber() < 2)
+                TEST_LOG_SS(Info, "Only one thread is available: ParallelRowsAutoTest does not check multithreaded processing of rows!");
+        }
+
+        result = result && ParallelRowsAutoTest(W, H);
+        result = result && ParallelRowsAutoTest(W + E, H - E);
+
+        return result;
+    }
+}
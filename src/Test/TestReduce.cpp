@@ -321,6 +321,95 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncRM
+        {
+            typedef void(*FuncPtr)(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+                uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride);
+
+            FuncPtr func;
+            String description;
+
+            FuncRM(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & src, const View & dstSrc, View & dstDst) const
+            {
+                Simd::Copy(dstSrc, dstDst);
+                TEST_PERFORMANCE_TEST(description);
+                func(src.data, src.width, src.height, src.stride, dstDst.data, dstDst.width, dstDst.height, dstDst.stride);
+            }
+        };
+    }
+
+#define FUNC_RM(function) FuncRM(function, #function)
+
+    bool ReduceGray4x4MaxAutoTest(int width, int height, const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << width << ", " << height << "].");
+
+        const int reducedWidth = (width + 1) / 2;
+        const int reducedHeight = (height + 1) / 2;
+
+        View s(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(s);
+
+        View d(reducedWidth, reducedHeight, View::Gray8, NULL, TEST_ALIGN(reducedWidth));
+        FillRandom(d);
+
+        View d1(reducedWidth, reducedHeight, View::Gray8, NULL, TEST_ALIGN(reducedWidth));
+        View d2(reducedWidth, reducedHeight, View::Gray8, NULL, TEST_ALIGN(reducedWidth));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(s, d, d1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(s, d, d2));
+
+        result = result && Compare(d1, d2, 0, true, 64);
+
+        return result;
+    }
+
+    bool ReduceGray4x4MaxAutoTest(const FuncRM & f1, const FuncRM & f2)
+    {
+        bool result = true;
+
+        result = result && ReduceGray4x4MaxAutoTest(W, H, f1, f2);
+        result = result && ReduceGray4x4MaxAutoTest(W + E, H - E, f1, f2);
+
+        return result;
+    }
+
+    bool ReduceGray4x4MaxAutoTest()
+    {
+        bool result = true;
+
+        result = result && ReduceGray4x4MaxAutoTest(FUNC_RM(Simd::Base::ReduceGray4x4Max), FUNC_RM(SimdReduceGray4x4Max));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W > Simd::Sse41::A)
+            result = result && ReduceGray4x4MaxAutoTest(FUNC_RM(Simd::Sse41::ReduceGray4x4Max), FUNC_RM(SimdReduceGray4x4Max));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W > Simd::Avx2::DA)
+            result = result && ReduceGray4x4MaxAutoTest(FUNC_RM(Simd::Avx2::ReduceGray4x4Max), FUNC_RM(SimdReduceGray4x4Max));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W > Simd::Avx512bw::DA)
+            result = result && ReduceGray4x4MaxAutoTest(FUNC_RM(Simd::Avx512bw::ReduceGray4x4Max), FUNC_RM(SimdReduceGray4x4Max));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable && W > Simd::Neon::DA)
+            result = result && ReduceGray4x4MaxAutoTest(FUNC_RM(Simd::Neon::ReduceGray4x4Max), FUNC_RM(SimdReduceGray4x4Max));
+#endif 
+
+        return result;
+    }
+
     bool ReduceGray5x5AutoTest()
     {
         bool result = true;
@@ -561,4 +561,129 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncYR
+        {
+            typedef void*(*FuncPtr)(size_t srcX, size_t srcY, size_t dstX, size_t dstY, SimdPixelFormatType format, SimdYuvType yuvType, SimdResizeMethodType method);
+
+            FuncPtr func;
+            String description;
+
+            FuncYR(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdResizeMethodType method, View::Format format, bool nv12)
+            {
+                description = description + "[" + (nv12 ? "nv12" : "yuv420p") + "->" + FormatDescription(format) + ":" + ToString(method) + "]";
+            }
+
+            void Call(const View& y, const View& u, const View& v, View& dst, SimdYuvType yuvType, SimdResizeMethodType method) const
+            {
+                void* resizer = func(y.width, y.height, dst.width, dst.height, (SimdPixelFormatType)dst.format, yuvType, method);
+                if (resizer)
+                {
+                    {
+                        TEST_PERFORMANCE_TEST(description);
+                        SimdYuv420pResizerRun(resizer, y.data, y.stride, u.data, u.stride, v.data, v.stride, dst.data, dst.stride);
+                    }
+                    SimdRelease(resizer);
+                }
+            }
+        };
+    }
+
+#define FUNC_YR(function) \
+    FuncYR(function, std::string(#function))
+
+    bool Yuv420pResizerAutoTest(SimdResizeMethodType method, View::Format format, bool nv12, SimdYuvType yuvType, size_t srcW, size_t srcH, size_t dstW, size_t dstH, FuncYR f1, FuncYR f2)
+    {
+        bool result = true;
+
+        f1.Update(method, format, nv12);
+        f2.Update(method, format, nv12);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << srcW << ", " << srcH << "] -> [" << dstW << ", " << dstH << "].");
+
+        View y(srcW, srcH, View::Gray8, NULL, TEST_ALIGN(srcW));
+        FillRandom(y);
+        View u, v;
+        if (nv12)
+            u.Recreate(srcW / 2, srcH / 2, View::Uv16, NULL, TEST_ALIGN(srcW));
+        else
+        {
+            u.Recreate(srcW / 2, srcH / 2, View::Gray8, NULL, TEST_ALIGN(srcW));
+            v.Recreate(srcW / 2, srcH / 2, View::Gray8, NULL, TEST_ALIGN(srcW));
+            FillRandom(v);
+        }
+        FillRandom(u);
+
+        View dst1(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        View dst2(dstW, dstH, format, NULL, TEST_ALIGN(dstW));
+        Simd::Fill(dst1, 0x01);
+        Simd::Fill(dst2, 0x02);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, dst1, yuvType, method));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, dst2, yuvType, method));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Yuv420pResizerAutoTest(SimdResizeMethodType method, View::Format format, bool nv12, const FuncYR& f1, const FuncYR& f2)
+    {
+        bool result = true;
+
+        result = result && Yuv420pResizerAutoTest(method, format, nv12, SimdYuvBt601, 1920, 1080, 640, 360, f1, f2);
+        result = result && Yuv420pResizerAutoTest(method, format, nv12, SimdYuvBt709, 1280, 720, 302, 170, f1, f2);
+        result = result && Yuv420pResizerAutoTest(method, format, nv12, SimdYuvTrect871, 352, 240, 500, 330, f1, f2);
+
+        return result;
+    }
+
+    bool Yuv420pResizerAutoTest(const FuncYR& f1, const FuncYR& f2)
+    {
+        bool result = true;
+
+        std::vector<SimdResizeMethodType> methods = { SimdResizeMethodBilinear, SimdResizeMethodArea };
+        std::vector<View::Format> formats = { View::Gray8, View::Bgr24, View::Bgra32, View::Rgb24, View::Rgba32 };
+        for (size_t m = 0; m < methods.size(); ++m)
+        {
+            for (size_t f = 0; f < formats.size(); ++f)
+            {
+                result = result && Yuv420pResizerAutoTest(methods[m], formats[f], true, f1, f2);
+                result = result && Yuv420pResizerAutoTest(methods[m], formats[f], false, f1, f2);
+            }
+        }
+
+        return result;
+    }
+
+    bool Yuv420pResizerAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv420pResizerAutoTest(FUNC_YR(Simd::Base::ResizerYuv420pInit), FUNC_YR(SimdYuv420pResizerInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && Yuv420pResizerAutoTest(FUNC_YR(Simd::Sse41::ResizerYuv420pInit), FUNC_YR(SimdYuv420pResizerInit));
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && Yuv420pResizerAutoTest(FUNC_YR(Simd::Avx2::ResizerYuv420pInit), FUNC_YR(SimdYuv420pResizerInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv420pResizerAutoTest(FUNC_YR(Simd::Avx512bw::ResizerYuv420pInit), FUNC_YR(SimdYuv420pResizerInit));
+#endif
+
+        return result;
+    }
 }
@@ -232,6 +232,58 @@ namespace Test
         return true;
     }
 
+    bool ShiftDetectorBatchSpecialTest()
+    {
+        typedef Simd::ShiftDetector<Simd::Allocator> ShiftDetector;
+
+        ::srand(1);
+
+        Rect region;
+        View background(1920, 1080, View::Gray8);
+        if (!CreateBackground(background, region))
+            return false;
+
+        const Point shift(7, -5);
+        View current(background.Size(), View::Gray8);
+        Simd::Fill(current, 0);
+        Simd::Copy(background.Region(Rect(0, -shift.y, background.width - shift.x, background.height)),
+            current.Region(Rect(shift.x, 0, background.width, background.height + shift.y)).Ref());
+
+        ShiftDetector shiftDetector;
+        shiftDetector.InitBuffers(background.Size(), 4, ShiftDetector::TextureGray, ShiftDetector::SquaredDifference);
+        shiftDetector.SetBackground(background);
+
+        ShiftDetector::Rects regions;
+        for (ptrdiff_t y = 128; y + 128 <= current.height - 128; y += 128)
+            for (ptrdiff_t x = 128; x + 128 <= current.width - 128; x += 128)
+                regions.push_back(ShiftDetector::Rect(x, y, x + 128, y + 128));
+
+        ShiftDetector::Results results;
+        double time = GetTime();
+        shiftDetector.Estimate(current, regions, ShiftDetector::Points(1, ShiftDetector::Point(32, 32)), results);
+        TEST_LOG_SS(Info, "Batch estimate of " << regions.size() << " regions : " << (GetTime() - time) * 1000 << " ms ");
+
+        time = GetTime();
+        for (size_t i = 0; i < regions.size(); ++i)
+        {
+            bool found = shiftDetector.Estimate(current.Region(regions[i]), regions[i], 32);
+            if (found != results[i].found || (found && shiftDetector.Shift() != results[i].shift))
+            {
+                TEST_LOG_SS(Error, "Batch and single estimations of region " << i << " are different!");
+                return false;
+            }
+            if (!found || results[i].shift != shift)
+            {
+                TEST_LOG_SS(Error, "Detected shift (" << results[i].shift.x << ", " << results[i].shift.y << ") of region " << i
+                    << " is not equal to original shift (" << shift.x << ", " << shift.y << ") !");
+                return false;
+            }
+        }
+        TEST_LOG_SS(Info, "Single estimate of " << regions.size() << " regions : " << (GetTime() - time) * 1000 << " ms ");
+
+        return true;
+    }
+
     bool ShiftDetectorFileSpecialTest()
     {
         typedef Simd::ShiftDetector<Simd::Allocator> ShiftDetector;
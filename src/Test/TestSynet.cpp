@@ -29,6 +29,7 @@
 #include "Test/TestRandom.h"
 
 #include "Simd/SimdSynet.h"
+#include "Simd/SimdSynetSoftmax32f.h"
 
 namespace Test
 {
@@ -686,6 +687,131 @@ namespace Test
 
     //-------------------------------------------------------------------------
 
+    namespace
+    {
+        struct FuncS32f
+        {
+            typedef void* (*FuncPtr)(size_t outer, size_t count, size_t inner, SimdTensorFormatType format);
+
+            FuncPtr func;
+            String desc;
+
+            FuncS32f(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t outer, size_t count, size_t inner, SimdTensorFormatType format)
+            {
+                desc = desc + "[" + ToString(outer) + "-" + ToString(count) + "-" + ToString(inner) + "-" + ToString(format) + "]";
+            }
+
+            void Call(void* context, const Tensor32f& src, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdSynetSoftmax32fForward(context, src.Data(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_S32F(function) FuncS32f(function, #function)
+
+    static void SynetSoftmax32fToNchw(const Tensor32f& src, size_t outer, size_t count, size_t inner, SimdTensorFormatType format, Tensor32f& dst)
+    {
+        size_t block = Simd::Base::SynetSoftmax32fBlock(count, format), size = Simd::DivHi(count, block) * block * inner;
+        for (size_t o = 0; o < outer; ++o)
+            for (size_t c = 0; c < count; ++c)
+                for (size_t i = 0; i < inner; ++i)
+                    dst.Data()[(o * count + c) * inner + i] = src.Data()[o * size + (c / block * inner + i) * block + c % block];
+    }
+
+    bool SynetSoftmax32fAutoTest(size_t outer, size_t count, size_t inner, SimdTensorFormatType format, FuncS32f f1, FuncS32f f2)
+    {
+        bool result = true;
+
+        f1.Update(outer, count, inner, format);
+        f2.Update(outer, count, inner, format);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        size_t block = Simd::Base::SynetSoftmax32fBlock(count, format), size = Simd::DivHi(count, block) * block * inner;
+        Tensor32f src({ outer, size });
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f dst1({ outer, size });
+        Tensor32f dst2({ outer, size });
+
+        void* context1 = f1.func(outer, count, inner, format);
+        void* context2 = f2.func(outer, count, inner, format);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+
+        if (result && format != SimdTensorFormatNchw)
+        {
+            Tensor32f src0({ outer, count, inner }), dst0({ outer, count, inner }), ref0({ outer, count, inner });
+            SynetSoftmax32fToNchw(src, outer, count, inner, format, src0);
+            SynetSoftmax32fToNchw(dst1, outer, count, inner, format, dst0);
+            ::SimdSynetSoftmaxLayerForward(src0.Data(), outer, count, inner, ref0.Data());
+            result = result && Compare(dst0, ref0, EPS, true, 64, DifferenceAbsolute);
+        }
+
+        return result;
+    }
+
+    bool SynetSoftmax32fAutoTest(const FuncS32f& f1, const FuncS32f& f2)
+    {
+        bool result = true;
+
+        result = result && SynetSoftmax32fAutoTest(13175, 2, 1, SimdTensorFormatNchw, f1, f2);
+        result = result && SynetSoftmax32fAutoTest(50, 10, 100, SimdTensorFormatNchw, f1, f2);
+        result = result && SynetSoftmax32fAutoTest(1, 21, 19 * 19 * 6, SimdTensorFormatNchw, f1, f2);
+        result = result && SynetSoftmax32fAutoTest(2, 91, 1917, SimdTensorFormatNchw, f1, f2);
+        result = result && SynetSoftmax32fAutoTest(1, 1000, 1, SimdTensorFormatNchw, f1, f2);
+        result = result && SynetSoftmax32fAutoTest(2, 80, 1917, SimdTensorFormatNhwc, f1, f2);
+        result = result && SynetSoftmax32fAutoTest(1, 21, 19 * 19 * 6, SimdTensorFormatNchw4c, f1, f2);
+        result = result && SynetSoftmax32fAutoTest(2, 91, 1917, SimdTensorFormatNchw8c, f1, f2);
+        result = result && SynetSoftmax32fAutoTest(1, 80, 100 * 100, SimdTensorFormatNchw16c, f1, f2);
+
+        return result;
+    }
+
+    bool SynetSoftmax32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetSoftmax32fAutoTest(FUNC_S32F(Simd::Base::SynetSoftmax32fInit), FUNC_S32F(SimdSynetSoftmax32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetSoftmax32fAutoTest(FUNC_S32F(Simd::Sse41::SynetSoftmax32fInit), FUNC_S32F(SimdSynetSoftmax32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetSoftmax32fAutoTest(FUNC_S32F(Simd::Avx2::SynetSoftmax32fInit), FUNC_S32F(SimdSynetSoftmax32fInit));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetSoftmax32fAutoTest(FUNC_S32F(Simd::Avx512bw::SynetSoftmax32fInit), FUNC_S32F(SimdSynetSoftmax32fInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetSoftmax32fAutoTest(FUNC_S32F(Simd::Neon::SynetSoftmax32fInit), FUNC_S32F(SimdSynetSoftmax32fInit));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
     SIMD_INLINE String ToString(SimdSynetUnaryOperation32fType type)
     {
         switch (type)
@@ -0,0 +1,331 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdSynet.h"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    static void FillBoxes(Tensor32f& box, float lo, float hi, float size)
+    {
+        float* data = box.Data();
+        for (size_t i = 0, n = box.Size() / 4; i < n; ++i, data += 4)
+        {
+            float w = size * float(0.2 + 0.8 * Random()), h = size * float(0.2 + 0.8 * Random());
+            data[0] = lo + float(Random()) * (hi - lo - w);
+            data[1] = lo + float(Random()) * (hi - lo - h);
+            data[2] = data[0] + w;
+            data[3] = data[1] + h;
+        }
+    }
+
+    namespace
+    {
+        struct FuncDD
+        {
+            typedef void(*FuncPtr)(const float* loc, const float* anchor, const float* variance, size_t count, float* box);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDD(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t count)
+            {
+                desc = desc + "[" + ToString(count) + "]";
+            }
+
+            void Call(const Tensor32f& loc, const Tensor32f& anchor, const float* variance, Tensor32f& box) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(loc.Data(), anchor.Data(), variance, loc.Size() / 4, box.Data());
+            }
+        };
+    }
+
+#define FUNC_DD(function) FuncDD(function, #function)
+
+    bool SynetDetectionDecode32fAutoTest(size_t count, FuncDD f1, FuncDD f2)
+    {
+        bool result = true;
+
+        f1.Update(count);
+        f2.Update(count);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f loc(Shp(count, 4)), anchor(Shp(count, 4)), box1(Shp(count, 4)), box2(Shp(count, 4));
+        FillRandom(loc.Data(), loc.Size(), -2.0f, 2.0f);
+        FillBoxes(anchor, 0.0f, 1.0f, 0.3f);
+        const float variance[4] = { 0.1f, 0.1f, 0.2f, 0.2f };
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(loc, anchor, variance, box1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(loc, anchor, variance, box2));
+
+        result = result && Compare(box1, box2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetDetectionDecode32fAutoTest(const FuncDD& f1, const FuncDD& f2)
+    {
+        bool result = true;
+
+        result = result && SynetDetectionDecode32fAutoTest(8732, f1, f2);
+        result = result && SynetDetectionDecode32fAutoTest(1917, f1, f2);
+
+        return result;
+    }
+
+    bool SynetDetectionDecode32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetDetectionDecode32fAutoTest(FUNC_DD(Simd::Base::SynetDetectionDecode32f), FUNC_DD(SimdSynetDetectionDecode32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetDetectionDecode32fAutoTest(FUNC_DD(Simd::Sse41::SynetDetectionDecode32f), FUNC_DD(SimdSynetDetectionDecode32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetDetectionDecode32fAutoTest(FUNC_DD(Simd::Avx2::SynetDetectionDecode32f), FUNC_DD(SimdSynetDetectionDecode32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetDetectionDecode32fAutoTest(FUNC_DD(Simd::Avx512bw::SynetDetectionDecode32f), FUNC_DD(SimdSynetDetectionDecode32f));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDF
+        {
+            typedef size_t(*FuncPtr)(const float* score, size_t size, float threshold, uint32_t* index);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDF(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t size, float threshold)
+            {
+                desc = desc + "[" + ToString(size) + "-" + ToString(threshold, 2, false) + "]";
+            }
+
+            void Call(const Tensor32f& score, float threshold, Tensor32i& index, size_t & count) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                count = func(score.Data(), score.Size(), threshold, (uint32_t*)index.Data());
+            }
+        };
+    }
+
+#define FUNC_DF(function) FuncDF(function, #function)
+
+    bool SynetDetectionFilter32fAutoTest(size_t size, float threshold, FuncDF f1, FuncDF f2)
+    {
+        bool result = true;
+
+        f1.Update(size, threshold);
+        f2.Update(size, threshold);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f score(Shp(size));
+        FillRandom(score.Data(), score.Size(), 0.0f, 1.0f);
+        Tensor32i index1(Shp(size)), index2(Shp(size));
+        size_t count1 = 0, count2 = 0;
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(score, threshold, index1, count1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(score, threshold, index2, count2));
+
+        if (count1 != count2)
+        {
+            TEST_LOG_SS(Error, "Different number of selected scores: " << count1 << " != " << count2 << " !");
+            return false;
+        }
+        index1.Reshape(Shp(count1));
+        index2.Reshape(Shp(count2));
+        result = result && Compare(index1, index2, 0, true, 64);
+
+        return result;
+    }
+
+    bool SynetDetectionFilter32fAutoTest(const FuncDF& f1, const FuncDF& f2)
+    {
+        bool result = true;
+
+        result = result && SynetDetectionFilter32fAutoTest(8732, 0.95f, f1, f2);
+        result = result && SynetDetectionFilter32fAutoTest(25200, 0.50f, f1, f2);
+        result = result && SynetDetectionFilter32fAutoTest(1917, 0.99f, f1, f2);
+
+        return result;
+    }
+
+    bool SynetDetectionFilter32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetDetectionFilter32fAutoTest(FUNC_DF(Simd::Base::SynetDetectionFilter32f), FUNC_DF(SimdSynetDetectionFilter32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetDetectionFilter32fAutoTest(FUNC_DF(Simd::Sse41::SynetDetectionFilter32f), FUNC_DF(SimdSynetDetectionFilter32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetDetectionFilter32fAutoTest(FUNC_DF(Simd::Avx2::SynetDetectionFilter32f), FUNC_DF(SimdSynetDetectionFilter32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetDetectionFilter32fAutoTest(FUNC_DF(Simd::Avx512bw::SynetDetectionFilter32f), FUNC_DF(SimdSynetDetectionFilter32f));
+#endif
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncDN
+        {
+            typedef size_t(*FuncPtr)(const float* box, const float* score, const int32_t* label, size_t count, float threshold, size_t topK, uint32_t* index);
+
+            FuncPtr func;
+            String desc;
+
+            FuncDN(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t count, size_t classes, float threshold, size_t topK)
+            {
+                desc = desc + "[" + ToString(count) + "-" + ToString(classes) + "-" + ToString(threshold, 2, false) + "-" + ToString(topK) + "]";
+            }
+
+            void Call(const Tensor32f& box, const Tensor32f& score, const Tensor32i& label, float threshold, size_t topK, Tensor32i& index, size_t& count) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                count = func(box.Data(), score.Data(), label.Size() ? label.Data() : NULL, score.Size(), threshold, topK, (uint32_t*)index.Data());
+            }
+        };
+    }
+
+#define FUNC_DN(function) FuncDN(function, #function)
+
+    bool SynetDetectionNms32fAutoTest(size_t count, size_t classes, float threshold, size_t topK, FuncDN f1, FuncDN f2)
+    {
+        bool result = true;
+
+        f1.Update(count, classes, threshold, topK);
+        f2.Update(count, classes, threshold, topK);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        Tensor32f box(Shp(count, 4)), score(Shp(count));
+        FillBoxes(box, 0.0f, 1.0f, 0.2f);
+        FillRandom(score.Data(), score.Size(), 0.0f, 1.0f);
+        Tensor32i label;
+        if (classes > 1)
+        {
+            label.Reshape(Shp(count));
+            FillRandom(label, 0, int32_t(classes - 1));
+        }
+        Tensor32i index1(Shp(count)), index2(Shp(count));
+        size_t count1 = 0, count2 = 0;
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(box, score, label, threshold, topK, index1, count1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(box, score, label, threshold, topK, index2, count2));
+
+        if (count1 != count2)
+        {
+            TEST_LOG_SS(Error, "Different number of kept boxes: " << count1 << " != " << count2 << " !");
+            return false;
+        }
+        index1.Reshape(Shp(count1));
+        index2.Reshape(Shp(count2));
+        result = result && Compare(index1, index2, 0, true, 64);
+
+        return result;
+    }
+
+    bool SynetDetectionNms32fAutoTest(const FuncDN& f1, const FuncDN& f2)
+    {
+        bool result = true;
+
+        result = result && SynetDetectionNms32fAutoTest(1000, 1, 0.45f, 0, f1, f2);
+        result = result && SynetDetectionNms32fAutoTest(2000, 20, 0.45f, 200, f1, f2);
+        result = result && SynetDetectionNms32fAutoTest(777, 80, 0.60f, 100, f1, f2);
+
+        return result;
+    }
+
+    bool SynetDetectionNms32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetDetectionNms32fAutoTest(FUNC_DN(Simd::Base::SynetDetectionNms32f), FUNC_DN(SimdSynetDetectionNms32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetDetectionNms32fAutoTest(FUNC_DN(Simd::Sse41::SynetDetectionNms32f), FUNC_DN(SimdSynetDetectionNms32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetDetectionNms32fAutoTest(FUNC_DN(Simd::Avx2::SynetDetectionNms32f), FUNC_DN(SimdSynetDetectionNms32f));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetDetectionNms32fAutoTest(FUNC_DN(Simd::Avx512bw::SynetDetectionNms32f), FUNC_DN(SimdSynetDetectionNms32f));
+#endif
+
+        return result;
+    }
+#endif
+}
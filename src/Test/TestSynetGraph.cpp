@@ -0,0 +1,175 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestTensor.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdSynetGraph.hpp"
+
+namespace Test
+{
+#if defined(SIMD_SYNET_ENABLE)
+    namespace
+    {
+        struct Conv
+        {
+            SimdConvolutionParameters param;
+            Tensor32f weight, bias;
+            void * context;
+
+            Conv(size_t srcC, size_t srcH, size_t srcW, size_t dstC, size_t kernel, SimdConvolutionActivationType activation)
+            {
+                param.srcC = srcC;
+                param.srcH = srcH;
+                param.srcW = srcW;
+                param.srcT = SimdTensorData32f;
+                param.srcF = SimdTensorFormatNhwc;
+                param.dstC = dstC;
+                param.dstH = srcH;
+                param.dstW = srcW;
+                param.dstT = SimdTensorData32f;
+                param.dstF = SimdTensorFormatNhwc;
+                param.kernelY = kernel;
+                param.kernelX = kernel;
+                param.dilationY = 1;
+                param.dilationX = 1;
+                param.strideY = 1;
+                param.strideX = 1;
+                param.padY = kernel / 2;
+                param.padX = kernel / 2;
+                param.padH = kernel / 2;
+                param.padW = kernel / 2;
+                param.group = 1;
+                param.activation = activation;
+                weight.Reshape(Shp(kernel, kernel, srcC, dstC));
+                FillRandom(weight.Data(), weight.Size(), -1.0f, 1.0f);
+                bias.Reshape(Shp(dstC));
+                FillRandom(bias.Data(), bias.Size(), -1.0f, 1.0f);
+                context = SimdSynetConvolution32fInit(1, &param, SimdSynetCompatibilityDefault);
+                SimdSynetConvolution32fSetParams(context, weight.Data(), NULL, bias.Data(), NULL);
+            }
+
+            ~Conv()
+            {
+                SimdRelease(context);
+            }
+
+            size_t SrcSize() const 
+            { 
+                return param.srcC * param.srcH * param.srcW; 
+            }
+
+            size_t DstSize() const 
+            { 
+                return param.dstC * param.dstH * param.dstW; 
+            }
+
+            void Forward(const float * src, float * dst) const
+            {
+                Tensor32f buf(Shp(SimdSynetConvolution32fExternalBufferSize(context)));
+                SimdSynetConvolution32fForward(context, src, buf.Data(), dst);
+            }
+        };
+    }
+
+    bool SynetGraphAutoTest(size_t channels, size_t height, size_t width)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test SynetGraph [" << channels << "x" << height << "x" << width << "].");
+
+        typedef Simd::SynetGraph<Simd::Allocator> Graph;
+
+        size_t poolH = height / 2, poolW = width / 2;
+        Conv conv0(channels, height, width, channels * 2, 3, SimdConvolutionActivationRelu);
+        void * pool = SimdSynetPooling32fInit(1, channels * 2, height, width, 2, 2, 2, 2, 0, 0, poolH, poolW, SimdSynetPoolingMethodMax, SimdTrue, SimdTensorFormatNhwc);
+        Conv conv1(channels * 2, poolH, poolW, channels * 2, 1, SimdConvolutionActivationIdentity);
+        Conv conv2(channels * 2, poolH, poolW, channels * 2, 3, SimdConvolutionActivationIdentity);
+        void * softmax = SimdSynetSoftmax32fInit(poolH * poolW, channels * 2, 1, SimdTensorFormatNchw);
+        size_t poolSize = poolH * poolW * channels * 2;
+
+        Tensor32f src(Shp(conv0.SrcSize()));
+        FillRandom(src.Data(), src.Size(), -1.0f, 1.0f);
+
+        Tensor32f ref0(Shp(conv0.DstSize())), ref1(Shp(poolSize)), ref2(Shp(poolSize)), ref3(Shp(poolSize)), ref4(Shp(poolSize)), ref5(Shp(poolSize));
+        conv0.Forward(src.Data(), ref0.Data());
+        SimdSynetPooling32fForward(pool, ref0.Data(), ref1.Data());
+        conv1.Forward(ref1.Data(), ref2.Data());
+        conv2.Forward(ref1.Data(), ref3.Data());
+        const float * refs[2] = { ref2.Data(), ref3.Data() };
+        const float weights[2] = { 1.0f, 1.0f };
+        SimdSynetEltwiseLayerForward(refs, weights, 2, poolSize, SimdSynetEltwiseOperationSum, ref4.Data());
+        SimdSynetSoftmax32fForward(softmax, ref4.Data(), ref5.Data());
+
+        Graph graph;
+        size_t t0 = graph.AddInput(conv0.SrcSize());
+        size_t t1 = graph.AddConvolution32f(conv0.context, t0, conv0.DstSize());
+        size_t t2 = graph.AddPooling32f(pool, t1, poolSize);
+        size_t t3 = graph.AddConvolution32f(conv1.context, t2, poolSize);
+        size_t t4 = graph.AddConvolution32f(conv2.context, t2, poolSize);
+        size_t t5 = graph.AddLayer([poolSize, weights](const float* const* s, float* b, float* d) {
+            SimdSynetEltwiseLayerForward(s, weights, 2, poolSize, SimdSynetEltwiseOperationSum, d); }, Graph::Ids({ t3, t4 }), poolSize);
+        size_t t6 = graph.AddSoftmax32f(softmax, t5, poolSize, true);
+        graph.MarkOutput(t6);
+        result = result && graph.Plan();
+
+        memcpy(graph.Data(t0), src.Data(), src.Size() * sizeof(float));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(graph.Run());
+
+        if (graph.Data(t6) != graph.Data(t5))
+        {
+            TEST_LOG_SS(Error, "SynetGraph: in-place softmax does not reuse memory of its input!");
+            result = false;
+        }
+        if (graph.ArenaSize() >= graph.TotalSize())
+        {
+            TEST_LOG_SS(Error, "SynetGraph: arena size " << graph.ArenaSize() << " is not less than total size " << graph.TotalSize() << " !");
+            result = false;
+        }
+        TEST_LOG_SS(Info, "SynetGraph: arena size " << graph.ArenaSize() << ", total size " << graph.TotalSize() << ".");
+
+        Tensor32f dst(Shp(poolSize));
+        memcpy(dst.Data(), graph.Data(t6), dst.Size() * sizeof(float));
+        result = result && Compare(ref5, dst, EPS, true, 64, DifferenceBoth);
+
+        SimdRelease(pool);
+        SimdRelease(softmax);
+
+        return result;
+    }
+
+    bool SynetGraphAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetGraphAutoTest(16, 32, 32);
+        result = result && SynetGraphAutoTest(24, 38, 46);
+
+        return result;
+    }
+#endif
+}
@@ -294,6 +294,9 @@ namespace Test
         result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(Shp(1, 256, 10, 6), Cnv(a0, 1, 1, 64), Cnv(a1, 3, 2), Cnv(a2, 1, 1, 256), f), c, f1, f2);
         result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(Shp(1, 128, 20, 12), Cnv(a0, 3, 1), Cnv(a1, 1, 1, 20)), c, f1, f2);
         result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(Shp(1, 128, 20, 12), Cnv(a0, 3, 1), Cnv(a1, 1, 1, 128)), c, f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps * 2.0f, Param(Shp(4, 320, 7, 9), Cnv(a0, 1, 1, 1280), Cnv(a1, 3, 1), Cnv(a2, 1, 1, 320), t), c, f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps * 2.0f, Param(Shp(3, 512, 6, 8), Cnv(a0, 1, 1, 1024), Cnv(a1, 3, 1)), c, f1, f2);
+        result = result && SynetMergedConvolution32fForwardAutoTest(eps * 2.0f, Param(Shp(3, 1024, 6, 8), Cnv(a0, 3, 1), Cnv(a1, 1, 1, 512)), c, f1, f2);
 #endif
 #if 1
         //result = result && SynetMergedConvolution32fForwardAutoTest(eps, Param(Shp(1, 728, 28, 28), Cnv(a0, 1, 1, 728), Cnv(a1, 3, 1), Cnv(a2, 1, 1, 728), f), c, f1, f2);
@@ -138,5 +138,225 @@ namespace Test
 
         return result;
     }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSNLF2
+        {
+            typedef void(*FuncPtr)(const float* src, size_t batch, size_t channels, size_t spatial, const float* scale, const float* shift,
+                const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSNLF2(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, SimdConvolutionActivationType activation)
+            {
+                desc = desc + "[" + ToString(batch) + "x" + ToString(channels) + "x" + ToString(spatial) + "-"
+                    + ToString(format) + "-" + ToString(activation) + "]";
+            }
+
+            void Call(const Tensor32f& src, size_t batch, size_t channels, size_t spatial, const Tensor32f& scale, const Tensor32f& shift,
+                float eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const Tensor32f& params, Tensor32f& buf, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), batch, channels, spatial, scale.Data(), shift.Data(), &eps, format, activation, params.Data(), buf.Data(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_SNLF2(function) FuncSNLF2(function, #function)
+
+    bool SynetNormalizeLayerForwardV2AutoTest(size_t batch, size_t channels, size_t spatial, SimdTensorFormatType format, 
+        SimdConvolutionActivationType activation, int extBuf, FuncSNLF2 f1, FuncSNLF2 f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, channels, spatial, format, activation);
+        f2.Update(batch, channels, spatial, format, activation);
+
+        const float eps = 0.0001f;
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << batch << ", " << channels << ", " << spatial << "].");
+
+        Tensor32f src(ToShape(batch, channels, 1, spatial, format));
+        Tensor32f scale(ToShape(channels));
+        Tensor32f shift(ToShape(channels));
+        Tensor32f params(ToShape(Simd::Max<size_t>(channels, 2)));
+        Tensor32f buf;
+        if (extBuf)
+            buf.Reshape(ToShape(spatial * 2));
+        Tensor32f dst1(ToShape(batch, channels, 1, spatial, format));
+        Tensor32f dst2(ToShape(batch, channels, 1, spatial, format));
+
+        FillRandom(src.Data(), src.Size(), -10.0, 10.0);
+        FillRandom(scale.Data(), scale.Size(), -10.0, 10.0);
+        FillRandom(shift.Data(), shift.Size(), -10.0, 10.0);
+        FillRandom(params.Data(), params.Size(), -1.0, 1.0);
+        if (activation != SimdConvolutionActivationPrelu)
+            params.Data()[0] = -1.0f, params.Data()[1] = 1.0f;
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, batch, channels, spatial, scale, shift, eps, format, activation, params, buf, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, batch, channels, spatial, scale, shift, eps, format, activation, params, buf, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetNormalizeLayerForwardV2AutoTest(const FuncSNLF2& f1, const FuncSNLF2& f2)
+    {
+        bool result = true;
+
+        SimdTensorFormatType formats[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        SimdConvolutionActivationType a0 = SimdConvolutionActivationIdentity, a1 = SimdConvolutionActivationPrelu, a2 = SimdConvolutionActivationGelu;
+
+        for (int f = 0; f < 2; f++)
+        {
+            result = result && SynetNormalizeLayerForwardV2AutoTest(1, C, W, formats[f], a0, 1, f1, f2);
+            result = result && SynetNormalizeLayerForwardV2AutoTest(8, C, W, formats[f], a1, 1, f1, f2);
+            result = result && SynetNormalizeLayerForwardV2AutoTest(7, C - O, W + O, formats[f], a2, 0, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SynetNormalizeLayerForwardV2AutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetNormalizeLayerForwardV2AutoTest(FUNC_SNLF2(Simd::Base::SynetNormalizeLayerForwardV2), FUNC_SNLF2(SimdSynetNormalizeLayerForwardV2));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetNormalizeLayerForwardV2AutoTest(FUNC_SNLF2(Simd::Sse41::SynetNormalizeLayerForwardV2), FUNC_SNLF2(SimdSynetNormalizeLayerForwardV2));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetNormalizeLayerForwardV2AutoTest(FUNC_SNLF2(Simd::Avx2::SynetNormalizeLayerForwardV2), FUNC_SNLF2(SimdSynetNormalizeLayerForwardV2));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetNormalizeLayerForwardV2AutoTest(FUNC_SNLF2(Simd::Avx512bw::SynetNormalizeLayerForwardV2), FUNC_SNLF2(SimdSynetNormalizeLayerForwardV2));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncSNLF3
+        {
+            typedef void(*FuncPtr)(const float* src, size_t batch, size_t channels, size_t spatial, size_t group, const float* scale, const float* shift,
+                const float* eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const float* params, float* buf, float* dst);
+
+            FuncPtr func;
+            String desc;
+
+            FuncSNLF3(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t batch, size_t channels, size_t spatial, size_t group, SimdTensorFormatType format, SimdConvolutionActivationType activation)
+            {
+                desc = desc + "[" + ToString(batch) + "x" + ToString(channels) + "x" + ToString(spatial) + "-" + ToString(group) + "-"
+                    + ToString(format) + "-" + ToString(activation) + "]";
+            }
+
+            void Call(const Tensor32f& src, size_t batch, size_t channels, size_t spatial, size_t group, const Tensor32f& scale, const Tensor32f& shift,
+                float eps, SimdTensorFormatType format, SimdConvolutionActivationType activation, const Tensor32f& params, Tensor32f& buf, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                func(src.Data(), batch, channels, spatial, group, scale.Data(), shift.Data(), &eps, format, activation, params.Data(), buf.Data(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_SNLF3(function) FuncSNLF3(function, #function)
+
+    bool SynetNormalizeLayerForwardV3AutoTest(size_t batch, size_t channels, size_t spatial, size_t group, SimdTensorFormatType format,
+        SimdConvolutionActivationType activation, int extBuf, FuncSNLF3 f1, FuncSNLF3 f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, channels, spatial, group, format, activation);
+        f2.Update(batch, channels, spatial, group, format, activation);
+
+        const float eps = 0.0001f;
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << " [" << batch << ", " << channels << ", " << spatial << ", " << group << "].");
+
+        Tensor32f src(ToShape(batch, channels, 1, spatial, format));
+        Tensor32f scale(ToShape(channels));
+        Tensor32f shift(ToShape(channels));
+        Tensor32f params(ToShape(Simd::Max<size_t>(channels, 2)));
+        Tensor32f buf;
+        if (extBuf)
+            buf.Reshape(ToShape(channels * 2));
+        Tensor32f dst1(ToShape(batch, channels, 1, spatial, format));
+        Tensor32f dst2(ToShape(batch, channels, 1, spatial, format));
+
+        FillRandom(src.Data(), src.Size(), -10.0, 10.0);
+        FillRandom(scale.Data(), scale.Size(), -10.0, 10.0);
+        FillRandom(shift.Data(), shift.Size(), -10.0, 10.0);
+        FillRandom(params.Data(), params.Size(), -1.0, 1.0);
+        if (activation != SimdConvolutionActivationPrelu)
+            params.Data()[0] = -1.0f, params.Data()[1] = 1.0f;
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(src, batch, channels, spatial, group, scale, shift, eps, format, activation, params, buf, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, batch, channels, spatial, group, scale, shift, eps, format, activation, params, buf, dst2));
+
+        result = result && Compare(dst1, dst2, EPS, true, 32, DifferenceBoth);
+
+        return result;
+    }
+
+    bool SynetNormalizeLayerForwardV3AutoTest(const FuncSNLF3& f1, const FuncSNLF3& f2)
+    {
+        bool result = true;
+
+        SimdTensorFormatType formats[2] = { SimdTensorFormatNchw, SimdTensorFormatNhwc };
+        SimdConvolutionActivationType a0 = SimdConvolutionActivationIdentity, a1 = SimdConvolutionActivationPrelu, a2 = SimdConvolutionActivationGelu;
+
+        for (int f = 0; f < 2; f++)
+        {
+            result = result && SynetNormalizeLayerForwardV3AutoTest(1, 64, W, 32, formats[f], a0, 1, f1, f2);
+            result = result && SynetNormalizeLayerForwardV3AutoTest(4, 96, W, 8, formats[f], a1, 1, f1, f2);
+            result = result && SynetNormalizeLayerForwardV3AutoTest(3, 42, W + O, 7, formats[f], a2, 0, f1, f2);
+        }
+
+        return result;
+    }
+
+    bool SynetNormalizeLayerForwardV3AutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetNormalizeLayerForwardV3AutoTest(FUNC_SNLF3(Simd::Base::SynetNormalizeLayerForwardV3), FUNC_SNLF3(SimdSynetNormalizeLayerForwardV3));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetNormalizeLayerForwardV3AutoTest(FUNC_SNLF3(Simd::Sse41::SynetNormalizeLayerForwardV3), FUNC_SNLF3(SimdSynetNormalizeLayerForwardV3));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetNormalizeLayerForwardV3AutoTest(FUNC_SNLF3(Simd::Avx2::SynetNormalizeLayerForwardV3), FUNC_SNLF3(SimdSynetNormalizeLayerForwardV3));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetNormalizeLayerForwardV3AutoTest(FUNC_SNLF3(Simd::Avx512bw::SynetNormalizeLayerForwardV3), FUNC_SNLF3(SimdSynetNormalizeLayerForwardV3));
+#endif 
+
+        return result;
+    }
 #endif
 }
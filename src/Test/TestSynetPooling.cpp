@@ -25,6 +25,9 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestTensor.h"
 #include "Test/TestRandom.h"
+#include "Test/TestString.h"
+
+#include "Simd/SimdSynetPooling32f.h"
 
 namespace Test
 {
@@ -426,5 +429,135 @@ namespace Test
 
         return result;
     }
+
+    //---------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncP32f
+        {
+            typedef void* (*FuncPtr)(size_t batch, size_t channels, size_t srcH, size_t srcW, size_t kernelY, size_t kernelX, size_t strideY, size_t strideX, 
+                size_t padY, size_t padX, size_t dstH, size_t dstW, SimdSynetPoolingMethodType method, SimdBool excludePad, SimdTensorFormatType format);
+
+            FuncPtr func;
+            String desc;
+
+            FuncP32f(const FuncPtr& f, const String& d) : func(f), desc(d) {}
+
+            void Update(size_t batch, const ParamP& p, SimdSynetPoolingMethodType method)
+            {
+                std::stringstream ss;
+                ss << desc;
+                ss << "[" << batch << "x" << p.srcC << "x" << p.srcH << "x" << p.srcW;
+                ss << "-" << p.kernelY << "x" << p.kernelX;
+                ss << "-" << p.strideX << "-" << Simd::Max(p.padX, p.padY) << "-" << (method == SimdSynetPoolingMethodMax ? "max" : "avg");
+                ss << "-" << ToString(p.format) << "]";
+                desc = ss.str();
+            }
+
+            void Call(void* context, const Tensor32f& src, Tensor32f& dst) const
+            {
+                TEST_PERFORMANCE_TEST(desc);
+                SimdSynetPooling32fForward(context, src.Data(), dst.Data());
+            }
+        };
+    }
+
+#define FUNC_P32F(function) FuncP32f(function, #function)
+
+    bool SynetPooling32fAutoTest(size_t batch, const ParamP& p, SimdSynetPoolingMethodType method, FuncP32f f1, FuncP32f f2)
+    {
+        bool result = true;
+
+        f1.Update(batch, p, method);
+        f2.Update(batch, p, method);
+
+        TEST_LOG_SS(Info, "Test " << f1.desc << " & " << f2.desc << ".");
+
+        size_t block = Simd::Base::Pooling32fParam(batch, p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX,
+            p.padY, p.padX, p.dstH, p.dstW, method, p.excludePad, p.format).Block();
+        size_t channels = Simd::DivHi(p.srcC, block) * block;
+        Tensor32f src(Shp(batch * channels * p.srcH * p.srcW));
+        FillRandom(src.Data(), src.Size(), -1.0, 1.0f);
+
+        Tensor32f dst1(Shp(batch * channels * p.dstH * p.dstW));
+        Tensor32f dst2(Shp(batch * channels * p.dstH * p.dstW));
+        Fill(dst1, 1.0f);
+        Fill(dst2, 2.0f);
+
+        void* context1 = f1.func(batch, p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX, p.padY, p.padX, p.dstH, p.dstW, method, p.excludePad, p.format);
+        void* context2 = f2.func(batch, p.srcC, p.srcH, p.srcW, p.kernelY, p.kernelX, p.strideY, p.strideX, p.padY, p.padX, p.dstH, p.dstW, method, p.excludePad, p.format);
+
+        TEST_ALIGN(SIMD_ALIGN);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(context1, src, dst1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(context2, src, dst2));
+
+        ::SimdRelease(context1);
+        ::SimdRelease(context2);
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceAbsolute);
+
+        return result;
+    }
+
+    bool SynetPooling32fAutoTest(::SimdTensorFormatType f, const FuncP32f& f1, const FuncP32f& f2)
+    {
+        bool result = true;
+
+        Size _0(0, 0), _1(1, 1), _2(2, 2), _3(3, 3);
+
+        result = result && SynetPooling32fAutoTest(1, ParamP(64, 76, 76, _2, _2, _0, _0, f, SimdTrue, SimdTrue), SimdSynetPoolingMethodMax, f1, f2);
+        result = result && SynetPooling32fAutoTest(2, ParamP(35, 38, 38, _3, _1, _1, _1, f, SimdTrue, SimdTrue), SimdSynetPoolingMethodMax, f1, f2);
+        result = result && SynetPooling32fAutoTest(1, ParamP(48, 46, 46, _3, _2, _0, _1, f, SimdTrue, SimdFalse), SimdSynetPoolingMethodAverage, f1, f2);
+        result = result && SynetPooling32fAutoTest(3, ParamP(30, 19, 19, _3, _1, _1, _1, f, SimdTrue, SimdTrue), SimdSynetPoolingMethodAverage, f1, f2);
+        result = result && SynetPooling32fAutoTest(1, ParamP(256, 14, 14, Size(14, 14), _1, _0, _0, f, SimdFalse, SimdTrue), SimdSynetPoolingMethodMax, f1, f2);
+        result = result && SynetPooling32fAutoTest(1, ParamP(256, 14, 14, Size(14, 14), _1, _0, _0, f, SimdFalse, SimdTrue), SimdSynetPoolingMethodAverage, f1, f2);
+
+        return result;
+    }
+
+    bool SynetPooling32fAutoTest(const FuncP32f& f1, const FuncP32f& f2)
+    {
+        bool result = true;
+
+        result = result && SynetPooling32fAutoTest(::SimdTensorFormatNchw, f1, f2);
+        result = result && SynetPooling32fAutoTest(::SimdTensorFormatNhwc, f1, f2);
+        result = result && SynetPooling32fAutoTest(::SimdTensorFormatNchw4c, f1, f2);
+        result = result && SynetPooling32fAutoTest(::SimdTensorFormatNchw8c, f1, f2);
+        result = result && SynetPooling32fAutoTest(::SimdTensorFormatNchw16c, f1, f2);
+
+        return result;
+    }
+
+    bool SynetPooling32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && SynetPooling32fAutoTest(FUNC_P32F(Simd::Base::SynetPooling32fInit), FUNC_P32F(SimdSynetPooling32fInit));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable)
+            result = result && SynetPooling32fAutoTest(FUNC_P32F(Simd::Sse41::SynetPooling32fInit), FUNC_P32F(SimdSynetPooling32fInit));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && SynetPooling32fAutoTest(FUNC_P32F(Simd::Avx2::SynetPooling32fInit), FUNC_P32F(SimdSynetPooling32fInit));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && SynetPooling32fAutoTest(FUNC_P32F(Simd::Avx512bw::SynetPooling32fInit), FUNC_P32F(SimdSynetPooling32fInit));
+#endif
+
+#ifdef SIMD_NEON_ENABLE
+        if (Simd::Neon::Enable)
+            result = result && SynetPooling32fAutoTest(FUNC_P32F(Simd::Neon::SynetPooling32fInit), FUNC_P32F(SimdSynetPooling32fInit));
+#endif 
+
+        return result;
+    }
 #endif
 }
@@ -0,0 +1,452 @@
+/*
+* Simd Library (http://ermig1979.github.io/Simd).
+*
+* Copyright (c) 2011-2023 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestCompare.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestString.h"
+#include "Test/TestRandom.h"
+
+#include "Simd/SimdLib.hpp"
+
+namespace Test
+{
+    namespace
+    {
+        struct FuncP010
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, SimdYuvType yuvType);
+            FuncPtr func;
+            String description;
+
+            FuncP010(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, yuvType);
+            }
+        };
+
+        struct FuncP010A
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+            FuncPtr func;
+            String description;
+
+            FuncP010A(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& uv, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, dst.data, dst.stride, alpha, yuvType);
+            }
+        };
+    }
+
+#define FUNC_P010(func) FuncP010(func, #func)
+#define FUNC_P010A(func) FuncP010A(func, #func)
+
+    bool P010ToBgrAutoTest(int width, int height, SimdYuvType yuvType, const FuncP010& f1, const FuncP010& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(y);
+        View uv(width, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(uv);
+
+        View dst1(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool P010ToBgrAutoTest(const FuncP010& f1, const FuncP010& f2)
+    {
+        bool result = true;
+
+        result = result && P010ToBgrAutoTest(W, H, SimdYuvBt601, f1, f2);
+        result = result && P010ToBgrAutoTest(W + E, H - E, SimdYuvBt709, f1, f2);
+        result = result && P010ToBgrAutoTest(W - E, H + E, SimdYuvBt2020, f1, f2);
+
+        return result;
+    }
+
+    bool P010ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && P010ToBgrAutoTest(FUNC_P010(Simd::Base::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && P010ToBgrAutoTest(FUNC_P010(Simd::Sse41::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && P010ToBgrAutoTest(FUNC_P010(Simd::Avx2::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && P010ToBgrAutoTest(FUNC_P010(Simd::Avx512bw::P010ToBgr), FUNC_P010(SimdP010ToBgr));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool P010ToBgraAutoTest(int width, int height, SimdYuvType yuvType, const FuncP010A& f1, const FuncP010A& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(y);
+        View uv(width, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(uv);
+        uint8_t alpha = Random(256);
+
+        View dst1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, dst1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, dst2, alpha, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool P010ToBgraAutoTest(const FuncP010A& f1, const FuncP010A& f2)
+    {
+        bool result = true;
+
+        result = result && P010ToBgraAutoTest(W, H, SimdYuvBt601, f1, f2);
+        result = result && P010ToBgraAutoTest(W + E, H - E, SimdYuvBt709, f1, f2);
+        result = result && P010ToBgraAutoTest(W - E, H + E, SimdYuvTrect871, f1, f2);
+
+        return result;
+    }
+
+    bool P010ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && P010ToBgraAutoTest(FUNC_P010A(Simd::Base::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && P010ToBgraAutoTest(FUNC_P010A(Simd::Sse41::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && P010ToBgraAutoTest(FUNC_P010A(Simd::Avx2::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && P010ToBgraAutoTest(FUNC_P010A(Simd::Avx512bw::P010ToBgra), FUNC_P010A(SimdP010ToBgra));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncP010P
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* uv, size_t uvStride, size_t width, size_t height,
+                const float* lower, const float* upper, float* dst, SimdBool rgb, SimdYuvType yuvType);
+            FuncPtr func;
+            String description;
+
+            FuncP010P(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Update(SimdBool rgb)
+            {
+                description = description + (rgb ? "[rgb]" : "[bgr]");
+            }
+
+            void Call(const View& y, const View& uv, const float* lower, const float* upper, View& dst, SimdBool rgb, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, uv.data, uv.stride, y.width, y.height, lower, upper, (float*)dst.data, rgb, yuvType);
+            }
+        };
+    }
+
+#define FUNC_P010P(func) FuncP010P(func, #func)
+
+    bool P010ToPlanar32fAutoTest(int width, int height, SimdBool rgb, SimdYuvType yuvType, FuncP010P f1, FuncP010P f2)
+    {
+        bool result = true;
+
+        f1.Update(rgb);
+        f2.Update(rgb);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "].");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(y);
+        View uv(width, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandom16u(uv);
+        float lower[3] = { -1.0f, -2.0f, 0.0f }, upper[3] = { 1.0f, 2.0f, 1.0f };
+
+        View dst1(width, height * 3, View::Float, NULL, 1);
+        View dst2(width, height * 3, View::Float, NULL, 1);
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, uv, lower, upper, dst1, rgb, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, uv, lower, upper, dst2, rgb, yuvType));
+
+        result = result && Compare(dst1, dst2, EPS, true, 64, DifferenceBoth);
+
+        return result;
+    }
+
+    bool P010ToPlanar32fAutoTest(const FuncP010P& f1, const FuncP010P& f2)
+    {
+        bool result = true;
+
+        result = result && P010ToPlanar32fAutoTest(W, H, SimdFalse, SimdYuvBt601, f1, f2);
+        result = result && P010ToPlanar32fAutoTest(W + E, H - E, SimdTrue, SimdYuvBt709, f1, f2);
+        result = result && P010ToPlanar32fAutoTest(W - E, H + E, SimdFalse, SimdYuvTrect871, f1, f2);
+
+        return result;
+    }
+
+    bool P010ToPlanar32fAutoTest()
+    {
+        bool result = true;
+
+        result = result && P010ToPlanar32fAutoTest(FUNC_P010P(Simd::Base::P010ToPlanar32f), FUNC_P010P(SimdP010ToPlanar32f));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::F)
+            result = result && P010ToPlanar32fAutoTest(FUNC_P010P(Simd::Sse41::P010ToPlanar32f), FUNC_P010P(SimdP010ToPlanar32f));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::F)
+            result = result && P010ToPlanar32fAutoTest(FUNC_P010P(Simd::Avx2::P010ToPlanar32f), FUNC_P010P(SimdP010ToPlanar32f));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable && W >= Simd::Avx512bw::F)
+            result = result && P010ToPlanar32fAutoTest(FUNC_P010P(Simd::Avx512bw::P010ToPlanar32f), FUNC_P010P(SimdP010ToPlanar32f));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    namespace
+    {
+        struct FuncYuv16
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, SimdYuvType yuvType);
+            FuncPtr func;
+            String description;
+
+            FuncYuv16(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& u, const View& v, size_t bitDepth, View& dst, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, dst.data, dst.stride, yuvType);
+            }
+        };
+
+        struct FuncYuv16A
+        {
+            typedef void(*FuncPtr)(const uint8_t* y, size_t yStride, const uint8_t* u, size_t uStride, const uint8_t* v, size_t vStride,
+                size_t width, size_t height, size_t bitDepth, uint8_t* dst, size_t dstStride, uint8_t alpha, SimdYuvType yuvType);
+            FuncPtr func;
+            String description;
+
+            FuncYuv16A(const FuncPtr& f, const String& d) : func(f), description(d) {}
+
+            void Call(const View& y, const View& u, const View& v, size_t bitDepth, View& dst, uint8_t alpha, SimdYuvType yuvType) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bitDepth, dst.data, dst.stride, alpha, yuvType);
+            }
+        };
+    }
+
+#define FUNC_YUV16(func) FuncYuv16(func, #func)
+#define FUNC_YUV16A(func) FuncYuv16A(func, #func)
+
+    static void FillRandomBits(View& view, size_t bitDepth)
+    {
+        FillRandom16u(view);
+        uint16_t mask = uint16_t((1 << bitDepth) - 1);
+        for (size_t row = 0; row < view.height; ++row)
+        {
+            uint16_t* data = view.Row<uint16_t>(row);
+            for (size_t col = 0; col < view.width; ++col)
+                data[col] &= mask;
+        }
+    }
+
+    bool Yuv420p16ToBgrAutoTest(int width, int height, size_t bitDepth, SimdYuvType yuvType, const FuncYuv16& f1, const FuncYuv16& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] and bitDepth " << bitDepth << ".");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandomBits(y, bitDepth);
+        View u(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandomBits(u, bitDepth);
+        View v(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandomBits(v, bitDepth);
+
+        View dst1(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, bitDepth, dst1, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, bitDepth, dst2, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgrAutoTest(const FuncYuv16& f1, const FuncYuv16& f2)
+    {
+        bool result = true;
+
+        result = result && Yuv420p16ToBgrAutoTest(W, H, 10, SimdYuvBt601, f1, f2);
+        result = result && Yuv420p16ToBgrAutoTest(W + E, H - E, 12, SimdYuvBt709, f1, f2);
+        result = result && Yuv420p16ToBgrAutoTest(W - E, H + E, 16, SimdYuvBt2020, f1, f2);
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgrAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv420p16ToBgrAutoTest(FUNC_YUV16(Simd::Base::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Yuv420p16ToBgrAutoTest(FUNC_YUV16(Simd::Sse41::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Yuv420p16ToBgrAutoTest(FUNC_YUV16(Simd::Avx2::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv420p16ToBgrAutoTest(FUNC_YUV16(Simd::Avx512bw::Yuv420p16ToBgr), FUNC_YUV16(SimdYuv420p16ToBgr));
+#endif 
+
+        return result;
+    }
+
+    //-------------------------------------------------------------------------------------------------
+
+    bool Yuv420p16ToBgraAutoTest(int width, int height, size_t bitDepth, SimdYuvType yuvType, const FuncYuv16A& f1, const FuncYuv16A& f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " for size [" << width << "," << height << "] and bitDepth " << bitDepth << ".");
+
+        View y(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandomBits(y, bitDepth);
+        View u(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandomBits(u, bitDepth);
+        View v(width / 2, height / 2, View::Int16, NULL, TEST_ALIGN(width));
+        FillRandomBits(v, bitDepth);
+        uint8_t alpha = Random(256);
+
+        View dst1(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View dst2(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(y, u, v, bitDepth, dst1, alpha, yuvType));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, bitDepth, dst2, alpha, yuvType));
+
+        result = result && Compare(dst1, dst2, 0, true, 64);
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgraAutoTest(const FuncYuv16A& f1, const FuncYuv16A& f2)
+    {
+        bool result = true;
+
+        result = result && Yuv420p16ToBgraAutoTest(W, H, 10, SimdYuvBt601, f1, f2);
+        result = result && Yuv420p16ToBgraAutoTest(W + E, H - E, 12, SimdYuvTrect871, f1, f2);
+        result = result && Yuv420p16ToBgraAutoTest(W - E, H + E, 16, SimdYuvBt709, f1, f2);
+
+        return result;
+    }
+
+    bool Yuv420p16ToBgraAutoTest()
+    {
+        bool result = true;
+
+        result = result && Yuv420p16ToBgraAutoTest(FUNC_YUV16A(Simd::Base::Yuv420p16ToBgra), FUNC_YUV16A(SimdYuv420p16ToBgra));
+
+#ifdef SIMD_SSE41_ENABLE
+        if (Simd::Sse41::Enable && W >= Simd::Sse41::A)
+            result = result && Yuv420p16ToBgraAutoTest(FUNC_YUV16A(Simd::Sse41::Yuv420p16ToBgra), FUNC_YUV16A(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable && W >= Simd::Avx2::A)
+            result = result && Yuv420p16ToBgraAutoTest(FUNC_YUV16A(Simd::Avx2::Yuv420p16ToBgra), FUNC_YUV16A(SimdYuv420p16ToBgra));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && Yuv420p16ToBgraAutoTest(FUNC_YUV16A(Simd::Avx512bw::Yuv420p16ToBgra), FUNC_YUV16A(SimdYuv420p16ToBgra));
+#endif 
+
+        return result;
+    }
+}